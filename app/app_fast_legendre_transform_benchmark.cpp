@@ -0,0 +1,122 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+#include <quadgrid/fast_legendre_transform.hpp>
+#include <quadgrid/legendre_transform.hpp>
+#include <quadgrid/gauss_legendre_grid.hpp>
+#include <quadgrid/gauss_family_grid.hpp>
+
+
+using namespace quadgrid;
+
+
+static double seconds (const std::chrono::steady_clock::time_point& start)
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+static void directInverse (const std::vector<double>& x, const std::vector<double>& c,
+  std::vector<double>& f)
+//O(N^2) three-term recurrence with tabulated coefficients and no stored matrices
+{
+  const size_t N = x.size();
+  std::vector<double> alpha(N), beta(N);
+  for (size_t n = 2; n < N; n++)
+  {
+    alpha[n] = (2.0*n - 1.0)/n;
+    beta[n]  = (n - 1.0)/n;
+  }
+
+  f.resize(N);
+  for (size_t j = 0; j < N; j++)
+  {
+    double p0 = 1.0, p1 = x[j], sum = c[0];
+    if (N > 1) sum += c[1]*p1;
+    for (size_t n = 2; n < N; n++)
+    {
+      const double p2 = alpha[n]*x[j]*p1 - beta[n]*p0;
+      sum += c[n]*p2;
+      p0 = p1;
+      p1 = p2;
+    }
+    f[j] = sum;
+  }
+}
+
+
+int main()
+{
+  //crossover of the direct O(N^2) inverse transform and legendreInverseFast:
+  //legendreInverse (cached Vandermonde blocks) for the tabulated orders up to 1000,
+  //the on-the-fly recurrence beyond; setup times are excluded
+  const size_t arrayOrder[] = {100, 200, 400, 600, 800, 1000, 2048, 4096, 8192};
+  const size_t nOrder = sizeof(arrayOrder)/sizeof(arrayOrder[0]);
+
+  srand(12345);
+
+  printf("     N   direct [s]     fast [s]   ratio\n");
+  for (size_t i = 0; i < nOrder; i++)
+  {
+    const size_t N = arrayOrder[i];
+    std::vector<double> x, w, c(N), f, fFast;
+    for (size_t n = 0; n < N; n++)
+      c[n] = 2.0*rand()/RAND_MAX - 1.0;
+
+    const bool tabulated = (N <= 1000);
+    if (tabulated)
+      legendreInverse (N, c, 1, f);
+    else
+      gaussJacobiGrid (N, x, w, 0.0, 0.0, -1.0, 1.0);
+    legendreInverseFast (N, c, 1, fFast);
+
+    size_t nRepeat = 1;
+    double tDirect = 0.0, tFast = 0.0;
+    while (tDirect < 0.2)
+    {
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+      for (size_t r = 0; r < nRepeat; r++)
+        if (tabulated)
+          legendreInverse (N, c, 1, f);
+        else
+          directInverse (x, c, f);
+      tDirect = seconds (start)/nRepeat;
+
+      start = std::chrono::steady_clock::now();
+      for (size_t r = 0; r < nRepeat; r++)
+        legendreInverseFast (N, c, 1, fFast);
+      tFast = seconds (start)/nRepeat;
+
+      if (tDirect*nRepeat >= 0.2)
+        break;
+      nRepeat *= 4;
+    }
+
+    double maxError = 0.0;
+    for (size_t j = 0; j < N; j++)
+      if (maxError < fabs(f[j] - fFast[j])) maxError = fabs(f[j] - fFast[j]);
+
+    printf("%6lu %12.3le %12.3le %7.2lf   maxDiff = %.2le\n", N, tDirect, tFast,
+      tDirect/tFast, maxError);
+  }
+
+
+  return 1;
+}
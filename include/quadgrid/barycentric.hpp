@@ -0,0 +1,78 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+#ifndef QUADGRID_BARYCENTRIC_HPP
+#define QUADGRID_BARYCENTRIC_HPP
+
+/// \file
+/// \brief Barycentric interpolation and spectral differentiation matrices on quadrature nodes.
+#include <vector>
+#include <cstddef>
+
+namespace quadgrid
+{
+
+/// \brief Returns the barycentric weights of the Gauss-Legendre nodes of order N.
+/// \param N The number of quadrature points (order).
+///          Must be one of: {1, 2, 3.. 100} or {110, 120, 130, .. 1000}
+/// \param lambda Output barycentric weights (size N), lambda[j] = (-1)^j sqrt((1-x_j^2) w_j).
+/// \return `true` on success; `false` if N is not supported.
+/// \note The weights are derived from the legendreGQ tables once per order and cached.
+///       Barycentric weights are invariant (up to a common factor) under the map to [a, b],
+///       so they apply to gaussLegendreGrid(N, x, w, a, b) for every interval.
+bool gaussLegendreBarycentricWeight(const size_t N, std::vector<double>& lambda);
+
+/// \brief Computes the barycentric weights of arbitrary distinct nodes in O(N^2).
+/// \param x Interpolation nodes (size N).
+/// \param lambda Output barycentric weights (size N), normalized to max |lambda| = 1.
+/// \return `true` on success; `false` if two nodes coincide.
+bool barycentricWeight(const std::vector<double>& x, std::vector<double>& lambda);
+
+/// \brief Evaluates the polynomial interpolants of nField nodal vectors at M points.
+/// \param x Interpolation nodes (size N).
+/// \param lambda Barycentric weights of the nodes (size N).
+/// \param f Nodal values, f[k*N + j] = value of field k at node j (size nField*N).
+/// \param nField Number of fields interpolated at once.
+/// \param t Evaluation points (size M).
+/// \param ft Output values, ft[k*M + i] = interpolant of field k at t[i] (size nField*M).
+/// \return `true` on success; `false` if the array sizes are inconsistent.
+/// \note O(N) per point and field (second barycentric formula). The kernel over the nodes
+///       is branch-free and vectorizes; points are distributed over threads (OpenMP).
+bool barycentricInterpolate(const std::vector<double>& x,
+  const std::vector<double>& lambda, const std::vector<double>& f, const size_t nField,
+  const std::vector<double>& t, std::vector<double>& ft);
+
+/// \brief Computes the spectral differentiation matrix of arbitrary nodes.
+/// \param x Interpolation nodes (size N).
+/// \param lambda Barycentric weights of the nodes (size N).
+/// \param D Output row-major matrix (size N*N): (D f)_i = p'(x_i) for the interpolant p of f.
+/// \return `true` on success; `false` if the array sizes are inconsistent.
+/// \note The diagonal is the negative row sum of the off-diagonal entries.
+bool differentiationMatrix(const std::vector<double>& x,
+  const std::vector<double>& lambda, std::vector<double>& D);
+
+/// \brief Computes the differentiation matrix on the Gauss-Legendre nodes of [a, b].
+/// \param N The number of quadrature points (order).
+///          Must be one of: {1, 2, 3.. 100} or {110, 120, 130, .. 1000}
+/// \param a Lower bound of interval [a, b]
+/// \param b Upper bound of interval [a, b]
+/// \param D Output row-major matrix (size N*N), nodes as returned by gaussLegendreGrid.
+/// \return `true` on success; `false` if N is not supported.
+bool gaussLegendreDifferentiationMatrix(const size_t N, const double a, const double b,
+  std::vector<double>& D);
+
+}//end namespace quadgrid
+
+
+
+
+#endif //QUADGRID_BARYCENTRIC_HPP
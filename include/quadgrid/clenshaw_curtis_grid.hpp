@@ -0,0 +1,73 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+#ifndef QUADGRID_CLENSHAW_CURTIS_GRID_HPP
+#define QUADGRID_CLENSHAW_CURTIS_GRID_HPP
+
+/// \file
+/// \brief Nested Clenshaw-Curtis and Fejer quadrature grids and a progressive integrator.
+#include <vector>
+#include <cstddef>
+#include <functional>
+
+namespace quadgrid
+{
+
+/// \brief Computes Clenshaw-Curtis nodes (Chebyshev extrema) and weights.
+/// \param N The number of quadrature points, N >= 1 (N = 1 is the midpoint rule).
+/// \param x Output vector to store the quadrature nodes (size N, ascending, including a and b).
+/// \param w Output vector to store the corresponding weights (size N).
+/// \param a Lower bound of integration interval [a, b]
+/// \param b Upper bound of integration interval [a, b]
+/// \return `true` on success; `false` if N = 0.
+/// \note Exact for polynomials of degree <= N-1. The rules with N = 2^k + 1 are nested.
+/// \note The weights are computed in O(N log N) with the in-tree FFT (Waldvogel 2006).
+bool clenshawCurtisGrid(const size_t N, std::vector<double>& x,
+  std::vector<double>& w, const double a, const double b);
+
+/// \brief Computes Fejer type-1 or type-2 nodes and weights (open rules).
+/// \param N The number of quadrature points, N >= 1.
+/// \param x Output vector to store the quadrature nodes (size N, ascending).
+/// \param w Output vector to store the corresponding weights (size N).
+/// \param type 1 for the Chebyshev points (zeros of T_N), 2 for the interior Chebyshev
+///        extrema (zeros of U_N).
+/// \param a Lower bound of integration interval [a, b]
+/// \param b Upper bound of integration interval [a, b]
+/// \return `true` on success; `false` if N = 0 or type is not 1 or 2.
+/// \note Exact for polynomials of degree <= N-1. Type-2 rules with N = 2^k - 1 are nested;
+///       type-1 rules with N = 3^k are nested.
+bool fejerGrid(const size_t N, std::vector<double>& x, std::vector<double>& w,
+  const int type, const double a, const double b);
+
+/// \brief Integrates f over [a, b] with nested Clenshaw-Curtis rules, doubling the number
+///        of intervals (N = 3, 5, 9, 17, ..) and reusing every previous evaluation.
+/// \param f Integrand.
+/// \param a Lower bound of integration interval [a, b]
+/// \param b Upper bound of integration interval [a, b]
+/// \param relTol Relative tolerance.
+/// \param absTol Absolute tolerance.
+/// \param maxN Maximum number of function evaluations.
+/// \param integral Output integral (the finest estimate, also when not converged).
+/// \param error Output error estimate |I_N - I_(N+1)/2|.
+/// \param x Output nodes of the finest grid (ascending).
+/// \param fx Output f(x) at the nodes of the finest grid; every value was evaluated once.
+/// \return `true` if error <= max(absTol, relTol*|integral|); `false` otherwise.
+bool clenshawCurtisIntegrate(const std::function<double(double)>& f, const double a,
+  const double b, const double relTol, const double absTol, const size_t maxN,
+  double& integral, double& error, std::vector<double>& x, std::vector<double>& fx);
+
+}//end namespace quadgrid
+
+
+
+
+#endif //QUADGRID_CLENSHAW_CURTIS_GRID_HPP
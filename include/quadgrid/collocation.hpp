@@ -0,0 +1,91 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+#ifndef QUADGRID_COLLOCATION_HPP
+#define QUADGRID_COLLOCATION_HPP
+
+/// \file
+/// \brief Butcher tableaus of implicit Runge-Kutta collocation methods and a reference integrator.
+#include <vector>
+#include <cstddef>
+#include <complex>
+#include <functional>
+
+namespace quadgrid
+{
+
+/// \brief Family of the s-stage implicit Runge-Kutta method.
+enum collocationFamily
+{
+  collocationGauss,          ///< Gauss-Legendre nodes, order 2s, A-stable
+  collocationRadauIIA,       ///< right Radau nodes (c_s = 1), order 2s-1, L-stable, stiffly accurate
+  collocationLobattoIIIC     ///< Lobatto nodes (c_1 = 0, c_s = 1), order 2s-2, L-stable, stiffly accurate
+};
+
+/// \brief Butcher tableau with the eigen-decomposition of its stage matrix.
+struct butcherTableau
+{
+  size_t s;                                        ///< number of stages
+  size_t order;                                    ///< classical order
+  std::vector<double> A;                           ///< stage matrix, row-major (size s*s)
+  std::vector<double> b;                           ///< weights (size s)
+  std::vector<double> c;                           ///< nodes in [0, 1] (size s)
+  std::vector< std::complex<double> > eigenvalue;  ///< eigenvalues of A (size s)
+  std::vector< std::complex<double> > T;           ///< eigenvectors, column k for eigenvalue k (size s*s)
+  std::vector< std::complex<double> > Tinv;        ///< inverse of T, A = T diag(eigenvalue) Tinv
+};
+
+/// \brief Returns the Butcher tableau of an s-stage Gauss, Radau IIA or Lobatto IIIC method.
+/// \param family Method family.
+/// \param s Number of stages: 1 <= s <= 20 (Gauss, Radau IIA), 2 <= s <= 20 (Lobatto IIIC).
+/// \param tableau Output tableau.
+/// \return `true` on success; `false` if s is out of range or the eigen-decomposition fails.
+/// \note The nodes come from the Gauss-Legendre and Gauss-Jacobi grids (Radau: the zeros of
+///       P_(s-1)^(1,0) and 1, Lobatto: 0, the zeros of P_(s-2)^(1,1) and 1). A[i][j] is the
+///       integral over [0, c_i] of the j-th Lagrange polynomial, computed with barycentric
+///       interpolation and Gauss-Legendre quadrature (Lobatto IIIC: A[i][0] = b_0 and the
+///       other columns integrate the Lagrange polynomials of c_1 .. c_(s-1)). The eigenvalues
+///       are the roots of the Pade denominator det(I - zA) polished by inverse iteration on A.
+///       Tableaus are computed once per (family, s) and cached. The eigenvector matrix T
+///       is ill-conditioned for many stages: A - T diag(eigenvalue) Tinv is about 1e-14 |A|
+///       for s <= 8 and 1e-6 |A| at s = 20.
+bool butcherTableauCollocation(const collocationFamily family, const size_t s,
+  butcherTableau& tableau);
+
+/// \brief Integrates y' = f(t, y) with fixed steps of an implicit collocation method.
+/// \param f Right-hand side, f(t, y, dydt) with y[n] and dydt[n].
+/// \param jacobian Jacobian of f, jacobian(t, y, J) with row-major J[n*n] (J[i*n+k] = df_i/dy_k).
+/// \param n Dimension of the system.
+/// \param family Method family.
+/// \param s Number of stages (see butcherTableauCollocation).
+/// \param t0 Initial time.
+/// \param t1 Final time.
+/// \param nStep Number of steps of size (t1-t0)/nStep.
+/// \param y Input initial value, output value at t1 (size n).
+/// \return `true` on success; `false` if the input is invalid or Newton does not converge.
+/// \note Simplified Newton with the Jacobian at the beginning of each step. The stage
+///       system (I - h A x J) dZ = r is decoupled by the eigenvectors of A into the s complex
+///       systems (I - h lambda_k J) dW_k = (Tinv r)_k of size n; the residual r uses A itself,
+///       so the errors of the eigen-decomposition only slow down the iteration. The update uses
+///       y + Z_s for the stiffly accurate families and y + (b^T A^-1 x I) Z for Gauss, with
+///       A^T d = b solved by an LU decomposition of A, so f is not re-evaluated at the stages.
+bool collocationIntegrate(const std::function<void(const double, const double*, double*)>& f,
+  const std::function<void(const double, const double*, double*)>& jacobian,
+  const size_t n, const collocationFamily family, const size_t s, const double t0,
+  const double t1, const size_t nStep, std::vector<double>& y);
+
+}//end namespace quadgrid
+
+
+
+
+#endif //QUADGRID_COLLOCATION_HPP
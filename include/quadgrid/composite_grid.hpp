@@ -0,0 +1,67 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+#ifndef QUADGRID_COMPOSITE_GRID_HPP
+#define QUADGRID_COMPOSITE_GRID_HPP
+
+/// \file
+/// \brief Composite (multi-element) Gauss-Legendre grids and integrators on 1D and tensor meshes.
+#include <vector>
+#include <cstddef>
+#include <functional>
+
+namespace quadgrid
+{
+
+/// \brief Computes the composite Gauss-Legendre grid of a 1D element mesh.
+/// \param breakpoint Strictly ascending element boundaries (size nElement+1 >= 2).
+/// \param order Gauss-Legendre order of every element (size 1) or of each element (size nElement).
+///        Orders must be supported by gaussLegendreGrid.
+/// \param x Output nodes, element by element (size Sum{ order[e] }).
+/// \param w Output weights.
+/// \return `true` on success; `false` if the mesh or an order is invalid.
+bool compositeGaussLegendreGrid(const std::vector<double>& breakpoint,
+  const std::vector<size_t>& order, std::vector<double>& x, std::vector<double>& w);
+
+/// \brief Integrates f over a 1D element mesh with a Gauss-Legendre rule on each element.
+/// \param f Integrand; it is called concurrently from several threads.
+/// \param breakpoint Strictly ascending element boundaries (size nElement+1 >= 2); put the
+///        kinks and discontinuities of f at breakpoints.
+/// \param order Gauss-Legendre order of every element (size 1) or of each element (size nElement).
+/// \param integral Output integral over [breakpoint.front(), breakpoint.back()].
+/// \return `true` on success; `false` if the mesh or an order is invalid.
+/// \note The reference rules are mapped onto each element on the fly (no per-element
+///       grids). Elements are evaluated in dynamically scheduled OpenMP chunks and the
+///       element sums are combined by a pairwise reduction in element order, so the
+///       result does not depend on the number of threads.
+bool compositeGaussLegendreIntegrate(const std::function<double(double)>& f,
+  const std::vector<double>& breakpoint, const std::vector<size_t>& order,
+  double& integral);
+
+/// \brief Integrates f over a tensor-product element mesh in D dimensions.
+/// \param f Integrand f(x) with x[D]; it is called concurrently from several threads.
+/// \param breakpoint Element boundaries of each dimension, breakpoint[d] strictly ascending.
+/// \param order Orders of each dimension, order[d] of size 1 or breakpoint[d].size()-1.
+/// \param integral Output integral over the box.
+/// \return `true` on success; `false` if the mesh or an order is invalid.
+/// \note Elements are the products of the 1D elements (last dimension fastest); the
+///       same chunking and deterministic reduction as the 1D integrator are used.
+bool compositeGaussLegendreIntegrateTensor(const std::function<double(const double*)>& f,
+  const std::vector< std::vector<double> >& breakpoint,
+  const std::vector< std::vector<size_t> >& order, double& integral);
+
+}//end namespace quadgrid
+
+
+
+
+#endif //QUADGRID_COMPOSITE_GRID_HPP
@@ -0,0 +1,72 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+#ifndef QUADGRID_DOUBLE_EXPONENTIAL_HPP
+#define QUADGRID_DOUBLE_EXPONENTIAL_HPP
+
+/// \file
+/// \brief Double-exponential (tanh-sinh and exp-sinh) quadrature with level-nested reuse.
+#include <vector>
+#include <cstddef>
+#include <functional>
+
+namespace quadgrid
+{
+
+/// \brief Integrates f over [a, b] with tanh-sinh quadrature, x = c + h tanh(Pi/2 sinh(t)).
+/// \param f Integrand; it may have integrable singularities at a and b.
+/// \param a Lower bound of integration interval [a, b]
+/// \param b Upper bound of integration interval [a, b]
+/// \param relTol Relative tolerance.
+/// \param absTol Absolute tolerance.
+/// \param maxLevel Maximum level (step 2^-level in t, at most 12).
+/// \param integral Output integral (the finest estimate, also when not converged).
+/// \param error Output error estimate |I_level - I_(level-1)|.
+/// \param nEvaluation Output number of evaluations of f.
+/// \return `true` if error <= max(absTol, relTol*|integral|); `false` otherwise.
+/// \note Each level halves the step and evaluates only the new (odd) nodes; the nodes
+///       and weights of every level are tabulated once and cached. Nodes that round to
+///       a or b are skipped; use tanhSinhIntegrateDistance for strong singularities.
+bool tanhSinhIntegrate(const std::function<double(double)>& f, const double a,
+  const double b, const double relTol, const double absTol, const size_t maxLevel,
+  double& integral, double& error, size_t& nEvaluation);
+
+/// \brief Tanh-sinh quadrature of f(x, d), where d > 0 is the distance of x to the nearer
+///        endpoint (d = x-a for x <= (a+b)/2, d = b-x otherwise).
+/// \note d is computed without cancellation from the tabulated complement 1 - tanh, so
+///       singular factors such as 1/sqrt(d) are resolved down to d ~ 1e-300 (b-a).
+///       The other parameters are those of tanhSinhIntegrate.
+bool tanhSinhIntegrateDistance(const std::function<double(double, double)>& f,
+  const double a, const double b, const double relTol, const double absTol,
+  const size_t maxLevel, double& integral, double& error, size_t& nEvaluation);
+
+/// \brief Integrates f over [a, inf) with exp-sinh quadrature, x = a + exp(Pi/2 sinh(t)).
+/// \param f Integrand; it may have an integrable singularity at a and must decay at inf.
+/// \param a Lower bound of the interval.
+/// \param relTol Relative tolerance.
+/// \param absTol Absolute tolerance.
+/// \param maxLevel Maximum level (step 2^-level in t, at most 12).
+/// \param integral Output integral (the finest estimate, also when not converged).
+/// \param error Output error estimate |I_level - I_(level-1)|.
+/// \param nEvaluation Output number of evaluations of f.
+/// \return `true` if error <= max(absTol, relTol*|integral|); `false` otherwise.
+/// \note Same level nesting and cached tables as tanhSinhIntegrate.
+bool expSinhIntegrate(const std::function<double(double)>& f, const double a,
+  const double relTol, const double absTol, const size_t maxLevel,
+  double& integral, double& error, size_t& nEvaluation);
+
+}//end namespace quadgrid
+
+
+
+
+#endif //QUADGRID_DOUBLE_EXPONENTIAL_HPP
@@ -0,0 +1,55 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+#ifndef QUADGRID_FAST_LEGENDRE_TRANSFORM_HPP
+#define QUADGRID_FAST_LEGENDRE_TRANSFORM_HPP
+
+/// \file
+/// \brief O(N log N) Legendre transforms on Gauss-Legendre grids through a Chebyshev intermediate.
+#include <vector>
+#include <cstddef>
+
+namespace quadgrid
+{
+
+/// \brief Fast version of legendreForward: nodal values to Legendre coefficients.
+/// \param N The number of quadrature points (order), N >= 1.
+/// \param f Nodal values, f[v*N + i] = vector v at node x[i] (size nVector*N).
+/// \param nVector Number of vectors transformed.
+/// \param c Output coefficients, c[v*N + n] = (2n+1)/2 Sum{ w[i] P_n(x[i]) f[v*N + i] }
+///          for n = 0 .. N-1 (size nVector*N).
+/// \return `true` on success; `false` if the sizes are inconsistent.
+/// \note The nodes are those of gaussLegendreGrid(N, x, w, -1, 1) for the tabulated orders
+///       and those of gaussJacobiGrid(N, x, w, 0, 0, -1, 1) for all other N.
+/// \note The Chebyshev moments Sum{ w[i] f[i] T_k(x[i]) } are computed with a nonuniform
+///       discrete cosine transform (Taylor expansion about the nearest FFT grid point,
+///       about 17 FFTs of length 2N) and converted with chebyshevMomentToLegendre.
+///       The setup (nodes and plans) is O(N^2) once per N and cached.
+bool legendreForwardFast(const size_t N, const std::vector<double>& f, const size_t nVector,
+  std::vector<double>& c);
+
+/// \brief Fast version of legendreInverse: Legendre series at the Gauss-Legendre nodes.
+/// \param N The number of quadrature points (order), N >= 1.
+/// \param c Coefficients, c[v*N + n] for n = 0 .. N-1 (size nVector*N).
+/// \param nVector Number of vectors transformed.
+/// \param f Output nodal values, f[v*N + i] = Sum{ c[v*N + n] P_n(x[i]) } (size nVector*N).
+/// \return `true` on success; `false` if the sizes are inconsistent.
+/// \note legendreToChebyshev followed by a nonuniform discrete cosine transform.
+bool legendreInverseFast(const size_t N, const std::vector<double>& c, const size_t nVector,
+  std::vector<double>& f);
+
+}//end namespace quadgrid
+
+
+
+
+#endif //QUADGRID_FAST_LEGENDRE_TRANSFORM_HPP
@@ -0,0 +1,39 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+#ifndef QUADGRID_FFT_HPP
+#define QUADGRID_FFT_HPP
+
+/// \file
+/// \brief In-tree fast Fourier transform of arbitrary length (radix-2 and Bluestein).
+#include <vector>
+#include <complex>
+#include <cstddef>
+
+namespace quadgrid
+{
+
+/// \brief In-place discrete Fourier transform of arbitrary length n = data.size().
+/// \param data Input/output vector of size n >= 1.
+/// \param inverse `false` for data[k] = Sum{ data[j] e^(-2 pi i jk/n) },
+///        `true` for data[k] = Sum{ data[j] e^(+2 pi i jk/n) } (not normalized by 1/n).
+/// \return `true` on success; `false` if data is empty.
+/// \note Powers of two use an iterative radix-2 transform; other lengths use Bluestein's
+///       chirp-z algorithm. Twiddle factors and chirps are cached per length.
+bool fft(std::vector< std::complex<double> >& data, const bool inverse);
+
+}//end namespace quadgrid
+
+
+
+
+#endif //QUADGRID_FFT_HPP
@@ -0,0 +1,100 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+#ifndef QUADGRID_GAUNT_HPP
+#define QUADGRID_GAUNT_HPP
+
+/// \file
+/// \brief Gaunt coefficients and products of spherical harmonic expansions.
+#include <vector>
+#include <complex>
+#include <cstddef>
+#include <memory>
+
+namespace quadgrid
+{
+
+/// \brief Returns the index of Y(l,m), -l <= m <= l, in the full layout [Y(0,0),Y(1,-1),Y(1,0),Y(1,1),Y(2,-2) ...].
+/// \param l Degree index.
+/// \param m Order index.
+/// \return l^2 + l + m.
+inline size_t gauntArrayIndex(size_t l, int m)
+{
+  return l*l + l + m;
+}
+
+/// \brief Nonzero Gaunt coefficient Integral{ Y(l1,m1) Y(l2,m2) conj(Y(l3,m3)) dOmega }.
+struct gauntEntry
+{
+  unsigned int index1;   ///< gauntArrayIndex(l1, m1)
+  unsigned int index2;   ///< gauntArrayIndex(l2, m2)
+  unsigned int index3;   ///< sphereHarmonicArrayIndex(l3, m3) with m3 = m1 + m2 >= 0
+  double value;          ///< Gaunt coefficient
+};
+
+/// \brief Returns the sparse table of all nonzero Gaunt coefficients with l1, l2, l3 <= lmax and m3 >= 0.
+/// \param lmax Maximum degree (<= 40).
+/// \param table Output table, shared with the cache of the library.
+/// \return `true` on success; `false` if lmax is too large.
+/// \note The coefficients vanish unless m3 = m1 + m2, |l1 - l2| <= l3 <= l1 + l2 and l1 + l2 + l3 is
+///       even. They are computed by Gauss-Legendre quadrature in cos(theta), which is exact for the
+///       polynomial P(l1,m1) P(l2,m2) P(l3,m3) of degree <= 3 lmax, and cached per lmax.
+bool gauntTable(const size_t lmax, std::shared_ptr< const std::vector<gauntEntry> >& table);
+
+/// \brief Expands the product of two real functions with the Gaunt coefficients.
+/// \param lmax1 Band limit of the first function.
+/// \param c1 Coefficients of the first function in the layout of sphereHarmonicArrayIndex.
+/// \param lmax2 Band limit of the second function.
+/// \param c2 Coefficients of the second function in the layout of sphereHarmonicArrayIndex.
+/// \param lmax3 Band limit of the product.
+/// \param c3 Output coefficients of the product truncated to degree lmax3.
+/// \return `true` on success; `false` if the degrees are too large or the sizes are inconsistent.
+/// \note A sum over the nonzero entries of gauntTable, O(lmax^5). Useful as a reference and for
+///       small band limits; sphereHarmonicProduct is faster for lmax beyond about 8.
+bool sphereHarmonicProductGaunt(const size_t lmax1, const std::vector< std::complex<double> >& c1,
+  const size_t lmax2, const std::vector< std::complex<double> >& c2, const size_t lmax3,
+  std::vector< std::complex<double> >& c3);
+
+/// \brief Returns the grid parameter of unitSphereGaussLegendre for alias-free products.
+/// \param lmax1 Band limit of the first function.
+/// \param lmax2 Band limit of the second function.
+/// \param lmax3 Band limit of the product.
+/// \return lmax1 + lmax2 + lmax3: the projection of the product of degree lmax1 + lmax2 onto
+///         degree lmax3 is exact on this grid.
+inline size_t sphereHarmonicProductGrid(size_t lmax1, size_t lmax2, size_t lmax3)
+{
+  return lmax1 + lmax2 + lmax3;
+}
+
+/// \brief Expands the product of real functions pseudo-spectrally.
+/// \param lmax1 Band limit of the first functions.
+/// \param c1 Coefficients of the first functions (size nVector*sphereHarmonicArraySize(lmax1)).
+/// \param lmax2 Band limit of the second functions.
+/// \param c2 Coefficients of the second functions (size nVector*sphereHarmonicArraySize(lmax2)).
+/// \param lmax3 Band limit of the products.
+/// \param nVector Number of products.
+/// \param c3 Output coefficients of the products (size nVector*sphereHarmonicArraySize(lmax3)).
+/// \return `true` on success; `false` if the grid is too large or the sizes are inconsistent.
+/// \note Both factors are evaluated with sphereTransformInverse on the grid of
+///       sphereHarmonicProductGrid, multiplied pointwise and projected with sphereTransformForward.
+///       The result equals sphereHarmonicProductGaunt in O(L^3) instead of O(L^5) with L = lmax1 +
+///       lmax2 + lmax3 <= 1998.
+bool sphereHarmonicProduct(const size_t lmax1, const std::vector< std::complex<double> >& c1,
+  const size_t lmax2, const std::vector< std::complex<double> >& c2, const size_t lmax3,
+  const size_t nVector, std::vector< std::complex<double> >& c3);
+
+}//end namespace quadgrid
+
+
+
+
+#endif //QUADGRID_GAUNT_HPP
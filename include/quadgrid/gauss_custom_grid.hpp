@@ -0,0 +1,84 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+#ifndef QUADGRID_GAUSS_CUSTOM_GRID_HPP
+#define QUADGRID_GAUSS_CUSTOM_GRID_HPP
+
+/// \file
+/// \brief Gauss quadrature grids for user-defined weight functions (Stieltjes + Golub-Welsch).
+#include <vector>
+#include <cstddef>
+#include <functional>
+
+namespace quadgrid
+{
+
+/// \brief Computes the Gauss rule of a measure from its three-term recurrence (Golub-Welsch).
+/// \param N The number of quadrature points (order), 1 <= N <= alpha.size(), beta.size().
+/// \param alpha Recurrence coefficients alpha[k] of the monic orthogonal polynomials.
+/// \param beta Recurrence coefficients beta[k] (beta[k] > 0 for k >= 1); beta[0] is the
+///        total mass of the measure.
+/// \param x Output vector to store the quadrature nodes (size N, ascending).
+/// \param w Output vector to store the corresponding weights (size N).
+/// \return `true` on success; `false` if the input is invalid or the eigen-solver fails.
+/// \note The monic polynomials satisfy pi_{k+1}(x) = (x - alpha[k]) pi_k(x) - beta[k] pi_{k-1}(x).
+/// \note The symmetric tridiagonal eigenproblem is solved in-tree: implicit QL for small N
+///       and Sturm-sequence bisection, parallel over the nodes (OpenMP), for large N.
+bool gaussRecurrenceGrid(const size_t N, const std::vector<double>& alpha,
+  const std::vector<double>& beta, std::vector<double>& x, std::vector<double>& w);
+
+/// \brief Computes the recurrence coefficients of a discrete measure (Stieltjes procedure).
+/// \param N The number of recurrence coefficients, N <= number of points with positive weight.
+/// \param xm Support points of the discrete measure (size M).
+/// \param wm Positive weights of the discrete measure (size M).
+/// \param alpha Output recurrence coefficients (size N).
+/// \param beta Output recurrence coefficients (size N), beta[0] = Sum{ wm[i] }.
+/// \return `true` on success; `false` if the measure has too few points.
+/// \note The Stieltjes procedure is run on orthonormal vectors (Lanczos form) so that
+///       the polynomial values neither overflow nor underflow.
+bool stieltjesRecurrence(const size_t N, const std::vector<double>& xm,
+  const std::vector<double>& wm, std::vector<double>& alpha, std::vector<double>& beta);
+
+/// \brief Computes the N-point Gauss rule of a discrete measure, e.g. a tabulated spectrum.
+/// \param N The number of quadrature points (order).
+/// \param xm Support points of the discrete measure (size M, M >= N).
+/// \param wm Positive weights of the discrete measure (size M).
+/// \param x Output vector to store the quadrature nodes (size N, ascending).
+/// \param w Output vector to store the corresponding weights (size N).
+/// \return `true` on success; `false` otherwise.
+/// \note Sum{ f(x[i])*w[i] } = Sum{ f(xm[j])*wm[j] } for all polynomials f of degree <= 2N-1.
+bool gaussDiscreteMeasureGrid(const size_t N, const std::vector<double>& xm,
+  const std::vector<double>& wm, std::vector<double>& x, std::vector<double>& w);
+
+/// \brief Computes the N-point Gauss rule of a weight function on [a, b].
+/// \param N The number of quadrature points (order).
+/// \param weight Non-negative weight function W(x).
+/// \param a Lower bound of integration interval [a, b]
+/// \param b Upper bound of integration interval [a, b]
+/// \param M Order of the Gauss-Legendre grid used to discretize W (M >= N).
+///          Must be one of: {1, 2, 3.. 100} or {110, 120, 130, .. 1000}
+/// \param x Output vector to store the quadrature nodes (size N, ascending).
+/// \param w Output vector to store the corresponding weights (size N).
+/// \return `true` on success; `false` otherwise.
+/// \note Integral{ W(x) f(x) dx } over [a,b] = Sum{ f(x[i])*w[i] }. The rule is exact for
+///       the discretized measure; its accuracy for W is that of the M-point Gauss-Legendre
+///       rule applied to W(x) x^k, k <= 2N-1.
+bool gaussWeightFunctionGrid(const size_t N, const std::function<double(double)>& weight,
+  const double a, const double b, const size_t M, std::vector<double>& x,
+  std::vector<double>& w);
+
+}//end namespace quadgrid
+
+
+
+
+#endif //QUADGRID_GAUSS_CUSTOM_GRID_HPP
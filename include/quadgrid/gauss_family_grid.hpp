@@ -0,0 +1,85 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+#ifndef QUADGRID_GAUSS_FAMILY_GRID_HPP
+#define QUADGRID_GAUSS_FAMILY_GRID_HPP
+
+/// \file
+/// \brief Gauss-Laguerre, Gauss-Hermite, Gauss-Jacobi and Gauss-Chebyshev quadrature grids.
+/// \note The Laguerre, Hermite and Jacobi rules are computed once per order and exponents and
+///       cached. Up to order 100 every node is found by iterations on the three-term recurrence,
+///       O(N) each. Above, the middle node comes from the recurrence and the others are marched
+///       from zero to zero with a Taylor series of the differential equation of the polynomial,
+///       O(1) each, so a rule costs O(N) instead of O(N^2): 0.07 s instead of 3 s at N = 10000.
+#include <vector>
+#include <cstddef>
+
+namespace quadgrid
+{
+
+/// \brief Computes Gauss-Laguerre quadrature nodes and weights for the weight t^alpha e^(-t).
+/// \param N The number of quadrature points (order), N >= 1.
+/// \param x Output vector to store the quadrature nodes (size N, ascending).
+/// \param w Output vector to store the corresponding weights (size N).
+/// \param alpha Exponent of the weight function, alpha > -1.
+/// \param a Lower bound of the integration interval [a, inf).
+/// \param scale Length scale s > 0 of the map x = a + s*t.
+/// \return `true` on success; `false` if the parameters are out of range.
+/// \note Integral{ t^alpha e^(-t) f(x) dx } over [a, inf) = Sum{ f(x[i])*w[i] }, t = (x-a)/s.
+bool gaussLaguerreGrid(const size_t N, std::vector<double>& x,
+  std::vector<double>& w, const double alpha, const double a, const double scale);
+
+/// \brief Computes Gauss-Hermite quadrature nodes and weights for the weight e^(-t^2).
+/// \param N The number of quadrature points (order), N >= 1.
+/// \param x Output vector to store the quadrature nodes (size N, ascending).
+/// \param w Output vector to store the corresponding weights (size N).
+/// \param center Center c of the map x = c + s*t.
+/// \param scale Length scale s > 0 of the map x = c + s*t.
+/// \return `true` on success; `false` if the parameters are out of range.
+/// \note Integral{ e^(-t^2) f(x) dx } over (-inf, inf) = Sum{ f(x[i])*w[i] }, t = (x-c)/s.
+/// \note Weights of the outermost nodes underflow to zero for large N.
+bool gaussHermiteGrid(const size_t N, std::vector<double>& x,
+  std::vector<double>& w, const double center, const double scale);
+
+/// \brief Computes Gauss-Jacobi quadrature nodes and weights for the weight (1-t)^alpha (1+t)^beta.
+/// \param N The number of quadrature points (order), N >= 1.
+/// \param x Output vector to store the quadrature nodes (size N, ascending).
+/// \param w Output vector to store the corresponding weights (size N).
+/// \param alpha Exponent at the upper end, alpha > -1.
+/// \param beta Exponent at the lower end, beta > -1.
+/// \param a Lower bound of integration interval [a, b]
+/// \param b Upper bound of integration interval [a, b]
+/// \return `true` on success; `false` if the parameters are out of range.
+/// \note Integral{ (1-t)^alpha (1+t)^beta f(x) dx } over [a, b] = Sum{ f(x[i])*w[i] },
+///       where t = (2x-a-b)/(b-a) is the affine map of [a, b] onto [-1, 1].
+bool gaussJacobiGrid(const size_t N, std::vector<double>& x,
+  std::vector<double>& w, const double alpha, const double beta,
+  const double a, const double b);
+
+/// \brief Computes Gauss-Chebyshev quadrature nodes and weights in closed form.
+/// \param N The number of quadrature points (order), N >= 1.
+/// \param x Output vector to store the quadrature nodes (size N, ascending).
+/// \param w Output vector to store the corresponding weights (size N).
+/// \param kind 1 for the weight (1-t^2)^(-1/2), 2 for the weight (1-t^2)^(1/2).
+/// \param a Lower bound of integration interval [a, b]
+/// \param b Upper bound of integration interval [a, b]
+/// \return `true` on success; `false` if kind is not 1 or 2.
+/// \note Same affine convention as gaussJacobiGrid (alpha = beta = -1/2 or 1/2).
+bool gaussChebyshevGrid(const size_t N, std::vector<double>& x,
+  std::vector<double>& w, const int kind, const double a, const double b);
+
+}//end namespace quadgrid
+
+
+
+
+#endif //QUADGRID_GAUSS_FAMILY_GRID_HPP
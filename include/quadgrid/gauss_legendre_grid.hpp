@@ -34,6 +34,13 @@ bool gaussLegendreGrid (const size_t N, std::vector<double>& x,
 //output: x[N] and w[N] = coordinates and weights
 //        Integral{ f(x) } over [a,b] = Sum{ f(x[i])*w[i] } from i = 0 to N - 1
 
+/// \brief Returns whether gaussLegendreGrid has a table for an order.
+/// \param N The number of quadrature points (order).
+/// \return `true` if N is one of {1, 2, 3.. 100} or {110, 120, 130, .. 1000}.
+inline bool gaussLegendreGridTabulated (const size_t N)
+{
+  return (N >= 1) && ((N <= 100) || ((N <= 1000) && (N % 10 == 0)));
+}
 
 }//end namespace quadgrid
 
@@ -0,0 +1,53 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+#ifndef QUADGRID_LEGENDRE_TRANSFORM_HPP
+#define QUADGRID_LEGENDRE_TRANSFORM_HPP
+
+/// \file
+/// \brief Discrete Legendre transforms between Gauss-Legendre nodal values and coefficients.
+#include <vector>
+#include <cstddef>
+
+namespace quadgrid
+{
+
+/// \brief Transforms nodal values on the Gauss-Legendre grid to Legendre coefficients.
+/// \param N The number of quadrature points (order).
+///          Must be one of: {1, 2, 3.. 100} or {110, 120, 130, .. 1000}
+/// \param f Nodal values, f[v*N + i] = vector v at node x[i] of gaussLegendreGrid (size nVector*N).
+/// \param nVector Number of vectors transformed at once.
+/// \param c Output coefficients, c[v*N + n] = (2n+1)/2 Sum{ w[i] P_n(x[i]) f[v*N + i] }
+///          for n = 0 .. N-1 (size nVector*N).
+/// \return `true` on success; `false` if N is not supported or the sizes are inconsistent.
+/// \note Exact for polynomials of degree <= N-1: f(x) = Sum{ c[n] P_n(x) }.
+/// \note The weight-scaled Vandermonde matrix is cached per N and split by parity, which
+///       halves the flops. Vectors are processed in blocks by a vectorized kernel.
+bool legendreForward(const size_t N, const std::vector<double>& f, const size_t nVector,
+  std::vector<double>& c);
+
+/// \brief Evaluates Legendre series at the Gauss-Legendre nodes (inverse of legendreForward).
+/// \param N The number of quadrature points (order).
+///          Must be one of: {1, 2, 3.. 100} or {110, 120, 130, .. 1000}
+/// \param c Coefficients, c[v*N + n] for n = 0 .. N-1 (size nVector*N).
+/// \param nVector Number of vectors transformed at once.
+/// \param f Output nodal values, f[v*N + i] = Sum{ c[v*N + n] P_n(x[i]) } (size nVector*N).
+/// \return `true` on success; `false` if N is not supported or the sizes are inconsistent.
+bool legendreInverse(const size_t N, const std::vector<double>& c, const size_t nVector,
+  std::vector<double>& f);
+
+}//end namespace quadgrid
+
+
+
+
+#endif //QUADGRID_LEGENDRE_TRANSFORM_HPP
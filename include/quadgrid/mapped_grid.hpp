@@ -0,0 +1,70 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+#ifndef QUADGRID_MAPPED_GRID_HPP
+#define QUADGRID_MAPPED_GRID_HPP
+
+/// \file
+/// \brief Gauss-Legendre rules mapped to the semi-infinite interval [a, inf) and the real line.
+#include <vector>
+#include <cstddef>
+
+namespace quadgrid
+{
+
+/// \brief Map from the Gauss-Legendre variable t in (-1, 1) to the unbounded interval.
+/// \note With u = (x-a)/L for the scale L:
+///       semi-infinite [a, inf):
+///         algebraic   u = (1+t)/(1-t)           (tails decaying like a power of x)
+///         exponential u = ln(2/(1-t))           (tails decaying like exp(-x/L))
+///         tanh        u = atanh((1+t)/2)        (exponential tails, half the stretch far from a)
+///       real line (-inf, inf) centered at a:
+///         algebraic   u = t/sqrt(1-t^2)
+///         exponential u = asinh(t/(1-t^2))
+///         tanh        u = atanh(t)
+enum mappedGridMap
+{
+  mappedGridAlgebraic,
+  mappedGridExponential,
+  mappedGridTanh
+};
+
+/// \brief Computes a Gauss-Legendre rule mapped to [a, inf).
+/// \param N The number of quadrature points (order), see gaussLegendreGrid.
+/// \param x Output vector to store the quadrature nodes (size N, ascending, all > a).
+/// \param w Output vector to store the corresponding weights (size N).
+/// \param a Lower bound of the interval.
+/// \param scale Scale L > 0 of the map; the algebraic map sends t = 0 to a + L.
+/// \param map Map of the interval (see mappedGridMap).
+/// \return `true` on success; `false` if N is not supported, scale <= 0 or map is invalid.
+/// \note Integral{ f(x) } over [a, inf) = Sum{ f(x[i])*w[i] }. The mapped rules are cached
+///       per (N, map) for the unit scale; scale and a are applied in O(N).
+bool gaussLegendreSemiInfiniteGrid(const size_t N, std::vector<double>& x,
+  std::vector<double>& w, const double a, const double scale, const mappedGridMap map);
+
+/// \brief Computes a Gauss-Legendre rule mapped to the real line (-inf, inf).
+/// \param N The number of quadrature points (order), see gaussLegendreGrid.
+/// \param x Output vector to store the quadrature nodes (size N, ascending).
+/// \param w Output vector to store the corresponding weights (size N).
+/// \param center Center a of the map (x = a for t = 0).
+/// \param scale Scale L > 0 of the map; roughly half of the nodes lie in [a - L, a + L].
+/// \param map Map of the line (see mappedGridMap).
+/// \return `true` on success; `false` if N is not supported, scale <= 0 or map is invalid.
+bool gaussLegendreInfiniteGrid(const size_t N, std::vector<double>& x,
+  std::vector<double>& w, const double center, const double scale, const mappedGridMap map);
+
+}//end namespace quadgrid
+
+
+
+
+#endif //QUADGRID_MAPPED_GRID_HPP
@@ -0,0 +1,86 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+#ifndef QUADGRID_MOLECULAR_GRID_HPP
+#define QUADGRID_MOLECULAR_GRID_HPP
+
+/// \file
+/// \brief Atom-centered (radial x Lebedev) integration grids with fuzzy-cell partitioning.
+#include <vector>
+#include <cstddef>
+
+#include <quadgrid/mapped_grid.hpp>
+
+namespace quadgrid
+{
+
+/// \brief Fuzzy-cell partitioning scheme used to split space between atoms.
+enum molecularGridPartition
+{
+  molecularGridBecke,     ///< Becke (1988) cell function, 3 iterations of p(mu)
+  molecularGridStratmann  ///< Stratmann-Scuseria-Frisch (1996) cell function with exact screening
+};
+
+/// \brief Parameters controlling the radial rule, angular pruning and partitioning.
+/// \note The radial rule maps the Gauss-Legendre grid of order nRadial on [-1, 1] to
+///       [0, inf) with gaussLegendreSemiInfiniteGrid and the scale R, the radius of the atom;
+///       the default algebraic map is r = R (1+x)/(1-x).
+/// \note Shells with r < pruneInner*R use lebedevIndexInner, shells with r > pruneOuter*R
+///       use lebedevIndexOuter and all other shells use lebedevIndex.
+struct molecularGridParameter
+{
+  size_t nRadial           = 75;      ///< Gauss-Legendre order of the radial rule
+  mappedGridMap radialMap  = mappedGridAlgebraic;  ///< radial map (see mappedGridMap)
+  size_t lebedevIndex      = 6;       ///< Lebedev grid index for the valence region (302 points)
+  size_t lebedevIndexInner = 0;       ///< Lebedev grid index near the nucleus (38 points)
+  size_t lebedevIndexOuter = 2;       ///< Lebedev grid index far from the nucleus (110 points)
+  double pruneInner        = 0.25;    ///< inner pruning radius in units of R
+  double pruneOuter        = 8.0;     ///< outer pruning radius in units of R
+  double radialCutoff      = 1.0E30;  ///< shells with r > radialCutoff*R are dropped
+
+  molecularGridPartition partition = molecularGridStratmann;
+  double stratmannA        = 0.64;    ///< Stratmann cutoff parameter a (0 < a < 1)
+};
+
+/// \brief Builds a multi-center molecular integration grid.
+/// \param nAtom Number of atoms.
+/// \param atomCoord Atom positions, flattened array of size nAtom × 3 (x, y, z for each atom).
+/// \param atomRadius Radial scaling R for each atom (size nAtom), typically the Bragg-Slater radius.
+/// \param parameter Radial order, pruning and partitioning settings.
+/// \param x Output x coordinates of the grid points.
+/// \param y Output y coordinates of the grid points.
+/// \param z Output z coordinates of the grid points.
+/// \param weight Output weights including r^2 dr, the Lebedev weight and the partition weight.
+/// \param atomOffset Output offsets (size nAtom+1); the points of atom A are
+///        atomOffset[A] <= i < atomOffset[A+1].
+/// \return `true` on success; `false` if an order or grid index is not supported.
+/// \note Points with a zero partition weight are dropped.
+/// \note Stratmann weights are screened with distance-sorted neighbor lists and are exact;
+///       Becke weights have no compact support and cost O(nAtom^2) per point.
+/// \note The grid of each atom is built in parallel (OpenMP) and the result is a single
+///       structure-of-arrays stream: Integral{ f(r) } = Sum{ f(x[i],y[i],z[i])*weight[i] }.
+bool molecularGrid(const size_t nAtom,
+                   const double *atomCoord,
+                   const double *atomRadius,
+                   const molecularGridParameter& parameter,
+                   std::vector<double>& x,
+                   std::vector<double>& y,
+                   std::vector<double>& z,
+                   std::vector<double>& weight,
+                   std::vector<size_t>& atomOffset);
+
+}//end namespace quadgrid
+
+
+
+
+#endif //QUADGRID_MOLECULAR_GRID_HPP
@@ -0,0 +1,106 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+#ifndef QUADGRID_SIMPLEX_GRID_HPP
+#define QUADGRID_SIMPLEX_GRID_HPP
+
+/// \file
+/// \brief Cubature on triangles and tetrahedra (collapsed Duffy rules and symmetric rules).
+#include <vector>
+#include <cstddef>
+#include <functional>
+
+namespace quadgrid
+{
+
+/// \brief Computes the collapsed-coordinate (Duffy) rule of the reference triangle.
+/// \param N Number of points per direction, 1 <= N <= 100.
+/// \param x Output points (size 2 N^2), point p at (x[2p], x[2p+1]).
+/// \param w Output weights (size N^2, sum 1/2).
+/// \return `true` on success; `false` if N is out of range.
+/// \note The reference triangle has the vertices (0,0), (1,0), (0,1). The square is
+///       collapsed by (u, v) -> (u (1-v), v); u uses Gauss-Legendre and v Gauss-Jacobi
+///       with the weight (1-v) of the Jacobian, so the rule is exact for degree 2N-1.
+bool triangleCollapsedGrid(const size_t N, std::vector<double>& x, std::vector<double>& w);
+
+/// \brief Computes the collapsed-coordinate (Duffy) rule of the reference tetrahedron.
+/// \param N Number of points per direction, 1 <= N <= 100.
+/// \param x Output points (size 3 N^3), point p at x[3p .. 3p+2].
+/// \param w Output weights (size N^3, sum 1/6).
+/// \return `true` on success; `false` if N is out of range.
+/// \note Vertices (0,0,0), (1,0,0), (0,1,0), (0,0,1); the map is
+///       (u, v, s) -> (u (1-v)(1-s), v (1-s), s) with the Gauss-Jacobi weights (1-v) and
+///       (1-s)^2. Exact for degree 2N-1.
+bool tetrahedronCollapsedGrid(const size_t N, std::vector<double>& x, std::vector<double>& w);
+
+/// \brief Computes a tabulated fully symmetric rule of the reference triangle.
+/// \param degree Polynomial degree, 1 <= degree <= 6 (1, 3, 6, 6, 7 and 12 points;
+///        degree 3 uses the degree-4 rule).
+/// \param x Output points (size 2 nPoint).
+/// \param w Output weights (sum 1/2, all positive, all points interior).
+/// \return `true` on success; `false` if the degree is not tabulated.
+bool triangleSymmetricGrid(const size_t degree, std::vector<double>& x, std::vector<double>& w);
+
+/// \brief Computes a tabulated fully symmetric rule of the reference tetrahedron.
+/// \param degree Polynomial degree, 1 <= degree <= 5 (1, 4, 8, 14 and 14 points;
+///        degree 4 uses the degree-5 rule).
+/// \param x Output points (size 3 nPoint).
+/// \param w Output weights (sum 1/6, all positive, all points interior).
+/// \return `true` on success; `false` if the degree is not tabulated.
+bool tetrahedronSymmetricGrid(const size_t degree, std::vector<double>& x, std::vector<double>& w);
+
+/// \brief Computes the smallest in-tree rule of the reference simplex exact for a degree.
+/// \param dimension 2 (triangle) or 3 (tetrahedron).
+/// \param degree Polynomial degree, at most 199.
+/// \param x Output points (size dimension*nPoint).
+/// \param w Output weights.
+/// \return `true` on success; `false` if the dimension or degree is out of range.
+/// \note The symmetric rules are used up to their degree, the collapsed rules with
+///       N = degree/2 + 1 above it. The rule is computed on every call; simplexIntegrateBatch
+///       caches it per (dimension, degree).
+bool simplexGrid(const size_t dimension, const size_t degree, std::vector<double>& x,
+  std::vector<double>& w);
+
+/// \brief Maps a reference rule onto many simplices at once.
+/// \param dimension 2 (triangle) or 3 (tetrahedron).
+/// \param xRef Reference points (size dimension*nPoint), see simplexGrid.
+/// \param wRef Reference weights (size nPoint).
+/// \param vertex Vertices of the simplices, vertex[(s*(dimension+1) + k)*dimension + i] is
+///        coordinate i of vertex k of simplex s.
+/// \param nSimplex Number of simplices.
+/// \param x Output points (size nSimplex*nPoint*dimension), simplex by simplex.
+/// \param w Output weights (size nSimplex*nPoint), scaled by |det J| of each simplex.
+/// \return `true` on success; `false` if the dimension or the reference rule is invalid.
+bool simplexMapBatch(const size_t dimension, const std::vector<double>& xRef,
+  const std::vector<double>& wRef, const double *vertex, const size_t nSimplex,
+  std::vector<double>& x, std::vector<double>& w);
+
+/// \brief Integrates f over each of many simplices.
+/// \param f Integrand f(x) with x[dimension]; it is called concurrently from several threads.
+/// \param dimension 2 (triangle) or 3 (tetrahedron).
+/// \param degree Polynomial degree of the rule (see simplexGrid).
+/// \param vertex Vertices of the simplices (layout of simplexMapBatch).
+/// \param nSimplex Number of simplices.
+/// \param integral Output integral of each simplex (size nSimplex).
+/// \return `true` on success; `false` if the dimension or degree is out of range.
+/// \note The reference rule is mapped on the fly (no per-simplex grids) and the simplices
+///       are processed in OpenMP chunks.
+bool simplexIntegrateBatch(const std::function<double(const double*)>& f,
+  const size_t dimension, const size_t degree, const double *vertex, const size_t nSimplex,
+  std::vector<double>& integral);
+
+}//end namespace quadgrid
+
+
+
+
+#endif //QUADGRID_SIMPLEX_GRID_HPP
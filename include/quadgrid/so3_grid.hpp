@@ -0,0 +1,85 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+#ifndef QUADGRID_SO3_GRID_HPP
+#define QUADGRID_SO3_GRID_HPP
+
+/// \file
+/// \brief Quadrature on the rotation group SO(3) for orientation averaging and SO(3) Fourier transforms.
+#include <vector>
+#include <complex>
+#include <cstddef>
+
+namespace quadgrid
+{
+
+/// \brief Construction of the SO(3) quadrature.
+enum so3GridType
+{
+  so3GridEuler,    ///< uniform alpha x Gauss-Legendre in cos(beta) x uniform gamma
+  so3GridLebedev   ///< Lebedev directions (beta, alpha) x uniform gamma
+};
+
+/// \brief Generates a quadrature for averages over rotations R(alpha, beta, gamma) = R_z(alpha) R_y(beta) R_z(gamma).
+/// \param bandLimit Requested band limit L: every Wigner function D^l_(m n) with l <= L is averaged exactly.
+/// \param type Construction of the grid.
+/// \param bandLimitExact Output band limit of the returned grid (>= bandLimit), the smallest exact
+///        degree of its alpha, beta and gamma rules. Products f g are exact when the band limits
+///        of f and g add up to at most bandLimitExact.
+/// \param euler Output Euler angles, euler[3*i] = alpha, euler[3*i+1] = beta, euler[3*i+2] = gamma.
+/// \param weight Output weights of the normalized Haar measure (sum 1, i.e. Integral{ dR }/(8 Pi^2)).
+/// \return `true` on success; `false` if bandLimit is too large for the type.
+/// \note so3GridEuler: L+1 angles alpha and gamma and the Gauss-Legendre rule of degree >= L in
+///       cos(beta), (L+1)^2 (L/2+1) points, bandLimit <= 1998. so3GridLebedev: the smallest
+///       Lebedev grid of degree >= L and L+1 angles gamma, bandLimit <= 131, or the so3GridEuler
+///       grid if that has fewer points. The Lebedev product is smaller for 8 <= L <= 53 except
+///       L = 12, 13, 18, 30 .. 33 and for L >= 107, with about 2/3 of the points at L = 131.
+bool so3Grid(const size_t bandLimit, const so3GridType type, size_t& bandLimitExact,
+  std::vector<double>& euler, std::vector<double>& weight);
+
+/// \brief Returns the sample grid of the SO(3) Fourier transform with band limit B.
+/// \param B Band limit (<= 99).
+/// \param alpha Output angles alpha_a = 2 Pi a/(2B+1), a = 0 .. 2B.
+/// \param beta Output angles beta_j = acos(x_j) of the B+1 point Gauss-Legendre nodes x_j.
+/// \param gamma Output angles gamma_g = 2 Pi g/(2B+1), g = 0 .. 2B.
+/// \return `true` on success; `false` if B is out of range.
+/// \note Samples are stored as f[(j*(2B+1) + a)*(2B+1) + g] = f(alpha_a, beta_j, gamma_g).
+bool so3FourierGrid(const size_t B, std::vector<double>& alpha, std::vector<double>& beta,
+  std::vector<double>& gamma);
+
+/// \brief Computes the Wigner coefficients of a band-limited function on SO(3).
+/// \param B Band limit (<= 99).
+/// \param f Samples on the grid of so3FourierGrid (size (B+1)(2B+1)^2).
+/// \param c Output coefficients c[wignerArrayIndex(l, m, n)] (size wignerArraySize(B)) of
+///        f(R) = Sum{ c(l,m,n) D^l_(m n)(R) }, D^l_(m n) = e^(-i m alpha) d^l_(m n)(beta) e^(-i n gamma).
+/// \return `true` on success; `false` if B is out of range or f has the wrong size.
+/// \note c(l,m,n) = (2l+1) Integral{ f conj(D^l_(m n)) dR }/(8 Pi^2), exact for band limit B:
+///       a 2D FFT over (alpha, gamma) on each beta, then Wigner-d sums over the Gauss-Legendre
+///       nodes with the d-matrices of one beta at a time, O(B^4) flops and O(B^3) memory.
+///       The beta nodes are distributed over threads.
+bool so3FourierForward(const size_t B, const std::vector< std::complex<double> >& f,
+  std::vector< std::complex<double> >& c);
+
+/// \brief Evaluates a band-limited function on SO(3) on the grid of so3FourierGrid.
+/// \param B Band limit (<= 99).
+/// \param c Coefficients c[wignerArrayIndex(l, m, n)] (size wignerArraySize(B)).
+/// \param f Output samples (size (B+1)(2B+1)^2).
+/// \return `true` on success; `false` if B is out of range or c has the wrong size.
+bool so3FourierInverse(const size_t B, const std::vector< std::complex<double> >& c,
+  std::vector< std::complex<double> >& f);
+
+}//end namespace quadgrid
+
+
+
+
+#endif //QUADGRID_SO3_GRID_HPP
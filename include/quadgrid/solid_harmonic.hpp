@@ -0,0 +1,159 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+#ifndef QUADGRID_SOLID_HARMONIC_HPP
+#define QUADGRID_SOLID_HARMONIC_HPP
+
+/// \file
+/// \brief Regular and irregular solid harmonics and fast multipole translation operators.
+#include <vector>
+#include <complex>
+#include <cstddef>
+
+namespace quadgrid
+{
+
+/// \brief Normalization of the solid harmonics.
+enum solidHarmonicNormalization
+{
+  solidHarmonicUnit,   ///< R(l,m) = r^l Y(l,m), I(l,m) = r^-(l+1) Y(l,m)
+  solidHarmonicRacah   ///< R(l,m) = c r^l Y(l,m)/s, I(l,m) = c s r^-(l+1) Y(l,m),
+                       ///< c = sqrt(4 Pi/(2l+1)), s = sqrt((l+m)! (l-m)!)
+};
+
+/// \brief Largest expansion order of the multipole operators (and of solidHarmonicRacah).
+const size_t multipoleMaxOrder = 60;
+
+/// \brief Computes the regular solid harmonics R(l,m) up to degree lmax at a point.
+/// \param R Output values in the layout of sphereHarmonicArrayIndex (size sphereHarmonicArraySize(lmax)).
+/// \param lmax Maximum degree (<= multipoleMaxOrder for solidHarmonicRacah).
+/// \param r Cartesian point [x, y, z].
+/// \param normalization Normalization of R.
+/// \return `true` on success; `false` if lmax is out of range.
+/// \note Built on sphereHarmonic; negative m follow from R(l,-m) = (-1)^m conj(R(l,m)).
+bool solidHarmonicRegular(std::vector< std::complex<double> >& R, const size_t lmax,
+  const double r[3], const solidHarmonicNormalization normalization);
+
+/// \brief Computes the irregular solid harmonics I(l,m) up to degree lmax at a point.
+/// \param I Output values in the layout of sphereHarmonicArrayIndex (size sphereHarmonicArraySize(lmax)).
+/// \param lmax Maximum degree (<= multipoleMaxOrder for solidHarmonicRacah).
+/// \param r Cartesian point [x, y, z], r != 0.
+/// \param normalization Normalization of I.
+/// \return `true` on success; `false` if lmax is out of range or r = 0.
+/// \note With solidHarmonicRacah, 1/|r - r'| = Sum{ conj(R(l,m)(r')) I(l,m)(r) } over
+///       l >= 0, -l <= m <= l for |r'| < |r|.
+bool solidHarmonicIrregular(std::vector< std::complex<double> >& I, const size_t lmax,
+  const double r[3], const solidHarmonicNormalization normalization);
+
+/// \brief Adds the multipole expansion of point charges (P2M).
+/// \param p Expansion order (<= multipoleMaxOrder).
+/// \param center Expansion center [x, y, z].
+/// \param nParticle Number of particles.
+/// \param position Particle positions, position[3*i + k] (size 3*nParticle).
+/// \param charge Particle charges (size nParticle).
+/// \param M Multipole expansion, M(l,m) += Sum{ q_i conj(R(l,m)(r_i - center)) } with Racah
+///        normalization, layout of sphereHarmonicArrayIndex; resized with zeros if empty.
+/// \return `true` on success; `false` if p is out of range or M has the wrong size.
+/// \note The potential Sum{ q_i/|r - r_i| } is Sum{ M(l,m) I(l,m)(r - center) } outside
+///       the sphere containing the particles. Only m >= 0 is stored (real charges). The solid
+///       harmonics of blocks of 8 particles are computed together by the Cartesian
+///       recurrences, so the innermost loops run over the particles and are vectorized.
+bool multipoleP2M(const size_t p, const double center[3], const size_t nParticle,
+  const double *position, const double *charge, std::vector< std::complex<double> >& M);
+
+/// \brief Adds the local expansion of point charges (P2L).
+/// \param p Expansion order (<= multipoleMaxOrder).
+/// \param center Expansion center [x, y, z].
+/// \param nParticle Number of particles.
+/// \param position Particle positions, position[3*i + k] (size 3*nParticle).
+/// \param charge Particle charges (size nParticle).
+/// \param L Local expansion, L(l,m) += Sum{ q_i conj(I(l,m)(r_i - center)) }; resized with
+///        zeros if empty.
+/// \return `true` on success; `false` if p is out of range, L has the wrong size or a particle
+///         is at the center.
+/// \note The potential is Sum{ L(l,m) R(l,m)(r - center) } inside the sphere free of particles.
+bool multipoleP2L(const size_t p, const double center[3], const size_t nParticle,
+  const double *position, const double *charge, std::vector< std::complex<double> >& L);
+
+/// \brief Translates a multipole expansion to a new center (M2M) and adds it.
+/// \param p Expansion order (<= multipoleMaxOrder).
+/// \param centerFrom Center of M.
+/// \param M Multipole expansion about centerFrom.
+/// \param centerTo New center.
+/// \param Mto Multipole expansion about centerTo, incremented; resized with zeros if empty.
+/// \return `true` on success; `false` if p is out of range or the sizes are wrong.
+/// \note Exact for the order p moments. The expansion is rotated so that the translation
+///       is along z, translated along z and rotated back, O(p^3) instead of O(p^4).
+bool multipoleM2M(const size_t p, const double centerFrom[3],
+  const std::vector< std::complex<double> >& M, const double centerTo[3],
+  std::vector< std::complex<double> >& Mto);
+
+/// \brief Converts a multipole expansion to a local expansion about a distant center (M2L).
+/// \param p Expansion order (<= multipoleMaxOrder).
+/// \param centerFrom Center of M.
+/// \param M Multipole expansion about centerFrom.
+/// \param centerTo Center of the local expansion (centerTo != centerFrom).
+/// \param L Local expansion about centerTo, incremented; resized with zeros if empty.
+/// \return `true` on success; `false` if p is out of range, the sizes are wrong or the centers coincide.
+/// \note Rotate, translate along z and rotate back, O(p^3).
+bool multipoleM2L(const size_t p, const double centerFrom[3],
+  const std::vector< std::complex<double> >& M, const double centerTo[3],
+  std::vector< std::complex<double> >& L);
+
+/// \brief Translates a local expansion to a new center (L2L) and adds it.
+/// \param p Expansion order (<= multipoleMaxOrder).
+/// \param centerFrom Center of L.
+/// \param L Local expansion about centerFrom.
+/// \param centerTo New center.
+/// \param Lto Local expansion about centerTo, incremented; resized with zeros if empty.
+/// \return `true` on success; `false` if p is out of range or the sizes are wrong.
+/// \note Exact (the order p local expansion is a polynomial of degree p). O(p^3).
+bool multipoleL2L(const size_t p, const double centerFrom[3],
+  const std::vector< std::complex<double> >& L, const double centerTo[3],
+  std::vector< std::complex<double> >& Lto);
+
+/// \brief Evaluates a local expansion at particles (L2P).
+/// \param p Expansion order (<= multipoleMaxOrder).
+/// \param center Expansion center.
+/// \param L Local expansion about center.
+/// \param nParticle Number of particles.
+/// \param position Particle positions, position[3*i + k] (size 3*nParticle).
+/// \param potential Potentials, potential[i] += phi(r_i) (size nParticle).
+/// \param gradient Gradients, gradient[3*i + k] += d phi/d x_k (size 3*nParticle), or
+///        nullptr to skip them.
+/// \return `true` on success; `false` if p is out of range or L has the wrong size.
+/// \note Particles are processed in vectorized blocks of 8 as in multipoleP2M and the blocks
+///       are distributed over threads.
+bool multipoleL2P(const size_t p, const double center[3],
+  const std::vector< std::complex<double> >& L, const size_t nParticle,
+  const double *position, double *potential, double *gradient);
+
+/// \brief Evaluates a multipole expansion at particles (M2P).
+/// \param p Expansion order (<= multipoleMaxOrder).
+/// \param center Expansion center.
+/// \param M Multipole expansion about center.
+/// \param nParticle Number of particles (none at the center).
+/// \param position Particle positions, position[3*i + k] (size 3*nParticle).
+/// \param potential Potentials, potential[i] += phi(r_i) (size nParticle).
+/// \param gradient Gradients, gradient[3*i + k] += d phi/d x_k (size 3*nParticle), or nullptr.
+/// \return `true` on success; `false` if p is out of range, M has the wrong size or a
+///         particle is at the center.
+bool multipoleM2P(const size_t p, const double center[3],
+  const std::vector< std::complex<double> >& M, const size_t nParticle,
+  const double *position, double *potential, double *gradient);
+
+}//end namespace quadgrid
+
+
+
+
+#endif //QUADGRID_SOLID_HARMONIC_HPP
@@ -0,0 +1,95 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+#ifndef QUADGRID_SPARSE_GRID_HPP
+#define QUADGRID_SPARSE_GRID_HPP
+
+/// \file
+/// \brief Smolyak sparse-grid cubature (isotropic, anisotropic and dimension-adaptive).
+#include <vector>
+#include <cstddef>
+#include <functional>
+
+namespace quadgrid
+{
+
+/// \brief 1D rule family of the sparse grid; level m >= 1 uses n(m) points.
+enum sparseGridRule
+{
+  sparseGridGaussLegendre,   ///< n = 2m-1 (m <= 50), exact for degree 4m-3, only the center is shared
+  sparseGridClenshawCurtis,  ///< n = 1, 3, 5, 9, .. 2^(m-1)+1 (m <= 11), nested
+  sparseGridFejer2           ///< n = 2^m-1 (m <= 10), nested
+};
+
+/// \brief Builds the index set { l >= 1 : Sum{ anisotropy[i] (l[i]-1) } <= level }.
+/// \param d Number of dimensions.
+/// \param level Level L >= 0 of the set (L = 0 is the one-point rule).
+/// \param anisotropy Weights of the dimensions (size d, all > 0) or empty for the isotropic set;
+///        a larger weight gives a dimension fewer levels.
+/// \param indexSet Output multi-indices (each of size d, levels from 1), downward closed.
+/// \return `true` on success; `false` if d = 0 or the anisotropy is invalid.
+bool sparseGridIndexSet(const size_t d, const double level, const std::vector<double>& anisotropy,
+  std::vector< std::vector<size_t> >& indexSet);
+
+/// \brief Streams the points and merged weights of a sparse grid in blocks.
+/// \param d Number of dimensions.
+/// \param indexSet Downward-closed set of multi-indices (e.g. from sparseGridIndexSet).
+/// \param rule 1D rule family.
+/// \param lower Lower corner of the box (size d).
+/// \param upper Upper corner of the box (size d).
+/// \param blockSize Maximum number of points per block.
+/// \param block Called with x[nPoint*d] (point p at x[p*d .. p*d+d-1]), w[nPoint] and nPoint.
+/// \return `true` on success; `false` if the input is invalid or a level exceeds the family.
+/// \note Every distinct point is streamed exactly once: the points are enumerated by the
+///       level at which each coordinate first appears, and the weight of a point is the sum
+///       of its tensor-difference weights over the index set. Nothing but one block is
+///       materialized; the weights of a block are computed in parallel (OpenMP).
+bool sparseGridStream(const size_t d, const std::vector< std::vector<size_t> >& indexSet,
+  const sparseGridRule rule, const std::vector<double>& lower, const std::vector<double>& upper,
+  const size_t blockSize,
+  const std::function<void(const double*, const double*, const size_t)>& block);
+
+/// \brief Materializes a sparse grid (see sparseGridIndexSet and sparseGridStream).
+/// \param x Output points, x[p*d + i].
+/// \param w Output weights.
+/// \note For the isotropic level L the number of points grows like n(L) (log n(L))^(d-1)
+///       instead of n(L)^d for the tensor product; Gauss-Legendre level L integrates
+///       polynomials of total degree 2L+1 exactly.
+bool sparseGrid(const size_t d, const double level, const std::vector<double>& anisotropy,
+  const sparseGridRule rule, const std::vector<double>& lower, const std::vector<double>& upper,
+  std::vector<double>& x, std::vector<double>& w);
+
+/// \brief Dimension-adaptive sparse-grid integration (Gerstner and Griebel 2003).
+/// \param f Integrand f(x) with x[d]; it is called concurrently from several threads.
+/// \param d Number of dimensions.
+/// \param rule 1D rule family.
+/// \param lower Lower corner of the box (size d).
+/// \param upper Upper corner of the box (size d).
+/// \param absTol Absolute tolerance on the sum of |surplus| of the active indices.
+/// \param maxEvaluation Maximum number of evaluations of f.
+/// \param integral Output integral.
+/// \param error Output error estimate.
+/// \param indexSet Output downward-closed index set that was used.
+/// \return `true` if error <= absTol; `false` otherwise.
+/// \note The index with the largest surplus |Delta_l f| is refined first; every point is
+///       evaluated once (values are cached across the tensor differences).
+bool sparseGridIntegrateAdaptive(const std::function<double(const double*)>& f, const size_t d,
+  const sparseGridRule rule, const std::vector<double>& lower, const std::vector<double>& upper,
+  const double absTol, const size_t maxEvaluation, double& integral, double& error,
+  std::vector< std::vector<size_t> >& indexSet);
+
+}//end namespace quadgrid
+
+
+
+
+#endif //QUADGRID_SPARSE_GRID_HPP
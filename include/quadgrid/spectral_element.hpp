@@ -0,0 +1,98 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+#ifndef QUADGRID_SPECTRAL_ELEMENT_HPP
+#define QUADGRID_SPECTRAL_ELEMENT_HPP
+
+/// \file
+/// \brief Spectral-element operators on Gauss-Legendre and Gauss-Lobatto-Legendre nodes with
+///        sum-factorized tensor-product kernels for quadrilaterals and hexahedra.
+#include <vector>
+#include <cstddef>
+
+namespace quadgrid
+{
+
+/// \brief Nodal points of the spectral element.
+enum spectralElementNodes
+{
+  spectralElementGaussLegendre,  ///< N Gauss-Legendre points (interior), exact mass matrix
+  spectralElementGaussLobatto    ///< N Gauss-Lobatto-Legendre points (with the endpoints), collocated mass
+};
+
+/// \brief Returns the 1D operators of the reference element [-1, 1].
+/// \param N Number of nodes: 1 <= N <= 100 (Gauss-Legendre), 2 <= N <= 100 (Gauss-Lobatto).
+/// \param nodes Nodal points.
+/// \param x Output nodes (size N, ascending).
+/// \param w Output quadrature weights = diagonal mass matrix (size N).
+/// \param D Output differentiation matrix, row-major (size N*N).
+/// \param K Output stiffness matrix K = D^T diag(w) D, row-major (size N*N).
+/// \return `true` on success; `false` if N is out of range.
+/// \note The Gauss-Lobatto nodes are the zeros of P'_(N-1) (Newton on legendrePoly from the
+///       Chebyshev-Lobatto points) and +-1, with w = 2/(N (N-1) P_(N-1)^2); D uses the
+///       barycentric formula. The operators are computed once per (N, nodes) and cached.
+bool spectralElementOperator(const size_t N, const spectralElementNodes nodes,
+  std::vector<double>& x, std::vector<double>& w, std::vector<double>& D,
+  std::vector<double>& K);
+
+/// \brief Applies a tensor product of 1D matrices to the nodal vectors of many elements.
+/// \param dimension 1, 2 (quadrilaterals) or 3 (hexahedra).
+/// \param N Number of nodes per direction.
+/// \param A 1D matrices, A[d] (row-major N*N) acts on direction d (size dimension).
+/// \param nElement Number of elements.
+/// \param u Input nodal values, u[e*N^dimension + i0 + N*(i1 + N*i2)] (direction 0 fastest).
+/// \param v Output v_e = (A[2] x A[1] x A[0]) u_e, same layout as u.
+/// \return `true` on success; `false` if the dimension or the matrix sizes are invalid.
+/// \note Sum factorization: one 1D contraction per direction, O(N^(dimension+1)) per element
+///       instead of O(N^(2 dimension)). Elements are processed in blocks of 8 transposed to
+///       node-major order, so the innermost loop runs over the elements of a block and is
+///       vectorized; the kernels are compiled for N = 2 .. 16 with fixed trip counts (other
+///       N use the same kernel with a runtime N). Blocks are distributed over threads.
+bool spectralElementTensorApply(const size_t dimension, const size_t N,
+  const std::vector< std::vector<double> >& A, const size_t nElement, const double *u,
+  double *v);
+
+/// \brief Applies the stiffness (Laplace) operator of axis-aligned box elements.
+/// \param dimension 1, 2 or 3.
+/// \param N Number of nodes per direction (see spectralElementOperator).
+/// \param nodes Nodal points.
+/// \param nElement Number of elements.
+/// \param h Element sizes, h[e*dimension + d] = length of element e in direction d.
+/// \param u Input nodal values (layout of spectralElementTensorApply).
+/// \param v Output v_e = Sum{ (2/h_d) Prod{ h_d'/2 } K_d x M_d' } u_e over the directions d,
+///        i.e. the element matrix of Integral{ grad u . grad phi } applied to u_e.
+/// \return `true` on success; `false` if the input is invalid.
+/// \note The mass matrix is diagonal, so each term is one sum-factorized contraction with
+///       K along d and a pointwise scaling by the weights of the other directions.
+bool spectralElementStiffnessApply(const size_t dimension, const size_t N,
+  const spectralElementNodes nodes, const size_t nElement, const double *h, const double *u,
+  double *v);
+
+/// \brief Applies the (diagonal) mass matrix of axis-aligned box elements.
+/// \param dimension 1, 2 or 3.
+/// \param N Number of nodes per direction.
+/// \param nodes Nodal points.
+/// \param nElement Number of elements.
+/// \param h Element sizes, h[e*dimension + d].
+/// \param u Input nodal values (layout of spectralElementTensorApply).
+/// \param v Output v_e = Prod{ h_d/2 } (W x W x W) u_e.
+/// \return `true` on success; `false` if the input is invalid.
+bool spectralElementMassApply(const size_t dimension, const size_t N,
+  const spectralElementNodes nodes, const size_t nElement, const double *h, const double *u,
+  double *v);
+
+}//end namespace quadgrid
+
+
+
+
+#endif //QUADGRID_SPECTRAL_ELEMENT_HPP
@@ -0,0 +1,187 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+#ifndef QUADGRID_SPHERE_TRANSFORM_HPP
+#define QUADGRID_SPHERE_TRANSFORM_HPP
+
+/// \file
+/// \brief Spherical harmonic transforms of real functions on unitSphereGaussLegendre grids.
+#include <vector>
+#include <complex>
+#include <cstddef>
+#include <string>
+
+namespace quadgrid
+{
+
+/// \brief Sets the threshold below which the Legendre tables near the poles are skipped by the transforms.
+/// \param threshold Nonnegative threshold on |P(l,m)|, 1e-20 by default, 0 keeps every term.
+/// \return `true` on success; `false` if threshold is negative or not finite.
+/// \note On a ring at theta, P(l,m) decays like sin(theta)^m for l below m / sin(theta). The
+///       transforms start the sum over l of each order m at the first degree at which the table
+///       exceeds the threshold, which saves about 20% of the transform time at lmax = 1000.
+///       Changing the threshold releases the cached plans and Legendre tables.
+bool sphereTransformSetPolarThreshold(const double threshold);
+
+/// \brief Returns the threshold of sphereTransformSetPolarThreshold.
+double sphereTransformPolarThreshold();
+
+/// \brief Returns the first degree per ring and order that the transforms evaluate.
+/// \param s Spin weight, 0 for sphereTransformInverse and sphereTransformForward, 1 or 2 for the
+///        spin transforms.
+/// \param lmax Band limit.
+/// \param gridLmax Grid parameter of unitSphereGaussLegendre (>= lmax), N rings.
+/// \param lstart Output first degree l >= max(m, s) with |P(l,m)| (|lambda| of both spins for s > 0)
+///        above sphereTransformPolarThreshold at lstart[i*(lmax+1) + m], lmax + 1 if there is
+///        none (size N*(lmax+1)).
+/// \return `true` on success; `false` if s or the grid is not supported.
+/// \note The degrees and the starting values of the recurrence are computed once per lmax and
+///       gridLmax and cached until the threshold changes.
+bool sphereTransformRingStart(const int s, const size_t lmax, const size_t gridLmax,
+  std::vector<size_t>& lstart);
+
+/// \brief Store or recompute decision of the Legendre tables for a block of orders.
+struct sphereTransformLegendreBlock
+{
+  size_t mBegin;   ///< first order of the block
+  size_t mEnd;     ///< one past the last order of the block
+  size_t bytes;    ///< size of the tables of the block
+  bool stored;     ///< `true` if the tables are stored, `false` if each call recomputes them
+  bool mapped;     ///< `true` if the stored tables live in a memory-mapped file
+};
+
+/// \brief Sets the memory budget for storing the Legendre tables of sphereTransformInverse and sphereTransformForward.
+/// \param bytes Budget for the tables of all lmax and gridLmax together, 0 by default (every call
+///        recomputes the tables).
+/// \param directory Directory of a memory-mapped file that holds the stored tables, empty for the heap.
+/// \return `true` on success; `false` if directory is not empty on a platform without mmap.
+/// \note The tables of P(l,m) on all ring pairs take O(lmax^3) memory, about 16 GB at lmax = 2000.
+///       They are stored in blocks of 16 orders, each one if it still fits into the budget, and
+///       recomputed by the recurrence otherwise; both go through the same Legendre kernels. The
+///       mapped file is created with mkstemp and unlinked at once, so the page cache backs tables
+///       larger than the free memory. The tables of each lmax and gridLmax are built once and get
+///       what the tables built before them left of the budget. If the file cannot be created
+///       or mapped, every block of that table is recomputed. Setting a budget releases the
+///       stored tables.
+bool sphereTransformSetLegendreBudget(const size_t bytes, const std::string& directory);
+
+/// \brief Reports the decisions of sphereTransformSetLegendreBudget.
+/// \param lmax Band limit.
+/// \param gridLmax Grid parameter of unitSphereGaussLegendre (>= lmax).
+/// \param block Output decisions for the orders 0 .. lmax in blocks of 16 (size (lmax+16)/16).
+/// \return `true` on success; `false` if the grid is not supported.
+/// \note Builds the tables of the current budget if the transforms have not done so yet.
+bool sphereTransformLegendreTables(const size_t lmax, const size_t gridLmax,
+  std::vector<sphereTransformLegendreBlock>& block);
+
+/// \brief Evaluates real functions Sum{ c(l,m) Y(l,m) } on the grid of unitSphereGaussLegendre(gridLmax).
+/// \param lmax Band limit of the coefficients.
+/// \param gridLmax Grid parameter of unitSphereGaussLegendre (>= lmax), N rings and 2N angles phi.
+/// \param c Coefficients in the layout of sphereHarmonicArrayIndex, c[v*sphereHarmonicArraySize(lmax) + k]
+///        (size nVector*sphereHarmonicArraySize(lmax)). Negative m follow from
+///        c(l,-m) = (-1)^m conj(c(l,m)) and c(l,0) is real.
+/// \param nVector Number of functions transformed at once.
+/// \param f Output values f[v*2N*N + i*2N + j] at (theta[i], phi[j]) (size nVector*2N*N).
+/// \return `true` on success; `false` if the grid is not supported or the sizes are inconsistent.
+/// \note One associated Legendre column per order and ring pair (theta, pi - theta) from the
+///       recurrence of sphereHarmonic, started at the degrees of sphereTransformRingStart, or from
+///       the tables of sphereTransformSetLegendreBudget, and one FFT per ring and function, O(lmax^2 N) flops. The sums over l are split into even and odd
+///       l + m, which give both rings of a pair by P(l,m)(pi - theta) = (-1)^(l+m) P(l,m)(theta).
+///       Batches of up to 32 functions share each column: the sums are products of the columns of
+///       two ring pairs with the coefficients of 4 functions held in registers, so many functions
+///       at once run several times faster than one at a time. The orders are distributed over
+///       threads in the Legendre stage and the ring pairs in the FFT stage.
+bool sphereTransformInverse(const size_t lmax, const size_t gridLmax,
+  const std::vector< std::complex<double> >& c, const size_t nVector, std::vector<double>& f);
+
+/// \brief Computes the spherical harmonic coefficients of real functions on the grid of unitSphereGaussLegendre(gridLmax).
+/// \param lmax Band limit of the output coefficients.
+/// \param gridLmax Grid parameter of unitSphereGaussLegendre (>= lmax).
+/// \param f Values f[v*2N*N + i*2N + j] at (theta[i], phi[j]) (size nVector*2N*N).
+/// \param nVector Number of functions transformed at once.
+/// \param c Output coefficients c(l,m) = Sum{ w_theta[i] f conj(Y(l,m)) } for l >= m >= 0
+///        (size nVector*sphereHarmonicArraySize(lmax)).
+/// \return `true` on success; `false` if the grid is not supported or the sizes are inconsistent.
+/// \note The projection is exact for band-limited f of degree <= gridLmax - lmax, so
+///       gridLmax >= 2 lmax makes it the inverse of sphereTransformInverse. Batches of functions
+///       share the Legendre columns as in sphereTransformInverse.
+bool sphereTransformForward(const size_t lmax, const size_t gridLmax, const std::vector<double>& f,
+  const size_t nVector, std::vector< std::complex<double> >& c);
+
+/// \brief Evaluates spin-weighted functions on the grid of unitSphereGaussLegendre(gridLmax).
+/// \param s Spin weight, 1 or 2.
+/// \param lmax Band limit of the coefficients.
+/// \param gridLmax Grid parameter of unitSphereGaussLegendre with 2N > 2 lmax (gridLmax >= 2 lmax).
+/// \param E Gradient (electric) coefficients of real functions in the layout of sphereHarmonicArrayIndex
+///        (size nVector*sphereHarmonicArraySize(lmax)), ignored for l < s.
+/// \param B Curl (magnetic) coefficients in the same layout.
+/// \param nVector Number of functions transformed at once.
+/// \param f Output values f = Q + iU = -Sum{ (E(l,m) + i B(l,m)) sY(l,m) }, summed over -l <= m <= l,
+///        at f[v*2N*N + i*2N + j] (size nVector*2N*N).
+/// \return `true` on success; `false` if s, the grid or the sizes are not supported.
+/// \note conj(f) = -(-1)^s Sum{ (E - iB) (-s)Y }. Both spins come from one pass over the tables of
+///       sphereHarmonicSpinLegendre on each ring pair, with lambda_s(pi - theta) =
+///       (-1)^(l+m) lambda_-s(theta), and one FFT per ring and function. For s = 2,
+///       (Q, U) are the Stokes parameters of a polarization field.
+bool sphereTransformSpinInverse(const int s, const size_t lmax, const size_t gridLmax,
+  const std::vector< std::complex<double> >& E, const std::vector< std::complex<double> >& B,
+  const size_t nVector, std::vector< std::complex<double> >& f);
+
+/// \brief Computes the gradient and curl coefficients of spin-weighted functions on the grid of unitSphereGaussLegendre(gridLmax).
+/// \param s Spin weight, 1 or 2.
+/// \param lmax Band limit of the output coefficients.
+/// \param gridLmax Grid parameter of unitSphereGaussLegendre (gridLmax >= 2 lmax).
+/// \param f Values Q + iU at f[v*2N*N + i*2N + j] (size nVector*2N*N).
+/// \param nVector Number of functions transformed at once.
+/// \param E Output gradient coefficients (size nVector*sphereHarmonicArraySize(lmax)), zero for l < s.
+/// \param B Output curl coefficients in the same layout.
+/// \return `true` on success; `false` if s, the grid or the sizes are not supported.
+/// \note Projections onto sY and (-s)Y in one pass, exact for band-limited f with gridLmax >= 2 lmax.
+bool sphereTransformSpinForward(const int s, const size_t lmax, const size_t gridLmax,
+  const std::vector< std::complex<double> >& f, const size_t nVector,
+  std::vector< std::complex<double> >& E, std::vector< std::complex<double> >& B);
+
+/// \brief Evaluates tangent vector fields Sum{ gradient(l,m) Psi(l,m) + curl(l,m) Phi(l,m) } on the grid of unitSphereGaussLegendre(gridLmax).
+/// \param lmax Band limit of the coefficients.
+/// \param gridLmax Grid parameter of unitSphereGaussLegendre (gridLmax >= 2 lmax).
+/// \param gradient Coefficients of the vector harmonics Psi(l,m) of sphereHarmonicVector in the layout
+///        of sphereHarmonicArrayIndex (size nVector*sphereHarmonicArraySize(lmax)).
+/// \param curl Coefficients of Phi(l,m) = rUnit x Psi(l,m) in the same layout.
+/// \param nVector Number of fields transformed at once.
+/// \param vTheta Output theta components at [v*2N*N + i*2N + j] (size nVector*2N*N).
+/// \param vPhi Output phi components in the same layout.
+/// \return `true` on success; `false` if the grid or the sizes are not supported.
+/// \note vTheta + i vPhi is the spin 1 field of sphereTransformSpinInverse with E = gradient and
+///       B = curl. The gradient of Sum{ c Y } has gradient(l,m) = sqrt(l(l+1)) c(l,m), curl = 0.
+bool sphereTransformVectorInverse(const size_t lmax, const size_t gridLmax,
+  const std::vector< std::complex<double> >& gradient, const std::vector< std::complex<double> >& curl,
+  const size_t nVector, std::vector<double>& vTheta, std::vector<double>& vPhi);
+
+/// \brief Computes the gradient and curl coefficients of tangent vector fields on the grid of unitSphereGaussLegendre(gridLmax).
+/// \param lmax Band limit of the output coefficients.
+/// \param gridLmax Grid parameter of unitSphereGaussLegendre (gridLmax >= 2 lmax).
+/// \param vTheta Theta components at [v*2N*N + i*2N + j] (size nVector*2N*N).
+/// \param vPhi Phi components in the same layout.
+/// \param nVector Number of fields transformed at once.
+/// \param gradient Output coefficients of Psi(l,m) (size nVector*sphereHarmonicArraySize(lmax)).
+/// \param curl Output coefficients of Phi(l,m) in the same layout.
+/// \return `true` on success; `false` if the grid or the sizes are not supported.
+bool sphereTransformVectorForward(const size_t lmax, const size_t gridLmax,
+  const std::vector<double>& vTheta, const std::vector<double>& vPhi, const size_t nVector,
+  std::vector< std::complex<double> >& gradient, std::vector< std::complex<double> >& curl);
+
+}//end namespace quadgrid
+
+
+
+
+#endif //QUADGRID_SPHERE_TRANSFORM_HPP
@@ -65,6 +65,83 @@ void sphereHarmonic(std::vector<std::complex<double>>& Ylm,
                     const double theta,
                     const double phi);
 
+/// \brief Computes Y(l,m) and their gradients for many directions in one recursion sweep.
+/// \param Ylm Output values Ylm[k*nPoint + p] at k = sphereHarmonicArrayIndex(l,m) (size = nPoint*sphereHarmonicArraySize(lmax)).
+/// \param gradYlm Output Cartesian surface gradients gradYlm[(3*k + d)*nPoint + p], d = x, y, z
+///        (size = 3*nPoint*sphereHarmonicArraySize(lmax)).
+/// \param lmax Maximum degree to compute.
+/// \param nPoint Number of directions.
+/// \param rUnit Unit vectors in SoA layout, x = rUnit[p], y = rUnit[nPoint + p], z = rUnit[2*nPoint + p].
+/// \note The gradient is tangent to the sphere, grad Y = e_theta dY/dtheta + e_phi dY/dphi/sin(theta), and
+///       the gradient of Y(r/|r|) at r is gradYlm/|r|. Degree l follows from degree l-1 of the same
+///       sweep through the derivatives of r^l Y(l,m): d/dz gives Y(l-1,m), d/dx +- i d/dy give
+///       Y(l-1,m+-1). Also valid at the poles. The loops over directions are innermost.
+void sphereHarmonic(std::vector<std::complex<double>>& Ylm,
+                    std::vector<std::complex<double>>& gradYlm,
+                    const size_t lmax,
+                    const size_t nPoint,
+                    const double *rUnit);
+
+/// \brief Returns the number of values of spin-weighted spherical harmonics with -l <= m <= l.
+/// \param lmax The maximum degree.
+/// \return (lmax+1)^2.
+inline size_t sphereHarmonicSpinArraySize(size_t lmax)
+{
+  return (lmax + 1) * (lmax + 1);
+}
+
+/// \brief Computes the flat array index for sY(l,m) where -l <= m <= l.
+/// \param l Degree index.
+/// \param m Order index.
+/// \return l^2 + l + m, the layout [Y(0,0),Y(1,-1),Y(1,0),Y(1,1),Y(2,-2) ...].
+inline size_t sphereHarmonicSpinArrayIndex(size_t l, int m)
+{
+  return l * l + l + m;
+}
+
+/// \brief Computes the polar parts sY(l,m)(theta, 0) of spin-weighted spherical harmonics of spin s and -s.
+/// \param lambdaPlus Output values of sY(l,m)(theta, 0) for l >= m >= 0 in compact layout (size = sphereHarmonicArraySize(lmax)).
+/// \param lambdaMinus Output values of (-s)Y(l,m)(theta, 0) in the same layout.
+/// \param s Spin weight, 0 <= s <= 2.
+/// \param lmax Maximum degree to compute.
+/// \param theta Polar angle 0 < theta < Pi.
+/// \note sY(l,m) = lambda(l,m)(theta) e^(i m phi) are zero for l < s and follow from Y(l,m) through
+///       the spin raising and lowering operators: sY = -(d/dtheta - m/sin(theta)) Y/sqrt(l(l+1)) for
+///       s = 1, sY = (d/dtheta + m/sin(theta)) Y/sqrt(l(l+1)) for s = -1 and one more step for |s| = 2. Negative m follow
+///       from sY(l,-m) = (-1)^(s+m) conj((-s)Y(l,m)). Both spins come from the same recurrence of
+///       Y(l,m) and its theta derivative.
+void sphereHarmonicSpinLegendre(std::vector<double>& lambdaPlus,
+                                std::vector<double>& lambdaMinus,
+                                const int s,
+                                const size_t lmax,
+                                const double theta);
+
+/// \brief Computes spin-weighted spherical harmonics sY(l,m) for all -l <= m <= l.
+/// \param sYlm Output values in the layout of sphereHarmonicSpinArrayIndex (size = sphereHarmonicSpinArraySize(lmax)).
+/// \param s Spin weight, -2 <= s <= 2 (s = 0 gives Y(l,m)).
+/// \param lmax Maximum degree to compute.
+/// \param theta Polar angle 0 < theta < Pi.
+/// \param phi Azimuthal angle.
+/// \return `true` on success; `false` if |s| > 2.
+bool sphereHarmonicSpin(std::vector<std::complex<double>>& sYlm,
+                        const int s,
+                        const size_t lmax,
+                        const double theta,
+                        const double phi);
+
+/// \brief Computes the gradient vector spherical harmonics Psi(l,m) = grad Y(l,m)/sqrt(l(l+1)).
+/// \param Psi Output components Psi[2k] (theta) and Psi[2k+1] (phi) at k = sphereHarmonicArrayIndex(l,m),
+///        l >= m >= 0 (size = 2*sphereHarmonicArraySize(lmax)), zero for l = 0.
+/// \param lmax Maximum degree to compute.
+/// \param theta Polar angle 0 < theta < Pi.
+/// \param phi Azimuthal angle.
+/// \note The curl harmonics are Phi(l,m) = rUnit x Psi(l,m) = (-Psi_phi, Psi_theta). Psi and Phi are
+///       orthonormal on the sphere, and Psi_theta + i Psi_phi is minus the spin 1 harmonic.
+void sphereHarmonicVector(std::vector<std::complex<double>>& Psi,
+                          const size_t lmax,
+                          const double theta,
+                          const double phi);
+
 } // namespace quadgrid
 
 #endif // QUADGRID_SPHERICAL_HARMONIC_HPP
@@ -0,0 +1,77 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+#ifndef QUADGRID_WIGNER_HPP
+#define QUADGRID_WIGNER_HPP
+
+/// \file
+/// \brief Wigner d-matrices and rotation of spherical harmonic coefficient vectors.
+#include <vector>
+#include <complex>
+#include <cstddef>
+
+namespace quadgrid
+{
+
+/// \brief Returns the number of Wigner d-matrix entries d^l_(m n) for 0 <= l <= lmax.
+/// \param lmax Maximum degree.
+/// \return Sum{ (2l+1)^2 } = (lmax+1)(2 lmax+1)(2 lmax+3)/3.
+inline size_t wignerArraySize(const size_t lmax)
+{
+  return ((lmax + 1) * (2*lmax + 1) * (2*lmax + 3)) / 3;
+}
+
+/// \brief Computes the flat array index of d^l_(m n).
+/// \param l Degree.
+/// \param m Row order, -l <= m <= l.
+/// \param n Column order, -l <= n <= l.
+/// \return Index in the layout [d^0, d^1 (3x3, row-major from m = n = -1), d^2 (5x5) ...].
+inline size_t wignerArrayIndex(const size_t l, const int m, const int n)
+{
+  return (l * (4*l*l - 1)) / 3 + (size_t) (m + (int) l) * (2*l + 1) + (size_t) (n + (int) l);
+}
+
+/// \brief Computes the Wigner d-matrices d^l_(m n)(beta) = <l m| e^(-i beta J_y) |l n>.
+/// \param lmax Maximum degree.
+/// \param beta Rotation angle about y.
+/// \param d Output matrices (size wignerArraySize(lmax)), d[wignerArrayIndex(l, m, n)].
+/// \return `true` on success.
+/// \note Risbo's recursion: d^(j+1/2) follows from d^j by coupling a spin 1/2 in O(j^2), so all
+///       degrees cost O(lmax^3). Every step is a combination of four terms with
+///       coefficients sqrt(i k)/(2j) cos(beta/2) or sin(beta/2), which is stable for any lmax and beta.
+bool wignerSmallD(const size_t lmax, const double beta, std::vector<double>& d);
+
+/// \brief Rotates spherical harmonic coefficient vectors by Euler angles (z-y-z).
+/// \param lmax Maximum degree.
+/// \param alpha First Euler angle, rotation about z (applied last).
+/// \param beta Second Euler angle, rotation about y.
+/// \param gamma Third Euler angle, rotation about z (applied first).
+/// \param nVector Number of coefficient vectors.
+/// \param c Coefficients of real functions f = Sum{ c(l,m) Y(l,m) } in the layout of
+///        sphereHarmonicArrayIndex, c[v*sphereHarmonicArraySize(lmax) + sphereHarmonicArrayIndex(l,m)],
+///        m >= 0 (c(l,-m) = (-1)^m conj(c(l,m))). Overwritten by the coefficients of the
+///        rotated functions f'(r) = f(Rot^-1 r), Rot = R_z(alpha) R_y(beta) R_z(gamma).
+/// \return `true` on success; `false` if c has the wrong size.
+/// \note c'(l,m') = e^(-i m' alpha) Sum{ d^l_(m' m)(beta) e^(-i m gamma) c(l,m) }, O(lmax^3) per
+///       vector instead of O(lmax^4) for resampling on a sphere grid. With the symmetry of
+///       real functions the sum is two real matrix products per degree, applied to all vectors
+///       at once; degrees are distributed over threads. The matrices are cached per
+///       (lmax, beta) up to 32 M entries in total; larger rotations recompute them on the fly.
+bool sphereHarmonicRotate(const size_t lmax, const double alpha, const double beta,
+  const double gamma, const size_t nVector, std::vector< std::complex<double> >& c);
+
+}//end namespace quadgrid
+
+
+
+
+#endif //QUADGRID_WIGNER_HPP
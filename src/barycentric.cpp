@@ -0,0 +1,222 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+#include <cstdlib>
+#include <cmath>
+
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include <quadgrid/barycentric.hpp>
+#include <quadgrid/gauss_legendre_grid.hpp>
+
+
+namespace quadgrid
+{
+//barycentric weights of the Gauss-Legendre nodes on [-1, 1], cached per order
+struct barycentricTable
+{
+  std::mutex mutex;
+  std::map< size_t, std::vector<double> > lambda;
+};
+
+static barycentricTable& getBarycentricTable ()
+{
+  static barycentricTable table;
+  return table;
+}
+
+
+
+bool gaussLegendreBarycentricWeight (const size_t N, std::vector<double>& lambda)
+//input:  N = order
+//output: lambda[N] = barycentric weights of the Gauss-Legendre nodes
+{
+  barycentricTable& table = getBarycentricTable();
+  {
+    std::lock_guard<std::mutex> lock(table.mutex);
+    auto it = table.lambda.find(N);
+    if (it != table.lambda.end())
+    {
+      lambda = it->second;
+      return true;
+    }
+  }
+
+  std::vector<double> x, w;
+  if (!gaussLegendreGrid (N, x, w, -1.0, 1.0))
+  {
+    std::cout << "Error in gaussLegendreBarycentricWeight. N = " << N << " is not supported\n";
+    return false;
+  }
+
+  //lambda_j = (-1)^j sqrt((1 - x_j^2) w_j)   (Wang and Xiang 2012)
+  lambda.resize(N);
+  for (size_t j = 0; j < N; j++)
+  {
+    const double s = sqrt((1.0 - x[j])*(1.0 + x[j])*w[j]);
+    lambda[j] = (j % 2 == 0) ? s : -s;
+  }
+
+  std::lock_guard<std::mutex> lock(table.mutex);
+  table.lambda[N] = lambda;
+
+  return true;
+}
+
+bool barycentricWeight (const std::vector<double>& x, std::vector<double>& lambda)
+//input:  x[N] = nodes
+//output: lambda[N] = 1/Prod{ x_j - x_k } for k != j, normalized to max |lambda| = 1
+{
+  const size_t N = x.size();
+  lambda.assign(N, 1.0);
+
+  //products are accumulated in logarithmic form to avoid overflow for large N
+  std::vector<double> logAbs(N, 0.0);
+  double logMin = 1.0E300;
+  for (size_t j = 0; j < N; j++)
+  {
+    int sign = 1;
+    for (size_t k = 0; k < N; k++)
+    {
+      if (k == j)
+        continue;
+      const double d = x[j] - x[k];
+      if (d == 0.0)
+      {
+        std::cout << "Error in barycentricWeight. x[" << j << "] = x[" << k << "]\n";
+        return false;
+      }
+      if (d < 0.0)
+        sign = -sign;
+      logAbs[j] += log(fabs(d));
+    }
+    lambda[j] = sign;
+    if (logMin > logAbs[j]) logMin = logAbs[j];
+  }
+
+  for (size_t j = 0; j < N; j++)
+    lambda[j] *= exp(logMin - logAbs[j]);
+
+  return true;
+}
+
+bool barycentricInterpolate (const std::vector<double>& x,
+  const std::vector<double>& lambda, const std::vector<double>& f, const size_t nField,
+  const std::vector<double>& t, std::vector<double>& ft)
+//input:  x[N] and lambda[N] = nodes and barycentric weights, f[nField*N] = nodal values,
+//        t[M] = evaluation points
+//output: ft[nField*M] = interpolated values
+{
+  const size_t N = x.size();
+  const size_t M = t.size();
+  if ((N == 0) || (lambda.size() != N) || (f.size() != nField*N))
+  {
+    std::cout << "Error in barycentricInterpolate. x.size() = " << N << " lambda.size() = ";
+    std::cout << lambda.size() << " f.size() = " << f.size() << " nField = " << nField << "\n";
+    return false;
+  }
+
+  ft.resize(nField*M);
+
+  #pragma omp parallel
+  {
+    std::vector<double> c(N);
+
+    #pragma omp for schedule(static)
+    for (long i = 0; i < (long) M; i++)
+    {
+      //exact hit on a node
+      size_t hit = N;
+      for (size_t j = 0; j < N; j++)
+        if (t[i] == x[j])
+          hit = j;
+
+      if (hit < N)
+      {
+        for (size_t k = 0; k < nField; k++)
+          ft[k*M+i] = f[k*N+hit];
+        continue;
+      }
+
+      double denom = 0.0;
+      for (size_t j = 0; j < N; j++)
+      {
+        c[j]   = lambda[j]/(t[i] - x[j]);
+        denom += c[j];
+      }
+      const double scale = 1.0/denom;
+
+      for (size_t k = 0; k < nField; k++)
+      {
+        const double *fk = &f[k*N];
+        double sum = 0.0;
+        for (size_t j = 0; j < N; j++)
+          sum += c[j]*fk[j];
+        ft[k*M+i] = sum*scale;
+      }
+    }
+  }
+
+  return true;
+}
+
+bool differentiationMatrix (const std::vector<double>& x,
+  const std::vector<double>& lambda, std::vector<double>& D)
+//input:  x[N] and lambda[N] = nodes and barycentric weights
+//output: D[N*N] = row-major differentiation matrix
+//        D_ij = (lambda_j/lambda_i)/(x_i - x_j), D_ii = -Sum{ D_ij } for j != i
+{
+  const size_t N = x.size();
+  if ((N == 0) || (lambda.size() != N))
+  {
+    std::cout << "Error in differentiationMatrix. x.size() = " << N << " lambda.size() = ";
+    std::cout << lambda.size() << "\n";
+    return false;
+  }
+
+  D.resize(N*N);
+  for (size_t i = 0; i < N; i++)
+  {
+    double diag = 0.0;
+    for (size_t j = 0; j < N; j++)
+    {
+      if (j == i)
+        continue;
+      const double d = (lambda[j]/lambda[i])/(x[i] - x[j]);
+      D[i*N+j] = d;
+      diag    -= d;
+    }
+    D[i*N+i] = diag;
+  }
+
+  return true;
+}
+
+bool gaussLegendreDifferentiationMatrix (const size_t N, const double a, const double b,
+  std::vector<double>& D)
+//input:  N = order, [a, b] interval
+//output: D[N*N] = row-major differentiation matrix on the Gauss-Legendre nodes of [a, b]
+{
+  std::vector<double> x, w, lambda;
+  if (!gaussLegendreBarycentricWeight (N, lambda))
+    return false;
+  if (!gaussLegendreGrid (N, x, w, a, b))
+    return false;
+  x.resize(N);
+
+  return differentiationMatrix (x, lambda, D);
+}
+
+}//end namespace quadgrid
@@ -0,0 +1,313 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+#include <cstdlib>
+#include <cmath>
+
+#include <complex>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include <quadgrid/chebyshev_legendre.hpp>
+#include <quadgrid/fft.hpp>
+#include <quadgrid/constant.hpp>
+
+
+namespace quadgrid
+{
+typedef std::complex<double> chebyshevLegendreComplex;
+
+//orders below chebyshevLegendreDirectOrder are converted with the O(N^2) sums
+static const size_t chebyshevLegendreDirectOrder = 128;
+
+//maximum residual diagonal of the pivoted Cholesky factorizations of the Hankel parts;
+//the Chebyshev to Legendre part multiplies its columns by k and needs the tighter one
+static const double chebyshevLegendreTolerance  = 1.0E-16;
+static const double chebyshevLegendreTolerance2 = 1.0E-22;
+
+
+
+//Toeplitz-Hankel plan of order N
+//  lambda[m]     = Lambda(m/2) = Gamma((m+1)/2)/Gamma(m/2+1), m < 2N
+//  toeplitzFFT   = transform of T(d) = Lambda(d/2) (d even), 0 (d odd), zero-padded to L
+//  hankel[r][n]  = pivoted Cholesky factors, Lambda((n+k)/2) = Sum{ hankel[r][n] hankel[r][k] }
+//Chebyshev to Legendre (off-diagonal part in the shifted column m = k-1)
+//  toeplitzFFT2  = transform of T2(d) = -Lambda((d-1)/2)/(d+1) (d odd), 0 (d even)
+//  hankel2[r][n] = pivoted Cholesky factors of Lambda((n+m)/2)/(n+m+2)
+struct chebyshevLegendrePlan
+{
+  size_t L;
+  std::vector<double> lambda;
+  std::vector<chebyshevLegendreComplex> toeplitzFFT;
+  std::vector< std::vector<double> > hankel;
+  std::vector<chebyshevLegendreComplex> toeplitzFFT2;
+  std::vector< std::vector<double> > hankel2;
+};
+
+static void chebyshevLegendreLambda (const size_t N, std::vector<double>& lambda)
+//Lambda(z+1) = Lambda(z) (z+1/2)/(z+1) avoids the cancellation of lgamma differences
+{
+  lambda.resize(2*N);
+  lambda[0] = sqrt(Pi);
+  if (2*N > 1)
+    lambda[1] = 2.0/sqrt(Pi);
+  for (size_t m = 2; m < 2*N; m++)
+    lambda[m] = lambda[m-2]*(m - 1.0)/m;
+}
+
+static void chebyshevLegendreCholesky (const size_t N, const std::vector<double>& h,
+  const double tolerance, std::vector< std::vector<double> >& factor)
+//pivoted Cholesky of the positive semi-definite Hankel matrix H[n][k] = h[n+k]
+{
+  std::vector<double> d(N);
+  for (size_t n = 0; n < N; n++)
+    d[n] = h[2*n];
+
+  factor.clear();
+  while (factor.size() < N)
+  {
+    size_t p = 0;
+    for (size_t n = 1; n < N; n++)
+      if (d[n] > d[p])
+        p = n;
+    if (d[p] <= tolerance)
+      break;
+
+    std::vector<double> l(&h[p], &h[p] + N);
+    for (size_t r = 0; r < factor.size(); r++)
+    {
+      const double lp = factor[r][p];
+      for (size_t n = 0; n < N; n++)
+        l[n] -= factor[r][n]*lp;
+    }
+    const double scale = 1.0/sqrt(d[p]);
+    for (size_t n = 0; n < N; n++)
+      l[n] *= scale;
+    for (size_t n = 0; n < N; n++)
+      d[n] -= l[n]*l[n];
+    d[p] = 0.0;
+
+    factor.push_back(l);
+  }
+}
+
+struct chebyshevLegendreTable
+{
+  std::mutex mutex;
+  std::map<size_t, chebyshevLegendrePlan> plan;
+
+  const chebyshevLegendrePlan* get (const size_t N)
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      auto it = plan.find(N);
+      if (it != plan.end())
+        return &it->second;
+    }
+
+    chebyshevLegendrePlan p;
+    chebyshevLegendreLambda (N, p.lambda);
+
+    if (N >= chebyshevLegendreDirectOrder)
+    {
+      p.L = 1;
+      while (p.L < 2*N)
+        p.L <<= 1;
+
+      p.toeplitzFFT.assign(p.L, chebyshevLegendreComplex(0.0, 0.0));
+      for (size_t d = 0; d < N; d += 2)
+        p.toeplitzFFT[d] = p.lambda[d];
+      fft (p.toeplitzFFT, false);
+
+      chebyshevLegendreCholesky (N, p.lambda, chebyshevLegendreTolerance, p.hankel);
+
+      p.toeplitzFFT2.assign(p.L, chebyshevLegendreComplex(0.0, 0.0));
+      for (size_t d = 1; d < N; d += 2)
+        p.toeplitzFFT2[d] = -p.lambda[d-1]/(d + 1.0);
+      fft (p.toeplitzFFT2, false);
+
+      std::vector<double> h2(2*N-1);
+      for (size_t m = 0; m < 2*N-1; m++)
+        h2[m] = p.lambda[m]/(m + 2.0);
+      chebyshevLegendreCholesky (N, h2, chebyshevLegendreTolerance2, p.hankel2);
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = plan.insert(std::make_pair(N, p)).first;
+    return &it->second;
+  }
+};
+
+static chebyshevLegendreTable& getChebyshevLegendreTable ()
+{
+  static chebyshevLegendreTable table;
+  return table;
+}
+
+
+
+static void chebyshevLegendreToeplitz (const size_t L,
+  const std::vector<chebyshevLegendreComplex>& toeplitzFFT,
+  const std::vector< std::vector<double> >& hankel, const size_t N,
+  const std::vector<double>& v, const bool transpose, std::vector<double>& y)
+//y = Sum{ diag(l_r) T diag(l_r) v }      (transpose = false, T lower triangular)
+//y = Sum{ diag(l_r) T^T diag(l_r) v }    (transpose = true)
+//two ranks are packed into the real and imaginary parts of one complex FFT
+{
+  const size_t K = hankel.size();
+  const double scale = 1.0/L;
+
+  y.assign(N, 0.0);
+  std::vector<chebyshevLegendreComplex> u(L);
+  for (size_t r = 0; r < K; r += 2)
+  {
+    const std::vector<double>& l1 = hankel[r];
+    const std::vector<double>* l2 = (r+1 < K) ? &hankel[r+1] : NULL;
+
+    std::fill(u.begin(), u.end(), chebyshevLegendreComplex(0.0, 0.0));
+    for (size_t n = 0; n < N; n++)
+    {
+      //the transpose is a correlation: convolve the reversed vector
+      const size_t m = transpose ? N-1-n : n;
+      u[m] = chebyshevLegendreComplex(l1[n]*v[n], (l2 != NULL) ? (*l2)[n]*v[n] : 0.0);
+    }
+
+    fft (u, false);
+    for (size_t k = 0; k < L; k++)
+    {
+      const chebyshevLegendreComplex w = toeplitzFFT[k];
+      u[k] = chebyshevLegendreComplex(u[k].real()*w.real() - u[k].imag()*w.imag(),
+                                      u[k].real()*w.imag() + u[k].imag()*w.real());
+    }
+    fft (u, true);
+
+    for (size_t n = 0; n < N; n++)
+    {
+      const chebyshevLegendreComplex z = u[transpose ? N-1-n : n]*scale;
+      y[n] += l1[n]*z.real();
+      if (l2 != NULL)
+        y[n] += (*l2)[n]*z.imag();
+    }
+  }
+}
+
+
+
+bool legendreToChebyshev (const std::vector<double>& c, std::vector<double>& a)
+//input:  c[N] = Legendre coefficients
+//output: a[N] = Chebyshev coefficients
+//        a[k] = (2-delta_k0)/Pi Sum{ Lambda((n-k)/2) Lambda((n+k)/2) c[n] }, n >= k, n-k even
+{
+  const size_t N = c.size();
+  if (N == 0)
+  {
+    std::cout << "Error in legendreToChebyshev. N = 0\n";
+    return false;
+  }
+
+  const chebyshevLegendrePlan* p = getChebyshevLegendreTable().get (N);
+
+  if (N < chebyshevLegendreDirectOrder)
+  {
+    a.assign(N, 0.0);
+    for (size_t k = 0; k < N; k++)
+      for (size_t n = k; n < N; n += 2)
+        a[k] += p->lambda[n-k]*p->lambda[n+k]*c[n];
+  }
+  else
+    chebyshevLegendreToeplitz (p->L, p->toeplitzFFT, p->hankel, N, c, true, a);
+
+  a[0] *= 1.0/Pi;
+  for (size_t k = 1; k < N; k++)
+    a[k] *= 2.0/Pi;
+
+  return true;
+}
+
+bool chebyshevMomentToLegendre (const std::vector<double>& t, std::vector<double>& c)
+//input:  t[N] = Chebyshev moments
+//output: c[N] = Legendre coefficients
+//        c[n] = (n+1/2)/Pi Sum{ (2-delta_k0) Lambda((n-k)/2) Lambda((n+k)/2) t[k] }, k <= n
+{
+  const size_t N = t.size();
+  if (N == 0)
+  {
+    std::cout << "Error in chebyshevMomentToLegendre. N = 0\n";
+    return false;
+  }
+
+  const chebyshevLegendrePlan* p = getChebyshevLegendreTable().get (N);
+
+  std::vector<double> ts(t);
+  for (size_t k = 1; k < N; k++)
+    ts[k] *= 2.0;
+
+  if (N < chebyshevLegendreDirectOrder)
+  {
+    c.assign(N, 0.0);
+    for (size_t n = 0; n < N; n++)
+      for (size_t k = n%2; k <= n; k += 2)
+        c[n] += p->lambda[n-k]*p->lambda[n+k]*ts[k];
+  }
+  else
+    chebyshevLegendreToeplitz (p->L, p->toeplitzFFT, p->hankel, N, ts, false, c);
+
+  for (size_t n = 0; n < N; n++)
+    c[n] *= (n + 0.5)/Pi;
+
+  return true;
+}
+
+bool chebyshevToLegendre (const std::vector<double>& a, std::vector<double>& c)
+//input:  a[N] = Chebyshev coefficients
+//output: c[N] = Legendre coefficients
+//        c[n] = D[n] a[n] - (n+1/2) Sum{ Lambda((k-n-2)/2) Lambda((k+n-1)/2) k a[k]/((k-n)(k+n+1)) },
+//        k > n, k-n even, D[0] = 1, D[k] = sqrt(Pi)/(2 Lambda(k))
+{
+  const size_t N = a.size();
+  if (N == 0)
+  {
+    std::cout << "Error in chebyshevToLegendre. N = 0\n";
+    return false;
+  }
+
+  const chebyshevLegendrePlan* p = getChebyshevLegendreTable().get (N);
+
+  if (N < chebyshevLegendreDirectOrder)
+  {
+    c.assign(N, 0.0);
+    for (size_t n = 0; n < N; n++)
+      for (size_t k = n+2; k < N; k += 2)
+        c[n] -= p->lambda[k-n-2]*p->lambda[k+n-1]*k*a[k]/((k - n)*(k + n + 1.0));
+  }
+  else
+  {
+    //shifted column m = k-1: T2(m-n) H2(n, m) (m+1) a[m+1]
+    std::vector<double> ka(N, 0.0);
+    for (size_t m = 0; m+1 < N; m++)
+      ka[m] = (m + 1.0)*a[m+1];
+    chebyshevLegendreToeplitz (p->L, p->toeplitzFFT2, p->hankel2, N, ka, true, c);
+  }
+
+  for (size_t n = 0; n < N; n++)
+    c[n] *= n + 0.5;
+
+  c[0] += a[0];
+  for (size_t k = 1; k < N; k++)
+    c[k] += 0.5*sqrt(Pi)/p->lambda[2*k]*a[k];
+
+  return true;
+}
+
+}//end namespace quadgrid
@@ -0,0 +1,176 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+#include <cstdlib>
+#include <cmath>
+
+#include <complex>
+#include <iostream>
+#include <vector>
+
+#include <quadgrid/clenshaw_curtis_grid.hpp>
+#include <quadgrid/fft.hpp>
+#include <quadgrid/constant.hpp>
+
+
+namespace quadgrid
+{
+typedef std::complex<double> ccComplex;
+
+
+
+bool clenshawCurtisGrid (const size_t N, std::vector<double>& x,
+  std::vector<double>& w, const double a, const double b)
+//input:  N = number of points, [a, b] interval
+//output: x[N] and w[N] = coordinates and weights
+//        w_j = (c_j/n) Sum{ b_k cos(2 k j Pi/n)/(1-4k^2) } for k <= n/2, n = N-1
+{
+  if (N == 0)
+  {
+    std::cout << "Error in clenshawCurtisGrid. N = 0\n";
+    return false;
+  }
+
+  x.resize(N);
+  w.resize(N);
+
+  const double c1 = 0.5*(b-a);
+  const double c2 = 0.5*(b+a);
+
+  if (N == 1)
+  {
+    x[0] = c2;
+    w[0] = 2.0*c1;
+    return true;
+  }
+
+  const size_t n = N-1;
+  std::vector<ccComplex> d(n, ccComplex(0.0, 0.0));
+  for (size_t k = 0; 2*k <= n; k++)
+    d[k] = ((k == 0) || (2*k == n) ? 1.0 : 2.0)/(1.0 - 4.0*k*k);
+  fft (d, true);
+
+  for (size_t j = 0; j <= n; j++)
+  {
+    const double c = ((j == 0) || (j == n)) ? 1.0 : 2.0;
+    w[j] = c1*c/n*d[j % n].real();
+    x[j] = c1*sin(0.5*Pi*(2.0*j - n)/n) + c2;
+  }
+
+  return true;
+}
+
+bool fejerGrid (const size_t N, std::vector<double>& x, std::vector<double>& w,
+  const int type, const double a, const double b)
+//input:  N = number of points, type = 1 or 2, [a, b] interval
+//output: x[N] and w[N] = coordinates and weights
+//        type 1: w_j = (2/N) (1 - 2 Sum{ cos(2k theta_j)/(4k^2-1) }), k <= N/2
+//        type 2: w_j = (4 sin(theta_j)/n) Sum{ sin((2k-1) theta_j)/(2k-1) }, k <= n/2, n = N+1
+{
+  if ((N == 0) || ((type != 1) && (type != 2)))
+  {
+    std::cout << "Error in fejerGrid. N = " << N << " type = " << type << "\n";
+    std::cout << "N >= 1 and type = 1 or 2 are required\n";
+    return false;
+  }
+
+  x.resize(N);
+  w.resize(N);
+
+  const double c1 = 0.5*(b-a);
+  const double c2 = 0.5*(b+a);
+
+  if (type == 1)
+  {
+    //cos(2k theta_j) = Re{ e^(i Pi k/N) e^(2 Pi i kj/N) }
+    std::vector<ccComplex> d(N, ccComplex(0.0, 0.0));
+    d[0] = 1.0;
+    for (size_t k = 1; 2*k <= N; k++)
+      d[k] = -2.0/(4.0*k*k - 1.0)*ccComplex(cos(Pi*k/N), sin(Pi*k/N));
+    fft (d, true);
+
+    for (size_t j = 0; j < N; j++)
+    {
+      w[j] = c1*2.0/N*d[j].real();
+      x[j] = c1*sin(0.5*Pi*(2.0*j + 1.0 - N)/N) + c2;
+    }
+  }
+  else
+  {
+    //sin((2k-1) theta_j) = Im{ e^(-i Pi j/n) e^(2 Pi i kj/n) }
+    const size_t n = N+1;
+    std::vector<ccComplex> d(n, ccComplex(0.0, 0.0));
+    for (size_t k = 1; 2*k <= n; k++)
+      d[k] = 1.0/(2.0*k - 1.0);
+    fft (d, true);
+
+    for (size_t j = 1; j <= N; j++)
+    {
+      const double theta = Pi*j/n;
+      const double S = (ccComplex(cos(theta), -sin(theta))*d[j]).imag();
+      w[j-1] = c1*4.0*sin(theta)/n*S;
+      x[j-1] = c1*sin(0.5*Pi*(2.0*j - n)/n) + c2;
+    }
+  }
+
+  return true;
+}
+
+bool clenshawCurtisIntegrate (const std::function<double(double)>& f, const double a,
+  const double b, const double relTol, const double absTol, const size_t maxN,
+  double& integral, double& error, std::vector<double>& x, std::vector<double>& fx)
+//input:  f = integrand, [a, b] interval, relTol and absTol = tolerances, maxN = budget
+//output: integral, error = estimate, x and fx = all samples of the finest level
+{
+  std::vector<double> w;
+  std::vector<double> fxFine;
+
+  //level n = 2 (3 points)
+  size_t n = 2;
+  clenshawCurtisGrid (n+1, x, w, a, b);
+  fx.resize(n+1);
+  for (size_t j = 0; j <= n; j++)
+    fx[j] = f(x[j]);
+
+  integral = 0.0;
+  for (size_t j = 0; j <= n; j++)
+    integral += w[j]*fx[j];
+  error = fabs(integral);
+
+  while (2*n+1 <= maxN)
+  {
+    //the even nodes of the refined grid are the previous nodes
+    clenshawCurtisGrid (2*n+1, x, w, a, b);
+    fxFine.resize(2*n+1);
+    for (size_t j = 0; j <= n; j++)
+      fxFine[2*j] = fx[j];
+    for (size_t j = 0; j < n; j++)
+      fxFine[2*j+1] = f(x[2*j+1]);
+    fx.swap(fxFine);
+    n *= 2;
+
+    double sum = 0.0;
+    for (size_t j = 0; j <= n; j++)
+      sum += w[j]*fx[j];
+
+    error    = fabs(sum - integral);
+    integral = sum;
+
+    const double tol = (absTol > relTol*fabs(integral)) ? absTol : relTol*fabs(integral);
+    if (error <= tol)
+      return true;
+  }
+
+  return false;
+}
+
+}//end namespace quadgrid
@@ -0,0 +1,501 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+#include <cstdlib>
+#include <cmath>
+
+#include <algorithm>
+#include <complex>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <quadgrid/collocation.hpp>
+#include <quadgrid/gauss_legendre_grid.hpp>
+#include <quadgrid/gauss_family_grid.hpp>
+#include <quadgrid/barycentric.hpp>
+
+
+namespace quadgrid
+{
+typedef std::complex<double> collocationComplex;
+
+//largest number of stages and relative residual of the eigen-decomposition
+static const size_t collocationMaxStage = 20;
+static const double collocationEigenTolerance = 1.0E-6;
+
+//Newton iterations per step and relative tolerance of the stage increments
+static const size_t collocationMaxNewton = 50;
+static const double collocationNewtonTolerance = 1.0E-14;
+static const double collocationNewtonStagnation = 1.0E-10;
+
+static bool collocationBuild (const collocationFamily family, const size_t s,
+  butcherTableau& tableau);
+
+struct collocationTable
+{
+  std::mutex mutex;
+  std::map<std::pair<int, size_t>, butcherTableau> tableau;
+
+  const butcherTableau* get (const collocationFamily family, const size_t s)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    const std::pair<int, size_t> key((int) family, s);
+    auto it = tableau.find(key);
+    if (it != tableau.end())
+      return &it->second;
+
+    butcherTableau t;
+    if (!collocationBuild (family, s, t))
+      return NULL;
+    return &(tableau[key] = t);
+  }
+};
+
+static collocationTable& getCollocationTable ()
+{
+  static collocationTable table;
+  return table;
+}
+
+
+
+template <typename T>
+static bool collocationLU (std::vector<T>& M, const size_t n, std::vector<size_t>& pivot)
+//in-place LU decomposition with partial pivoting of the row-major M[n*n]
+{
+  pivot.resize(n);
+  for (size_t k = 0; k < n; k++)
+  {
+    size_t p = k;
+    for (size_t i = k+1; i < n; i++)
+      if (std::abs(M[i*n+k]) > std::abs(M[p*n+k]))
+        p = i;
+    pivot[k] = p;
+    if (M[p*n+k] == 0.0)
+      return false;
+    if (p != k)
+      for (size_t j = 0; j < n; j++)
+        std::swap(M[k*n+j], M[p*n+j]);
+
+    const T inverse = 1.0/M[k*n+k];
+    for (size_t i = k+1; i < n; i++)
+    {
+      const T factor = M[i*n+k]*inverse;
+      M[i*n+k] = factor;
+      for (size_t j = k+1; j < n; j++)
+        M[i*n+j] -= factor*M[k*n+j];
+    }
+  }
+  return true;
+}
+
+template <typename T>
+static void collocationSolve (const std::vector<T>& M, const size_t n,
+  const std::vector<size_t>& pivot, T *v)
+//solves (LU) x = v in place
+{
+  for (size_t k = 0; k < n; k++)
+    std::swap(v[k], v[pivot[k]]);
+  for (size_t k = 0; k < n; k++)
+    for (size_t i = k+1; i < n; i++)
+      v[i] -= M[i*n+k]*v[k];
+  for (size_t k = n; k-- > 0;)
+  {
+    for (size_t j = k+1; j < n; j++)
+      v[k] -= M[k*n+j]*v[j];
+    v[k] /= M[k*n+k];
+  }
+}
+
+static bool collocationEigen (butcherTableau& tableau, const size_t padeNumerator)
+//eigenvalues of A from det(lambda I - A) = lambda^s Q(1/lambda), Q = denominator of the
+//(padeNumerator, s) Pade approximant of exp, polished by inverse iteration on A
+{
+  const size_t s = tableau.s;
+
+  //monic characteristic polynomial p(lambda) = Sum{ coefficient[i] lambda^(s-i) }
+  std::vector<double> coefficient(s+1);
+  double q = 1.0;
+  for (size_t i = 0; i <= s; i++)
+  {
+    coefficient[i] = (i % 2 == 0) ? q : -q;
+    q *= (double) (s - i)/((i + 1.0)*(padeNumerator + s - i));
+  }
+
+  //Durand-Kerner iteration
+  std::vector<collocationComplex> root(s);
+  const collocationComplex seed(0.4, 0.9);
+  double radius = 0.0;
+  for (size_t i = 1; i <= s; i++)
+    radius = std::max(radius, pow(fabs(coefficient[i]), 1.0/i));
+  for (size_t k = 0; k < s; k++)
+    root[k] = radius*pow(seed, (double) k);
+  for (size_t iteration = 0; iteration < 1000; iteration++)
+  {
+    double change = 0.0;
+    for (size_t k = 0; k < s; k++)
+    {
+      collocationComplex p = 1.0, d = 1.0;
+      for (size_t i = 1; i <= s; i++)
+        p = p*root[k] + coefficient[i];
+      for (size_t j = 0; j < s; j++)
+        if (j != k)
+          d *= root[k] - root[j];
+      const collocationComplex step = p/d;
+      root[k] -= step;
+      change = std::max(change, std::abs(step)/std::abs(root[k]));
+    }
+    if (change < 1.0E-15)
+      break;
+  }
+
+  //inverse iteration on A - mu I: w = (A - mu I)^-1 v, mu += (v^H v)/(v^H w)
+  tableau.eigenvalue.resize(s);
+  tableau.T.assign(s*s, 0.0);
+  std::vector<collocationComplex> M(s*s), v(s), w(s);
+  std::vector<size_t> pivot;
+  for (size_t k = 0; k < s; k++)
+  {
+    collocationComplex mu = root[k];
+    for (size_t i = 0; i < s; i++)
+      v[i] = 1.0/sqrt((double) s);
+
+    for (size_t iteration = 0; iteration < 20; iteration++)
+    {
+      for (size_t i = 0; i < s*s; i++)
+        M[i] = tableau.A[i];
+      for (size_t i = 0; i < s; i++)
+        M[i*s+i] -= mu;
+      if (!collocationLU (M, s, pivot))
+      {
+        //exactly singular: move the shift off the eigenvalue
+        mu += 1.0E-14*std::abs(mu);
+        continue;
+      }
+      w = v;
+      collocationSolve (M, s, pivot, &w[0]);
+
+      collocationComplex vw = 0.0;
+      double norm = 0.0;
+      for (size_t i = 0; i < s; i++)
+      {
+        vw   += std::conj(v[i])*w[i];
+        norm += std::norm(w[i]);
+      }
+      norm = sqrt(norm);
+      for (size_t i = 0; i < s; i++)
+        v[i] = w[i]/norm;
+
+      const collocationComplex step = 1.0/vw;
+      mu += step;
+      if (std::abs(step) <= 1.0E-15*std::abs(mu))
+        break;
+    }
+
+    tableau.eigenvalue[k] = mu;
+    for (size_t i = 0; i < s; i++)
+      tableau.T[i*s+k] = v[i];
+  }
+
+  //the eigenvalues must be distinct, T is inverted column by column
+  M = tableau.T;
+  if (!collocationLU (M, s, pivot))
+    return false;
+  tableau.Tinv.assign(s*s, 0.0);
+  std::vector<collocationComplex> e(s);
+  for (size_t k = 0; k < s; k++)
+  {
+    std::fill(e.begin(), e.end(), 0.0);
+    e[k] = 1.0;
+    collocationSolve (M, s, pivot, &e[0]);
+    for (size_t i = 0; i < s; i++)
+      tableau.Tinv[i*s+k] = e[i];
+  }
+
+  //residual of A = T diag(eigenvalue) Tinv; the eigenvectors of the nodal basis lose about
+  //half a digit per stage (1e-13 at s = 8, 1e-6 at s = 20)
+  double residual = 0.0, scale = 0.0;
+  for (size_t i = 0; i < s; i++)
+    for (size_t j = 0; j < s; j++)
+    {
+      collocationComplex sum = 0.0;
+      for (size_t k = 0; k < s; k++)
+        sum += tableau.T[i*s+k]*tableau.eigenvalue[k]*tableau.Tinv[k*s+j];
+      residual = std::max(residual, std::abs(sum - tableau.A[i*s+j]));
+      scale    = std::max(scale, fabs(tableau.A[i*s+j]));
+    }
+  return (residual <= collocationEigenTolerance*scale);
+}
+
+static bool collocationBuild (const collocationFamily family, const size_t s,
+  butcherTableau& tableau)
+{
+  tableau.s = s;
+  tableau.c.clear();
+
+  std::vector<double> x, w;
+  size_t padeNumerator = s;
+  if (family == collocationGauss)
+  {
+    gaussLegendreGrid (s, x, w, 0.0, 1.0);
+    tableau.c.assign(x.begin(), x.begin() + s);
+    tableau.order = 2*s;
+  }
+  else if (family == collocationRadauIIA)
+  {
+    if (s > 1)
+      gaussJacobiGrid (s-1, x, w, 1.0, 0.0, 0.0, 1.0);
+    tableau.c.assign(x.begin(), x.end());
+    tableau.c.push_back(1.0);
+    tableau.order = 2*s-1;
+    padeNumerator = s-1;
+  }
+  else
+  {
+    tableau.c.push_back(0.0);
+    if (s > 2)
+      gaussJacobiGrid (s-2, x, w, 1.0, 1.0, 0.0, 1.0);
+    tableau.c.insert(tableau.c.end(), x.begin(), x.end());
+    tableau.c.push_back(1.0);
+    tableau.order = 2*s-2;
+    padeNumerator = s-2;
+  }
+
+  //Gauss-Legendre rule of order s on [0, 1], exact for the Lagrange polynomials
+  std::vector<double> xq, wq;
+  gaussLegendreGrid (s, xq, wq, 0.0, 1.0);
+
+  //basis nodes: all nodes, or c_1 .. c_(s-1) for the Lobatto IIIC columns 1 .. s-1
+  const size_t first = (family == collocationLobattoIIIC) ? 1 : 0;
+  const size_t nBasis = s - first;
+  std::vector<double> node(tableau.c.begin() + first, tableau.c.end()), lambda;
+  barycentricWeight (node, lambda);
+  std::vector<double> identity(nBasis*nBasis, 0.0);
+  for (size_t j = 0; j < nBasis; j++)
+    identity[j*nBasis+j] = 1.0;
+
+  //evaluation points: the quadrature points of [0, c_i] for i = 0 .. s-1, [0, 1] and 0
+  std::vector<double> t;
+  for (size_t i = 0; i <= s; i++)
+  {
+    const double upper = (i < s) ? tableau.c[i] : 1.0;
+    for (size_t q = 0; q < s; q++)
+      t.push_back(upper*xq[q]);
+  }
+  t.push_back(0.0);
+  std::vector<double> value;
+  barycentricInterpolate (node, lambda, identity, nBasis, t, value);
+  const size_t M = t.size();
+
+  //integrals of the basis over [0, c_i] and [0, 1]
+  std::vector<double> integral((s+1)*nBasis, 0.0);
+  for (size_t i = 0; i <= s; i++)
+  {
+    const double upper = (i < s) ? tableau.c[i] : 1.0;
+    for (size_t j = 0; j < nBasis; j++)
+    {
+      double sum = 0.0;
+      for (size_t q = 0; q < s; q++)
+        sum += wq[q]*value[j*M + i*s + q];
+      integral[i*nBasis+j] = upper*sum;
+    }
+  }
+
+  tableau.A.assign(s*s, 0.0);
+  tableau.b.assign(s, 0.0);
+  if (family == collocationLobattoIIIC)
+  {
+    //b = Lobatto weights; A[i][0] = b_0, A[i][j] = Integral{ l_j } - b_0 l_j(0)
+    const double b0 = 1.0/(s*(s-1.0));
+    tableau.b[0] = b0;
+    for (size_t j = 0; j < nBasis; j++)
+      tableau.b[j+1] = integral[s*nBasis+j] - b0*value[j*M + M-1];
+    for (size_t i = 0; i < s; i++)
+    {
+      tableau.A[i*s] = b0;
+      for (size_t j = 0; j < nBasis; j++)
+        tableau.A[i*s+j+1] = integral[i*nBasis+j] - b0*value[j*M + M-1];
+    }
+  }
+  else
+  {
+    for (size_t i = 0; i < s; i++)
+      for (size_t j = 0; j < s; j++)
+        tableau.A[i*s+j] = integral[i*s+j];
+    for (size_t j = 0; j < s; j++)
+      tableau.b[j] = integral[s*s+j];
+  }
+
+  return collocationEigen (tableau, padeNumerator);
+}
+
+
+
+bool butcherTableauCollocation (const collocationFamily family, const size_t s,
+  butcherTableau& tableau)
+//input:  family, s = number of stages
+//output: tableau = A, b, c, order and the eigen-decomposition of A
+{
+  const bool valid = ((family == collocationGauss) || (family == collocationRadauIIA) ||
+    (family == collocationLobattoIIIC)) && (s >= ((family == collocationLobattoIIIC) ? 2 : 1)) &&
+    (s <= collocationMaxStage);
+  const butcherTableau *t = valid ? getCollocationTable().get (family, s) : NULL;
+  if (t == NULL)
+  {
+    std::cout << "Error in butcherTableauCollocation. family = " << (int) family << " s = " << s;
+    std::cout << " (1 .. " << collocationMaxStage << ", Lobatto IIIC from 2)\n";
+    return false;
+  }
+
+  tableau = *t;
+  return true;
+}
+
+bool collocationIntegrate (const std::function<void(const double, const double*, double*)>& f,
+  const std::function<void(const double, const double*, double*)>& jacobian,
+  const size_t n, const collocationFamily family, const size_t s, const double t0,
+  const double t1, const size_t nStep, std::vector<double>& y)
+//input:  f and jacobian = right-hand side and its Jacobian, n = dimension, family,
+//        s = stages, [t0, t1] interval, nStep = number of steps, y[n] = initial value
+//output: y[n] = value at t1
+{
+  butcherTableau tableau;
+  if ((n == 0) || (nStep == 0) || (y.size() != n) ||
+      !butcherTableauCollocation (family, s, tableau))
+  {
+    std::cout << "Error in collocationIntegrate. n = " << n << " nStep = " << nStep;
+    std::cout << " y.size() = " << y.size() << " s = " << s << "\n";
+    return false;
+  }
+
+  //d = b^T A^-1 for the update of the Gauss methods from A^T d = b, solved with A itself
+  //since the eigenvectors lose digits as s grows
+  const bool stifflyAccurate = (family != collocationGauss);
+  std::vector<double> d(tableau.b);
+  if (!stifflyAccurate)
+  {
+    std::vector<double> AT(s*s);
+    std::vector<size_t> pivotA;
+    for (size_t i = 0; i < s; i++)
+      for (size_t j = 0; j < s; j++)
+        AT[i*s+j] = tableau.A[j*s+i];
+    if (!collocationLU (AT, s, pivotA))
+    {
+      std::cout << "Error in collocationIntegrate. A is singular\n";
+      return false;
+    }
+    collocationSolve (AT, s, pivotA, &d[0]);
+  }
+
+  const double h = (t1 - t0)/nStep;
+  std::vector<double> J(n*n), Z(s*n), F(s*n), G(s*n), Y(n);
+  std::vector< std::vector<collocationComplex> > M(s, std::vector<collocationComplex>(n*n));
+  std::vector< std::vector<size_t> > pivot(s);
+  std::vector<collocationComplex> W(s*n);
+
+  for (size_t step = 0; step < nStep; step++)
+  {
+    const double t = t0 + step*h;
+
+    //(I - h lambda_k J) for every eigenvalue
+    jacobian (t, &y[0], &J[0]);
+    bool singular = false;
+    for (size_t k = 0; k < s; k++)
+    {
+      for (size_t i = 0; i < n*n; i++)
+        M[k][i] = -h*tableau.eigenvalue[k]*J[i];
+      for (size_t i = 0; i < n; i++)
+        M[k][i*n+i] += 1.0;
+      singular = singular || !collocationLU (M[k], n, pivot[k]);
+    }
+
+    std::fill(Z.begin(), Z.end(), 0.0);
+    bool converged = false;
+    double previous = HUGE_VAL;
+    for (size_t iteration = 0; !singular && (iteration < collocationMaxNewton); iteration++)
+    {
+      //G = -Z + h (A x I) F(y + Z)
+      for (size_t i = 0; i < s; i++)
+      {
+        for (size_t m = 0; m < n; m++)
+          Y[m] = y[m] + Z[i*n+m];
+        f (t + tableau.c[i]*h, &Y[0], &F[i*n]);
+      }
+      for (size_t i = 0; i < s; i++)
+        for (size_t m = 0; m < n; m++)
+        {
+          double sum = 0.0;
+          for (size_t j = 0; j < s; j++)
+            sum += tableau.A[i*s+j]*F[j*n+m];
+          G[i*n+m] = h*sum - Z[i*n+m];
+        }
+
+      //dW = (I - h Lambda x J)^-1 (Tinv x I) G, dZ = Re (T x I) dW
+      for (size_t k = 0; k < s; k++)
+      {
+        for (size_t m = 0; m < n; m++)
+        {
+          collocationComplex sum = 0.0;
+          for (size_t j = 0; j < s; j++)
+            sum += tableau.Tinv[k*s+j]*G[j*n+m];
+          W[k*n+m] = sum;
+        }
+        collocationSolve (M[k], n, pivot[k], &W[k*n]);
+      }
+
+      double change = 0.0, norm = 0.0;
+      for (size_t i = 0; i < s; i++)
+        for (size_t m = 0; m < n; m++)
+        {
+          collocationComplex sum = 0.0;
+          for (size_t k = 0; k < s; k++)
+            sum += tableau.T[i*s+k]*W[k*n+m];
+          Z[i*n+m] += sum.real();
+          change = std::max(change, fabs(sum.real()));
+          norm   = std::max(norm, fabs(y[m]) + fabs(Z[i*n+m]));
+        }
+      //converged, or stagnating at the rounding level
+      if ((change <= collocationNewtonTolerance*norm) ||
+          ((change >= previous) && (change <= collocationNewtonStagnation*norm)))
+      {
+        converged = true;
+        break;
+      }
+      previous = change;
+    }
+    if (!converged)
+    {
+      std::cout << "Error in collocationIntegrate. Newton did not converge at t = " << t << "\n";
+      return false;
+    }
+
+    for (size_t m = 0; m < n; m++)
+    {
+      if (stifflyAccurate)
+        y[m] += Z[(s-1)*n+m];
+      else
+      {
+        double sum = 0.0;
+        for (size_t j = 0; j < s; j++)
+          sum += d[j]*Z[j*n+m];
+        y[m] += sum;
+      }
+    }
+  }
+
+  return true;
+}
+
+}//end namespace quadgrid
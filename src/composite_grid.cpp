@@ -0,0 +1,247 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+#include <cstdlib>
+#include <cmath>
+
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include <quadgrid/composite_grid.hpp>
+#include <quadgrid/gauss_legendre_grid.hpp>
+
+
+namespace quadgrid
+{
+//elements per OpenMP chunk
+static const size_t compositeChunk = 16;
+
+//reference Gauss-Legendre rules on [-1, 1], one copy per order
+struct compositeRule
+{
+  std::vector<double> x;
+  std::vector<double> w;
+};
+
+struct compositeTable
+{
+  std::mutex mutex;
+  std::map<size_t, compositeRule> rule;
+
+  const compositeRule* get (const size_t N)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = rule.find(N);
+    if (it != rule.end())
+      return &it->second;
+
+    compositeRule r;
+    if (!gaussLegendreGridTabulated (N) || !gaussLegendreGrid (N, r.x, r.w, -1.0, 1.0))
+      return NULL;
+    r.x.resize(N);
+    r.w.resize(N);
+
+    return &(rule[N] = r);
+  }
+};
+
+static compositeTable& getCompositeTable ()
+{
+  static compositeTable table;
+  return table;
+}
+
+
+
+static bool compositeMesh (const char *name, const std::vector<double>& breakpoint,
+  const std::vector<size_t>& order, std::vector<const compositeRule*>& rule)
+//checks one dimension of a mesh and resolves rule[i] for order[i]
+{
+  const size_t nElement = (breakpoint.size() > 1) ? breakpoint.size()-1 : 0;
+  if ((nElement == 0) || ((order.size() != 1) && (order.size() != nElement)))
+  {
+    std::cout << "Error in " << name << ". breakpoint.size() = " << breakpoint.size();
+    std::cout << " order.size() = " << order.size() << "\n";
+    return false;
+  }
+
+  for (size_t e = 0; e < nElement; e++)
+    if (!(breakpoint[e] < breakpoint[e+1]))
+    {
+      std::cout << "Error in " << name << ". breakpoints are not strictly ascending at " << e << "\n";
+      return false;
+    }
+
+  rule.resize(order.size());
+  for (size_t i = 0; i < order.size(); i++)
+  {
+    rule[i] = getCompositeTable().get (order[i]);
+    if (rule[i] == NULL)
+    {
+      std::cout << "Error in " << name << ". order = " << order[i] << " is not supported\n";
+      return false;
+    }
+  }
+
+  return true;
+}
+
+static double compositePairwiseSum (const double *v, const size_t n)
+//pairwise summation in a fixed order (independent of the thread count)
+{
+  if (n <= 8)
+  {
+    double sum = 0.0;
+    for (size_t i = 0; i < n; i++)
+      sum += v[i];
+    return sum;
+  }
+  const size_t half = n/2;
+  return compositePairwiseSum (v, half) + compositePairwiseSum (v + half, n - half);
+}
+
+static double compositeTensorSum (const std::function<double(const double*)>& f,
+  const std::vector<const compositeRule*>& rule, const std::vector<double>& c1,
+  const std::vector<double>& c2, const size_t d, double *pt)
+//Sum{ w[i_d] .. w[i_D-1] f(pt) } over the dimensions d .. D-1 of one element
+{
+  const compositeRule& r = *rule[d];
+  const size_t n = r.x.size();
+
+  double sum = 0.0;
+  for (size_t i = 0; i < n; i++)
+  {
+    pt[d] = c1[d]*r.x[i] + c2[d];
+    const double g = (d+1 == rule.size()) ? f(pt) : compositeTensorSum (f, rule, c1, c2, d+1, pt);
+    sum += r.w[i]*g;
+  }
+  return c1[d]*sum;
+}
+
+
+
+bool compositeGaussLegendreGrid (const std::vector<double>& breakpoint,
+  const std::vector<size_t>& order, std::vector<double>& x, std::vector<double>& w)
+//input:  breakpoint[nElement+1], order[1] or order[nElement]
+//output: x[] and w[] = nodes and weights of all elements
+{
+  std::vector<const compositeRule*> rule;
+  if (!compositeMesh ("compositeGaussLegendreGrid", breakpoint, order, rule))
+    return false;
+
+  const size_t nElement = breakpoint.size()-1;
+  x.clear();
+  w.clear();
+  for (size_t e = 0; e < nElement; e++)
+  {
+    const compositeRule& r = *rule[(rule.size() == 1) ? 0 : e];
+    const double c1 = 0.5*(breakpoint[e+1] - breakpoint[e]);
+    const double c2 = 0.5*(breakpoint[e+1] + breakpoint[e]);
+    for (size_t i = 0; i < r.x.size(); i++)
+    {
+      x.push_back(c1*r.x[i] + c2);
+      w.push_back(c1*r.w[i]);
+    }
+  }
+
+  return true;
+}
+
+bool compositeGaussLegendreIntegrate (const std::function<double(double)>& f,
+  const std::vector<double>& breakpoint, const std::vector<size_t>& order,
+  double& integral)
+//input:  f, breakpoint[nElement+1], order[1] or order[nElement]
+//output: integral = Sum over elements of the mapped Gauss-Legendre sums
+{
+  std::vector<const compositeRule*> rule;
+  if (!compositeMesh ("compositeGaussLegendreIntegrate", breakpoint, order, rule))
+    return false;
+
+  const size_t nElement = breakpoint.size()-1;
+  std::vector<double> elementSum(nElement);
+
+  #pragma omp parallel for schedule(dynamic, compositeChunk)
+  for (size_t e = 0; e < nElement; e++)
+  {
+    const compositeRule& r = *rule[(rule.size() == 1) ? 0 : e];
+    const double c1 = 0.5*(breakpoint[e+1] - breakpoint[e]);
+    const double c2 = 0.5*(breakpoint[e+1] + breakpoint[e]);
+
+    double sum = 0.0;
+    for (size_t i = 0; i < r.x.size(); i++)
+      sum += r.w[i]*f(c1*r.x[i] + c2);
+    elementSum[e] = c1*sum;
+  }
+
+  integral = compositePairwiseSum (&elementSum[0], nElement);
+
+  return true;
+}
+
+bool compositeGaussLegendreIntegrateTensor (const std::function<double(const double*)>& f,
+  const std::vector< std::vector<double> >& breakpoint,
+  const std::vector< std::vector<size_t> >& order, double& integral)
+//input:  f, breakpoint[D][nElement_d+1], order[D][1] or order[D][nElement_d]
+//output: integral = Sum over the tensor elements of the mapped Gauss-Legendre sums
+{
+  const size_t D = breakpoint.size();
+  if ((D == 0) || (order.size() != D))
+  {
+    std::cout << "Error in compositeGaussLegendreIntegrateTensor. breakpoint.size() = " << D;
+    std::cout << " order.size() = " << order.size() << "\n";
+    return false;
+  }
+
+  std::vector< std::vector<const compositeRule*> > rule(D);
+  size_t nElement = 1;
+  for (size_t d = 0; d < D; d++)
+  {
+    if (!compositeMesh ("compositeGaussLegendreIntegrateTensor", breakpoint[d], order[d], rule[d]))
+      return false;
+    nElement *= breakpoint[d].size()-1;
+  }
+
+  std::vector<double> elementSum(nElement);
+
+  #pragma omp parallel
+  {
+    std::vector<const compositeRule*> r(D);
+    std::vector<double> c1(D), c2(D), pt(D);
+
+    #pragma omp for schedule(dynamic, compositeChunk)
+    for (size_t e = 0; e < nElement; e++)
+    {
+      //element index, last dimension fastest
+      size_t index = e;
+      for (size_t d = D; d-- > 0;)
+      {
+        const size_t n = breakpoint[d].size()-1;
+        const size_t k = index % n;
+        index /= n;
+
+        r[d]  = rule[d][(rule[d].size() == 1) ? 0 : k];
+        c1[d] = 0.5*(breakpoint[d][k+1] - breakpoint[d][k]);
+        c2[d] = 0.5*(breakpoint[d][k+1] + breakpoint[d][k]);
+      }
+
+      elementSum[e] = compositeTensorSum (f, r, c1, c2, 0, &pt[0]);
+    }
+  }
+
+  integral = compositePairwiseSum (&elementSum[0], nElement);
+
+  return true;
+}
+
+}//end namespace quadgrid
@@ -0,0 +1,243 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+#include <cstdlib>
+#include <cmath>
+
+#include <iostream>
+#include <mutex>
+#include <vector>
+
+#include <quadgrid/double_exponential.hpp>
+#include <quadgrid/constant.hpp>
+
+
+namespace quadgrid
+{
+//finest level (step 2^-12 in t)
+static const size_t doubleExponentialMaxLevel = 12;
+
+//nodes with a complement or exponential below this are dropped (weights ~ 1e-300)
+static const double doubleExponentialTiny = 1.0E-300;
+
+//node t > 0 of a level: tanh-sinh complement 1 - tanh(v) and weight, exp-sinh exp(+-v)
+//and weights, v = Pi/2 sinh(t); level 0 holds t = 0, 1, 2, .. and level l > 0 the odd
+//multiples of 2^-l
+struct doubleExponentialNode
+{
+  double complement;
+  double weight;
+  double expPlus;
+  double weightPlus;
+  double expMinus;
+  double weightMinus;
+};
+
+struct doubleExponentialTable
+{
+  std::mutex mutex;
+  std::vector< std::vector<doubleExponentialNode> > level;
+
+  //the levels never move: callers keep using a level while nested integrals add finer ones
+  doubleExponentialTable () { level.reserve(doubleExponentialMaxLevel+1); }
+
+  const std::vector<doubleExponentialNode>& get (const size_t l)
+  //input:  l <= doubleExponentialMaxLevel
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    while (level.size() <= l)
+    {
+      const size_t n    = level.size();
+      const double h    = ldexp(1.0, -(int) n);
+      const size_t step = (n == 0) ? 1 : 2;
+
+      std::vector<doubleExponentialNode> node;
+      for (size_t k = (n == 0) ? 0 : 1;; k += step)
+      {
+        const double t = k*h;
+        const double v = 0.5*Pi*sinh(t);
+        const double c = 0.5*Pi*cosh(t);
+        if (v > 690.0)
+          break;
+
+        doubleExponentialNode d;
+        const double ev = exp(v);
+        const double em = exp(-v);
+        const double ch = 0.5*(ev + em);
+        d.complement  = em/ch;            //1 - tanh(v) = exp(-v)/cosh(v)
+        d.weight      = c/(ch*ch);
+        d.expPlus     = ev;
+        d.weightPlus  = c*ev;
+        d.expMinus    = em;
+        d.weightMinus = c*em;
+        if ((d.complement < doubleExponentialTiny) && (em < doubleExponentialTiny))
+          break;
+
+        node.push_back(d);
+      }
+      level.push_back(node);
+    }
+    return level[l];
+  }
+};
+
+static doubleExponentialTable& getDoubleExponentialTable ()
+{
+  static doubleExponentialTable table;
+  return table;
+}
+
+
+
+static bool doubleExponentialCheck (const char *name, const double relTol, const double absTol,
+  const size_t maxLevel)
+{
+  if ((relTol < 0.0) || (absTol < 0.0) || (maxLevel > doubleExponentialMaxLevel))
+  {
+    std::cout << "Error in " << name << ". relTol = " << relTol << " absTol = " << absTol;
+    std::cout << " maxLevel = " << maxLevel << " (at most " << doubleExponentialMaxLevel << ")\n";
+    return false;
+  }
+  return true;
+}
+
+static bool doubleExponentialLevels (const std::function<double(const doubleExponentialNode&,
+  const bool)>& sumNode, const double relTol, const double absTol, const size_t maxLevel,
+  double& integral, double& error)
+//runs the levels 0 .. maxLevel; sumNode(node, center) returns the weighted evaluations of
+//one node t (both signs of t, center = t is 0)
+{
+  double sum = 0.0;
+  integral   = 0.0;
+  error      = 0.0;
+  for (size_t l = 0; l <= maxLevel; l++)
+  {
+    const std::vector<doubleExponentialNode>& node = getDoubleExponentialTable().get (l);
+    for (size_t k = 0; k < node.size(); k++)
+      sum += sumNode (node[k], (l == 0) && (k == 0));
+
+    const double estimate = ldexp(sum, -(int) l);
+    error    = (l == 0) ? fabs(estimate) : fabs(estimate - integral);
+    integral = estimate;
+
+    //the level-1 estimate can agree with level 0 by accident; check from level 2 on
+    const double tol = (absTol > relTol*fabs(integral)) ? absTol : relTol*fabs(integral);
+    if ((l >= 2) && (error <= tol))
+      return true;
+  }
+  return false;
+}
+
+
+
+bool tanhSinhIntegrateDistance (const std::function<double(double, double)>& f,
+  const double a, const double b, const double relTol, const double absTol,
+  const size_t maxLevel, double& integral, double& error, size_t& nEvaluation)
+//input:  f(x, d) = integrand, [a, b] interval, relTol and absTol = tolerances, maxLevel
+//output: integral, error = estimate, nEvaluation = number of evaluations
+{
+  nEvaluation = 0;
+  if (!doubleExponentialCheck ("tanhSinhIntegrateDistance", relTol, absTol, maxLevel))
+    return false;
+
+  const double half = 0.5*(b - a);
+  const double c    = 0.5*(a + b);
+  if (half == 0.0)
+  {
+    integral = 0.0;
+    error    = 0.0;
+    return true;
+  }
+
+  auto sumNode = [&](const doubleExponentialNode& node, const bool center) -> double
+  {
+    if (center)
+    {
+      nEvaluation++;
+      return node.weight*f(c, fabs(half));
+    }
+    if (node.complement < doubleExponentialTiny)
+      return 0.0;
+
+    //x = a + half (1 - tanh) and x = b - half (1 - tanh)
+    const double d = half*node.complement;
+    nEvaluation += 2;
+    return node.weight*(f(a + d, fabs(d)) + f(b - d, fabs(d)));
+  };
+
+  const bool converged = doubleExponentialLevels (sumNode, relTol, absTol/fabs(half),
+    maxLevel, integral, error);
+  integral *= half;
+  error    *= fabs(half);
+
+  return converged;
+}
+
+bool tanhSinhIntegrate (const std::function<double(double)>& f, const double a,
+  const double b, const double relTol, const double absTol, const size_t maxLevel,
+  double& integral, double& error, size_t& nEvaluation)
+//input:  f = integrand, [a, b] interval, relTol and absTol = tolerances, maxLevel
+//output: integral, error = estimate, nEvaluation = number of evaluations
+{
+  const double lo = (a < b) ? a : b;
+  const double hi = (a < b) ? b : a;
+  size_t nSkip = 0;
+  auto g = [&](const double x, const double) -> double
+  {
+    //nodes that round to an endpoint are skipped
+    if ((x > lo) && (x < hi))
+      return f(x);
+    nSkip++;
+    return 0.0;
+  };
+
+  const bool converged = tanhSinhIntegrateDistance (g, a, b, relTol, absTol, maxLevel,
+    integral, error, nEvaluation);
+  nEvaluation -= nSkip;
+
+  return converged;
+}
+
+bool expSinhIntegrate (const std::function<double(double)>& f, const double a,
+  const double relTol, const double absTol, const size_t maxLevel,
+  double& integral, double& error, size_t& nEvaluation)
+//input:  f = integrand, a = lower bound, relTol and absTol = tolerances, maxLevel
+//output: integral over [a, inf), error = estimate, nEvaluation = number of evaluations
+{
+  nEvaluation = 0;
+  if (!doubleExponentialCheck ("expSinhIntegrate", relTol, absTol, maxLevel))
+    return false;
+
+  auto sumNode = [&](const doubleExponentialNode& node, const bool center) -> double
+  {
+    if (center)
+    {
+      nEvaluation++;
+      return node.weightPlus*f(a + node.expPlus);
+    }
+
+    nEvaluation++;
+    double sum = node.weightPlus*f(a + node.expPlus);
+
+    const double x = a + node.expMinus;
+    if ((node.expMinus > doubleExponentialTiny) && (x > a))
+    {
+      nEvaluation++;
+      sum += node.weightMinus*f(x);
+    }
+    return sum;
+  };
+
+  return doubleExponentialLevels (sumNode, relTol, absTol, maxLevel, integral, error);
+}
+
+}//end namespace quadgrid
@@ -0,0 +1,262 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+#include <cstdlib>
+#include <cmath>
+
+#include <complex>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include <quadgrid/fast_legendre_transform.hpp>
+#include <quadgrid/chebyshev_legendre.hpp>
+#include <quadgrid/gauss_legendre_grid.hpp>
+#include <quadgrid/gauss_family_grid.hpp>
+#include <quadgrid/legendre.hpp>
+#include <quadgrid/fft.hpp>
+#include <quadgrid/constant.hpp>
+
+
+namespace quadgrid
+{
+typedef std::complex<double> fastLegendreComplex;
+
+
+
+//nonuniform cosine transform plan on theta[j] = arccos(x[j]) of the Gauss-Legendre nodes
+//  theta[j] = 2 Pi bin[j]/L + delta[j],  |delta[j]| <= Pi/L,  L = power of two >= 2N
+//  e^(ik theta[j]) = e^(2 Pi i k bin[j]/L) phase[j] Sum{ (i a[j])^p/p! b[k]^p }
+//  with phase[j] = e^(i N delta[j]/2), a[j] = N delta[j]/2 and b[k] = (k - N/2)/(N/2)
+struct fastLegendrePlan
+{
+  size_t L;
+  size_t nTerm;
+  std::vector<double> weight;
+  std::vector<size_t> bin;
+  std::vector<double> a;
+  std::vector<fastLegendreComplex> phase;
+  std::vector<double> b;
+};
+
+struct fastLegendreTable
+{
+  std::mutex mutex;
+  std::map<size_t, fastLegendrePlan> plan;
+
+  const fastLegendrePlan* get (const size_t N)
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      auto it = plan.find(N);
+      if (it != plan.end())
+        return &it->second;
+    }
+
+    fastLegendrePlan p;
+    std::vector<double> x;
+
+    //tabulated nodes with the weights recomputed from the nodes (see legendreForward)
+    if (gaussLegendreGridTabulated (N))
+    {
+      if (!gaussLegendreGrid (N, x, p.weight, -1.0, 1.0))
+        return NULL;
+      x.resize(N);
+      p.weight.resize(N);
+      std::vector<double> P, dPdx;
+      for (size_t j = 0; j < N; j++)
+      {
+        legendrePoly (P, dPdx, x[j], N);
+        p.weight[j] = 2.0/((1.0 - x[j])*(1.0 + x[j])*dPdx[N]*dPdx[N]);
+      }
+    }
+    else if (!gaussJacobiGrid (N, x, p.weight, 0.0, 0.0, -1.0, 1.0))
+      return NULL;
+
+    p.L = 1;
+    while (p.L < 2*N)
+      p.L <<= 1;
+
+    p.bin.resize(N);
+    p.a.resize(N);
+    p.phase.resize(N);
+    double aMax = 0.0;
+    for (size_t j = 0; j < N; j++)
+    {
+      const double theta = acos(x[j]);
+      const double s     = floor(theta*p.L/(2.0*Pi) + 0.5);
+      const double delta = theta - 2.0*Pi*s/p.L;
+      p.bin[j]   = ((size_t) s) % p.L;
+      p.a[j]     = 0.5*N*delta;
+      p.phase[j] = fastLegendreComplex(cos(p.a[j]), sin(p.a[j]));
+      if (aMax < fabs(p.a[j])) aMax = fabs(p.a[j]);
+    }
+
+    //number of Taylor terms: aMax^P/P! <= 1.0E-17 (aMax <= Pi/4)
+    p.nTerm = 1;
+    double term = 1.0;
+    while ((term > 1.0E-17) && (p.nTerm < 40))
+    {
+      term *= aMax/p.nTerm;
+      p.nTerm++;
+    }
+
+    p.b.resize(N);
+    for (size_t k = 0; k < N; k++)
+      p.b[k] = (k - 0.5*N)/(0.5*N);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = plan.insert(std::make_pair(N, p)).first;
+    return &it->second;
+  }
+};
+
+static fastLegendreTable& getFastLegendreTable ()
+{
+  static fastLegendreTable table;
+  return table;
+}
+
+
+
+static void fastLegendreMoment (const fastLegendrePlan& p, const size_t N,
+  const double *f, std::vector<double>& t)
+//t[k] = Sum{ w[j] f[j] cos(k theta[j]) }, k < N
+{
+  const size_t P = p.nTerm;
+
+  std::vector<fastLegendreComplex> term(N);
+  for (size_t j = 0; j < N; j++)
+    term[j] = p.weight[j]*f[j]*p.phase[j];
+
+  //H[q][k] = Sum{ e^(2 Pi i k bin[j]/L) term_q[j] },  term_q[j] = w f phase (i a)^q/q!
+  std::vector<fastLegendreComplex> H(P*N);
+  std::vector<fastLegendreComplex> h(p.L);
+  for (size_t q = 0; q < P; q++)
+  {
+    std::fill(h.begin(), h.end(), fastLegendreComplex(0.0, 0.0));
+    for (size_t j = 0; j < N; j++)
+      h[p.bin[j]] += term[j];
+    fft (h, true);
+    for (size_t k = 0; k < N; k++)
+      H[q*N+k] = h[k];
+
+    //term *= i a/(q+1)
+    for (size_t j = 0; j < N; j++)
+    {
+      const double c = p.a[j]/(q + 1.0);
+      term[j] = fastLegendreComplex(-c*term[j].imag(), c*term[j].real());
+    }
+  }
+
+  //Horner in b[k]
+  t.resize(N);
+  for (size_t k = 0; k < N; k++)
+  {
+    double acc = H[(P-1)*N+k].real();
+    for (size_t q = P-1; q-- > 0;)
+      acc = acc*p.b[k] + H[q*N+k].real();
+    t[k] = acc;
+  }
+}
+
+static void fastLegendreEvaluate (const fastLegendrePlan& p, const size_t N,
+  const std::vector<double>& a, double *f)
+//f[j] = Sum{ a[k] cos(k theta[j]) }, k < N
+{
+  const size_t P = p.nTerm;
+
+  std::vector<double> v(a);
+  std::vector<fastLegendreComplex> Q(P*N);
+  std::vector<fastLegendreComplex> h(p.L);
+  for (size_t q = 0; q < P; q++)
+  {
+    std::fill(h.begin(), h.end(), fastLegendreComplex(0.0, 0.0));
+    for (size_t k = 0; k < N; k++)
+      h[k] = v[k];
+    fft (h, true);
+    for (size_t j = 0; j < N; j++)
+      Q[q*N+j] = h[p.bin[j]];
+
+    for (size_t k = 0; k < N; k++)
+      v[k] *= p.b[k];
+  }
+
+  //Horner in i a[j]/(q+1)
+  for (size_t j = 0; j < N; j++)
+  {
+    fastLegendreComplex acc = Q[(P-1)*N+j];
+    for (size_t q = P-1; q-- > 0;)
+    {
+      const double c = p.a[j]/(q + 1.0);
+      acc = Q[q*N+j] + fastLegendreComplex(-c*acc.imag(), c*acc.real());
+    }
+    f[j] = acc.real()*p.phase[j].real() - acc.imag()*p.phase[j].imag();
+  }
+}
+
+
+
+bool legendreForwardFast (const size_t N, const std::vector<double>& f, const size_t nVector,
+  std::vector<double>& c)
+//input:  N = order, f[nVector*N] = nodal values
+//output: c[nVector*N] = Legendre coefficients
+{
+  const fastLegendrePlan* p = (N > 0) ? getFastLegendreTable().get (N) : NULL;
+  if ((p == NULL) || (f.size() != nVector*N))
+  {
+    std::cout << "Error in legendreForwardFast. N = " << N << " f.size() = " << f.size();
+    std::cout << " nVector = " << nVector << "\n";
+    return false;
+  }
+
+  c.resize(nVector*N);
+  std::vector<double> t, cv;
+  for (size_t v = 0; v < nVector; v++)
+  {
+    fastLegendreMoment (*p, N, &f[v*N], t);
+    chebyshevMomentToLegendre (t, cv);
+    for (size_t n = 0; n < N; n++)
+      c[v*N+n] = cv[n];
+  }
+
+  return true;
+}
+
+bool legendreInverseFast (const size_t N, const std::vector<double>& c, const size_t nVector,
+  std::vector<double>& f)
+//input:  N = order, c[nVector*N] = Legendre coefficients
+//output: f[nVector*N] = nodal values
+{
+  const fastLegendrePlan* p = (N > 0) ? getFastLegendreTable().get (N) : NULL;
+  if ((p == NULL) || (c.size() != nVector*N))
+  {
+    std::cout << "Error in legendreInverseFast. N = " << N << " c.size() = " << c.size();
+    std::cout << " nVector = " << nVector << "\n";
+    return false;
+  }
+
+  f.resize(nVector*N);
+  std::vector<double> cv(N), a;
+  for (size_t v = 0; v < nVector; v++)
+  {
+    for (size_t n = 0; n < N; n++)
+      cv[n] = c[v*N+n];
+    legendreToChebyshev (cv, a);
+    fastLegendreEvaluate (*p, N, a, &f[v*N]);
+  }
+
+  return true;
+}
+
+}//end namespace quadgrid
@@ -0,0 +1,197 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+#include <cstdlib>
+#include <cmath>
+
+#include <complex>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include <quadgrid/fft.hpp>
+#include <quadgrid/constant.hpp>
+
+
+namespace quadgrid
+{
+typedef std::complex<double> fftComplex;
+
+//cached radix-2 twiddle factors of every stage and Bluestein chirps
+struct fftTable
+{
+  std::mutex mutex;
+  std::map< size_t, std::vector<fftComplex> > twiddle;
+  std::map< size_t, std::vector<fftComplex> > chirp;     //e^(-pi i k^2/n), k < n
+  std::map< size_t, std::vector<fftComplex> > chirpFFT;  //transform of the conjugate chirp
+
+  const std::vector<fftComplex>& getTwiddle (const size_t n)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = twiddle.find(n);
+    if (it != twiddle.end())
+      return it->second;
+
+    //stage with half-length h uses e^(-2 pi i k/(2h)), k < h, stored at h-1+k
+    std::vector<fftComplex>& t = twiddle[n];
+    t.resize((n > 1) ? n-1 : 1);
+    for (size_t h = 1; h < n; h <<= 1)
+      for (size_t k = 0; k < h; k++)
+      {
+        const double theta = -Pi*k/h;
+        t[h-1+k] = fftComplex(cos(theta), sin(theta));
+      }
+    return t;
+  }
+};
+
+static fftTable& getFFTTable ()
+{
+  static fftTable table;
+  return table;
+}
+
+
+
+static void fftRadix2 (std::vector<fftComplex>& data)
+//in-place forward transform, data.size() = power of two
+{
+  const size_t n = data.size();
+  if (n <= 1)
+    return;
+
+  //bit reversal
+  for (size_t i = 1, j = 0; i < n; i++)
+  {
+    size_t bit = n >> 1;
+    for (; j & bit; bit >>= 1)
+      j ^= bit;
+    j ^= bit;
+    if (i < j)
+      std::swap(data[i], data[j]);
+  }
+
+  //butterflies on the interleaved (re, im) doubles with contiguous per-stage twiddles
+  const std::vector<fftComplex>& t = getFFTTable().getTwiddle (n);
+  const double *tw = reinterpret_cast<const double*>(&t[0]);
+  double *z = reinterpret_cast<double*>(&data[0]);
+  for (size_t half = 1; half < n; half <<= 1)
+  {
+    const double *w = &tw[2*(half-1)];
+    for (size_t i = 0; i < n; i += 2*half)
+    {
+      double *u = &z[2*i];
+      double *v = &z[2*(i+half)];
+      for (size_t k = 0; k < half; k++)
+      {
+        const double vr = v[2*k]*w[2*k]   - v[2*k+1]*w[2*k+1];
+        const double vi = v[2*k]*w[2*k+1] + v[2*k+1]*w[2*k];
+        v[2*k]    = u[2*k]   - vr;
+        v[2*k+1]  = u[2*k+1] - vi;
+        u[2*k]   += vr;
+        u[2*k+1] += vi;
+      }
+    }
+  }
+}
+
+static void fftBluestein (std::vector<fftComplex>& data)
+//in-place forward transform of arbitrary length via a power-of-two convolution
+{
+  const size_t n = data.size();
+  size_t m = 1;
+  while (m < 2*n-1)
+    m <<= 1;
+
+  fftTable& table = getFFTTable();
+  const std::vector<fftComplex>* chirp;
+  const std::vector<fftComplex>* chirpFFT;
+  {
+    std::unique_lock<std::mutex> lock(table.mutex);
+    auto it = table.chirp.find(n);
+    if (it == table.chirp.end())
+    {
+      lock.unlock();
+
+      std::vector<fftComplex> c(n);
+      for (size_t k = 0; k < n; k++)
+      {
+        //k^2 mod 2n keeps the phase argument small
+        const size_t k2 = (size_t) ((unsigned long long) k*k % (2ULL*n));
+        const double theta = -Pi*k2/n;
+        c[k] = fftComplex(cos(theta), sin(theta));
+      }
+
+      std::vector<fftComplex> b(m, fftComplex(0.0, 0.0));
+      b[0] = std::conj(c[0]);
+      for (size_t k = 1; k < n; k++)
+      {
+        b[k]   = std::conj(c[k]);
+        b[m-k] = std::conj(c[k]);
+      }
+      fftRadix2 (b);
+
+      //another thread may have stored the chirp of n meanwhile and handed it out: keep it
+      lock.lock();
+      it = table.chirp.emplace(n, c).first;
+      table.chirpFFT.emplace(n, b);
+    }
+    chirp    = &it->second;
+    chirpFFT = &table.chirpFFT[n];
+  }
+
+  std::vector<fftComplex> a(m, fftComplex(0.0, 0.0));
+  for (size_t k = 0; k < n; k++)
+    a[k] = data[k]*(*chirp)[k];
+
+  fftRadix2 (a);
+  for (size_t k = 0; k < m; k++)
+    a[k] = std::conj(a[k]*(*chirpFFT)[k]);
+  fftRadix2 (a);
+
+  const double scale = 1.0/m;
+  for (size_t k = 0; k < n; k++)
+    data[k] = std::conj(a[k])*scale*(*chirp)[k];
+}
+
+
+
+bool fft (std::vector<fftComplex>& data, const bool inverse)
+//input:  data[n], inverse = direction
+//output: data[n] = unnormalized discrete Fourier transform
+{
+  const size_t n = data.size();
+  if (n == 0)
+  {
+    std::cout << "Error in fft. n = 0\n";
+    return false;
+  }
+
+  //inverse transform = conj(forward(conj(data)))
+  if (inverse)
+    for (size_t k = 0; k < n; k++)
+      data[k] = std::conj(data[k]);
+
+  if ((n & (n-1)) == 0)
+    fftRadix2 (data);
+  else
+    fftBluestein (data);
+
+  if (inverse)
+    for (size_t k = 0; k < n; k++)
+      data[k] = std::conj(data[k]);
+
+  return true;
+}
+
+}//end namespace quadgrid
@@ -0,0 +1,236 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+#include <cstdlib>
+#include <cmath>
+
+#include <algorithm>
+#include <complex>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <quadgrid/gaunt.hpp>
+#include <quadgrid/sphere_transform.hpp>
+#include <quadgrid/spherical_harmonic.hpp>
+#include <quadgrid/unit_sphere_grid_gauss_legendre.hpp>
+
+
+namespace quadgrid
+{
+typedef std::complex<double> gauntComplex;
+
+//largest degree of gauntTable, 1.4e7 entries of 24 bytes
+static const size_t gauntMaxLmax = 40;
+
+static void gauntCompute (const size_t lmax, std::vector<gauntEntry>& table)
+//input:  lmax
+//output: table of the nonzero Gaunt coefficients, ordered by m1, m2, l1, l2, l3
+{
+  size_t nRing;
+  std::vector<double> theta, w, phi;
+  unitSphereGaussLegendre (3*lmax, nRing, theta, w, phi);
+
+  //P(l1,m1) P(l2,m2) P(l3,m3) has the parity (-1)^(l1+l2+l3) = 1 on the mirror ring at
+  //pi - theta, so the rings i < N = (nRing+1)/2 count twice except for the equator
+  const size_t N = (nRing+1)/2;
+
+  //P[k*N + i] = P(l,m)(theta[i]) at k = sphereHarmonicArrayIndex(l, m), 2 Pi w_GL = 2N w_theta
+  const size_t size = sphereHarmonicArraySize (lmax);
+  std::vector<double> P(size*N), wP(size*N);
+  std::vector<gauntComplex> Y;
+  for (size_t i = 0; i < N; i++)
+  {
+    const double weight = ((i == nRing-1-i) ? 1.0 : 2.0)*2.0*nRing*w[i];
+    sphereHarmonic (Y, lmax, theta[i], 0.0);
+    for (size_t k = 0; k < size; k++)
+    {
+      P[k*N+i]  = Y[k].real();
+      wP[k*N+i] = weight*Y[k].real();
+    }
+  }
+
+  const int L = (int) lmax;
+  std::vector< std::vector<gauntEntry> > block(2*L+1);
+
+  #pragma omp parallel
+  {
+    std::vector<double> product(N);
+
+    #pragma omp for schedule(dynamic)
+    for (int m1 = -L; m1 <= L; m1++)
+    {
+      std::vector<gauntEntry>& entry = block[m1+L];
+      for (int m2 = std::max(-L, -m1); m2 <= std::min(L, L-m1); m2++)
+      {
+        const int m3 = m1 + m2;
+        const size_t a1 = std::abs(m1), a2 = std::abs(m2);
+        //Y(l,-m) = (-1)^m conj(Y(l,m))
+        const double sign = (((m1 < 0) ? a1 : 0) + ((m2 < 0) ? a2 : 0)) % 2 == 0 ? 1.0 : -1.0;
+        for (size_t l1 = a1; l1 <= lmax; l1++)
+          for (size_t l2 = a2; l2 <= lmax; l2++)
+          {
+            const double *p1 = &wP[sphereHarmonicArrayIndex (l1, a1)*N];
+            const double *p2 = &P[sphereHarmonicArrayIndex (l2, a2)*N];
+            for (size_t i = 0; i < N; i++)
+              product[i] = sign*p1[i]*p2[i];
+
+            size_t l3 = std::max((size_t) m3, (l1 > l2) ? l1-l2 : l2-l1);
+            if ((l1 + l2 + l3) % 2 != 0)
+              l3++;
+            for (; l3 <= std::min(l1+l2, lmax); l3 += 2)
+            {
+              const size_t index3 = sphereHarmonicArrayIndex (l3, m3);
+              const double *p3 = &P[index3*N];
+              double sum = 0.0;
+              for (size_t i = 0; i < N; i++)
+                sum += product[i]*p3[i];
+              gauntEntry e;
+              e.index1 = (unsigned int) gauntArrayIndex (l1, m1);
+              e.index2 = (unsigned int) gauntArrayIndex (l2, m2);
+              e.index3 = (unsigned int) index3;
+              e.value  = sum;
+              entry.push_back(e);
+            }
+          }
+      }
+    }
+  }
+
+  table.clear();
+  for (size_t b = 0; b < block.size(); b++)
+    table.insert(table.end(), block[b].begin(), block[b].end());
+}
+
+struct gauntCache
+{
+  std::mutex mutex;
+  std::map< size_t, std::shared_ptr< const std::vector<gauntEntry> > > table;
+};
+
+static gauntCache& getGauntCache ()
+{
+  static gauntCache cache;
+  return cache;
+}
+
+bool gauntTable (const size_t lmax, std::shared_ptr< const std::vector<gauntEntry> >& table)
+//input:  lmax
+//output: table
+{
+  if (lmax > gauntMaxLmax)
+  {
+    std::cout << "Error in gauntTable. lmax = " << lmax << " > " << gauntMaxLmax << "\n";
+    return false;
+  }
+
+  gauntCache& cache = getGauntCache ();
+  {
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    auto it = cache.table.find(lmax);
+    if (it != cache.table.end())
+    {
+      table = it->second;
+      return true;
+    }
+  }
+
+  std::shared_ptr< std::vector<gauntEntry> > t = std::make_shared< std::vector<gauntEntry> >();
+  gauntCompute (lmax, *t);
+
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  cache.table[lmax] = t;
+  table = t;
+  return true;
+}
+
+
+
+static bool gauntCheckSize (const char *name, const size_t lmax,
+  const std::vector<gauntComplex>& c, const size_t nVector)
+{
+  if (c.size() != nVector*sphereHarmonicArraySize (lmax))
+  {
+    std::cout << "Error in " << name << ". c.size() = " << c.size() << " != "
+      << nVector*sphereHarmonicArraySize (lmax) << "\n";
+    return false;
+  }
+  return true;
+}
+
+static void gauntFull (const size_t lmax, const size_t lmaxFull, const std::vector<gauntComplex>& c,
+  std::vector<gauntComplex>& cFull)
+//input:  lmax, lmaxFull >= lmax, c[sphereHarmonicArraySize(lmax)]
+//output: cFull[gauntArrayIndex(l, m)] for l <= lmaxFull, zero for l > lmax
+{
+  cFull.assign((lmaxFull+1)*(lmaxFull+1), 0.0);
+  for (size_t l = 0; l <= lmax; l++)
+    for (size_t m = 0; m <= l; m++)
+    {
+      const gauntComplex v = c[sphereHarmonicArrayIndex (l, m)];
+      cFull[gauntArrayIndex (l, (int) m)]  = v;
+      cFull[gauntArrayIndex (l, -(int) m)] = ((m % 2 == 0) ? 1.0 : -1.0)*std::conj(v);
+    }
+}
+
+bool sphereHarmonicProductGaunt (const size_t lmax1, const std::vector<gauntComplex>& c1,
+  const size_t lmax2, const std::vector<gauntComplex>& c2, const size_t lmax3,
+  std::vector<gauntComplex>& c3)
+//input:  lmax1, c1[sphereHarmonicArraySize(lmax1)], lmax2, c2, lmax3
+//output: c3[sphereHarmonicArraySize(lmax3)]
+{
+  if (!gauntCheckSize ("sphereHarmonicProductGaunt", lmax1, c1, 1) ||
+      !gauntCheckSize ("sphereHarmonicProductGaunt", lmax2, c2, 1))
+    return false;
+
+  const size_t lmax = std::max(lmax3, std::max(lmax1, lmax2));
+  std::shared_ptr< const std::vector<gauntEntry> > table;
+  if (!gauntTable (lmax, table))
+    return false;
+
+  std::vector<gauntComplex> c1Full, c2Full, c3All(sphereHarmonicArraySize (lmax), 0.0);
+  gauntFull (lmax1, lmax, c1, c1Full);
+  gauntFull (lmax2, lmax, c2, c2Full);
+  for (size_t k = 0; k < table->size(); k++)
+  {
+    const gauntEntry& e = (*table)[k];
+    c3All[e.index3] += e.value*c1Full[e.index1]*c2Full[e.index2];
+  }
+
+  //the layout of sphereHarmonicArrayIndex is ordered by degree
+  c3.assign(c3All.begin(), c3All.begin() + sphereHarmonicArraySize (lmax3));
+  return true;
+}
+
+bool sphereHarmonicProduct (const size_t lmax1, const std::vector<gauntComplex>& c1,
+  const size_t lmax2, const std::vector<gauntComplex>& c2, const size_t lmax3,
+  const size_t nVector, std::vector<gauntComplex>& c3)
+//input:  lmax1, c1[nVector*sphereHarmonicArraySize(lmax1)], lmax2, c2, lmax3, nVector
+//output: c3[nVector*sphereHarmonicArraySize(lmax3)]
+{
+  if (!gauntCheckSize ("sphereHarmonicProduct", lmax1, c1, nVector) ||
+      !gauntCheckSize ("sphereHarmonicProduct", lmax2, c2, nVector))
+    return false;
+
+  const size_t gridLmax = sphereHarmonicProductGrid (lmax1, lmax2, lmax3);
+  std::vector<double> f1, f2;
+  if (!sphereTransformInverse (lmax1, gridLmax, c1, nVector, f1) ||
+      !sphereTransformInverse (lmax2, gridLmax, c2, nVector, f2))
+    return false;
+  for (size_t k = 0; k < f1.size(); k++)
+    f1[k] *= f2[k];
+  return sphereTransformForward (lmax3, gridLmax, f1, nVector, c3);
+}
+
+}//end namespace quadgrid
@@ -0,0 +1,396 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+#include <cstdlib>
+#include <cmath>
+#include <cfloat>
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+#include <quadgrid/gauss_custom_grid.hpp>
+#include <quadgrid/gauss_legendre_grid.hpp>
+
+
+namespace quadgrid
+{
+//orders >= gaussCustomBisectionOrder use parallel Sturm bisection instead of QL
+static const size_t gaussCustomBisectionOrder = 200;
+
+
+
+static bool gaussCustomQL (const size_t N, std::vector<double>& d, std::vector<double>& e,
+  std::vector<double>& z)
+//input:  d[N] = diagonal, e[N] = off-diagonal (e[i] couples i and i+1, e[N-1] = 0)
+//output: d[N] = eigenvalues (unsorted), z[N] = first components of the eigenvectors
+//implicit QL with Wilkinson shifts; only the first row of the eigenvector matrix is
+//accumulated (Golub-Welsch), so the cost is O(N^2)
+{
+  const long n = (long) N;
+  z.assign(N, 0.0);
+  z[0] = 1.0;
+
+  for (long l = 0; l < n; l++)
+  {
+    int  iter = 0;
+    long m;
+    do
+    {
+      for (m = l; m < n-1; m++)
+      {
+        const double dd = fabs(d[m]) + fabs(d[m+1]);
+        if (fabs(e[m]) <= DBL_EPSILON*dd)
+          break;
+      }
+
+      if (m != l)
+      {
+        if (iter++ == 60)
+          return false;
+
+        double g = (d[l+1] - d[l])/(2.0*e[l]);
+        double r = hypot(g, 1.0);
+        g = d[m] - d[l] + e[l]/(g + ((g >= 0.0) ? r : -r));
+
+        double s = 1.0;
+        double c = 1.0;
+        double p = 0.0;
+        long   i;
+        for (i = m-1; i >= l; i--)
+        {
+          double f = s*e[i];
+          const double b = c*e[i];
+          r = hypot(f, g);
+          e[i+1] = r;
+          if (r == 0.0)
+          {
+            d[i+1] -= p;
+            e[m]    = 0.0;
+            break;
+          }
+          s = f/r;
+          c = g/r;
+          g = d[i+1] - p;
+          r = (d[i] - g)*s + 2.0*c*b;
+          p = s*r;
+          d[i+1] = g + p;
+          g = c*r - b;
+
+          f      = z[i+1];
+          z[i+1] = s*z[i] + c*f;
+          z[i]   = c*z[i] - s*f;
+        }
+        if ((r == 0.0) && (i >= l))
+          continue;
+
+        d[l] -= p;
+        e[l]  = g;
+        e[m]  = 0.0;
+      }
+    }
+    while (m != l);
+  }
+
+  return true;
+}
+
+static size_t gaussCustomSturmCount (const size_t N, const std::vector<double>& d,
+  const std::vector<double>& e2, const double pivmin, const double x)
+//output: number of eigenvalues < x (negative pivots of the LDL^T factorization of T - x)
+{
+  size_t count = 0;
+  double q = d[0] - x;
+  for (size_t i = 0;; i++)
+  {
+    if (fabs(q) < pivmin)
+      q = -pivmin;
+    if (q < 0.0)
+      count++;
+    if (i+1 == N)
+      break;
+    q = d[i+1] - x - e2[i]/q;
+  }
+  return count;
+}
+
+static double gaussCustomChristoffel (const size_t N, const std::vector<double>& d,
+  const std::vector<double>& e, const double x)
+//output: 1/Sum{ p_k(x)^2 } for k < N, p_k = orthonormal polynomials with p_0 = 1
+//        (the squared first component of the eigenvector for the eigenvalue x)
+{
+  double p0  = 1.0;
+  double pm1 = 0.0;
+  double sum = 1.0;
+  double logScale = 0.0;
+
+  for (size_t k = 0; k+1 < N; k++)
+  {
+    const double p1 = ((x - d[k])*p0 - ((k > 0) ? e[k-1] : 0.0)*pm1)/e[k];
+    pm1  = p0;
+    p0   = p1;
+    sum += p0*p0;
+
+    if (fabs(p0) > 1.0E100)
+    {
+      p0       *= 1.0E-100;
+      pm1      *= 1.0E-100;
+      sum      *= 1.0E-200;
+      logScale += 100.0*log(10.0);
+    }
+  }
+
+  return exp(-log(sum) - 2.0*logScale);
+}
+
+static void gaussCustomBisection (const size_t N, const std::vector<double>& d,
+  const std::vector<double>& e, std::vector<double>& x, std::vector<double>& z2)
+//output: x[N] = eigenvalues (ascending), z2[N] = squared first eigenvector components
+//each eigenvalue is bisected independently with the Sturm count, in parallel
+{
+  std::vector<double> e2(N, 0.0);
+  double lower =  DBL_MAX;
+  double upper = -DBL_MAX;
+  double emax  = 1.0;
+  for (size_t i = 0; i < N; i++)
+  {
+    const double el = (i > 0) ? fabs(e[i-1]) : 0.0;
+    const double er = (i+1 < N) ? fabs(e[i]) : 0.0;
+    if (lower > d[i] - el - er) lower = d[i] - el - er;
+    if (upper < d[i] + el + er) upper = d[i] + el + er;
+    if (i+1 < N)
+      e2[i] = e[i]*e[i];
+    if (emax < e2[i]) emax = e2[i];
+  }
+  const double pivmin = DBL_MIN*emax;
+
+  x.resize(N);
+  z2.resize(N);
+
+  #pragma omp parallel for schedule(dynamic, 16)
+  for (long k = 0; k < (long) N; k++)
+  {
+    double lo = lower;
+    double hi = upper;
+    for (int iter = 0; iter < 200; iter++)
+    {
+      const double mid = 0.5*(lo + hi);
+      const double tol = 2.0*DBL_EPSILON*std::max(fabs(lo), fabs(hi)) + pivmin;
+      if ((hi - lo <= tol) || (mid <= lo) || (mid >= hi))
+        break;
+      if (gaussCustomSturmCount (N, d, e2, pivmin, mid) >= (size_t) k+1)
+        hi = mid;
+      else
+        lo = mid;
+    }
+
+    x[k]  = 0.5*(lo + hi);
+    z2[k] = gaussCustomChristoffel (N, d, e, x[k]);
+  }
+}
+
+
+
+bool gaussRecurrenceGrid (const size_t N, const std::vector<double>& alpha,
+  const std::vector<double>& beta, std::vector<double>& x, std::vector<double>& w)
+//input:  N = order, alpha[N] and beta[N] = recurrence coefficients, beta[0] = mass
+//output: x[N] and w[N] = coordinates and weights
+{
+  if ((N == 0) || (alpha.size() < N) || (beta.size() < N) || (beta[0] <= 0.0))
+  {
+    std::cout << "Error in gaussRecurrenceGrid. N = " << N << " alpha.size() = ";
+    std::cout << alpha.size() << " beta.size() = " << beta.size() << "\n";
+    std::cout << "1 <= N <= alpha.size(), beta.size() and beta[0] > 0 are required\n";
+    return false;
+  }
+
+  //symmetric Jacobi matrix
+  std::vector<double> d(alpha.begin(), alpha.begin() + N);
+  std::vector<double> e(N, 0.0);
+  for (size_t i = 0; i+1 < N; i++)
+  {
+    if (beta[i+1] <= 0.0)
+    {
+      std::cout << "Error in gaussRecurrenceGrid. beta[" << i+1 << "] = " << beta[i+1];
+      std::cout << " <= 0\n";
+      return false;
+    }
+    e[i] = sqrt(beta[i+1]);
+  }
+
+  std::vector<double> z;
+  if (N < gaussCustomBisectionOrder)
+  {
+    std::vector<double> ee(e);
+    x = d;
+    if (!gaussCustomQL (N, x, ee, z))
+    {
+      std::cout << "Error in gaussRecurrenceGrid. QL iteration did not converge\n";
+      return false;
+    }
+    for (size_t i = 0; i < N; i++)
+      z[i] *= z[i];
+
+    //sort ascending
+    std::vector<size_t> order(N);
+    for (size_t i = 0; i < N; i++)
+      order[i] = i;
+    std::sort(order.begin(), order.end(),
+      [&x](const size_t i, const size_t j) { return x[i] < x[j]; });
+
+    std::vector<double> xs(N), zs(N);
+    for (size_t i = 0; i < N; i++)
+    {
+      xs[i] = x[order[i]];
+      zs[i] = z[order[i]];
+    }
+    x.swap(xs);
+    z.swap(zs);
+  }
+  else
+    gaussCustomBisection (N, d, e, x, z);
+
+  w.resize(N);
+  for (size_t i = 0; i < N; i++)
+    w[i] = beta[0]*z[i];
+
+  return true;
+}
+
+bool stieltjesRecurrence (const size_t N, const std::vector<double>& xm,
+  const std::vector<double>& wm, std::vector<double>& alpha, std::vector<double>& beta)
+//input:  N = number of coefficients, xm[M] and wm[M] = discrete measure
+//output: alpha[N] and beta[N] = recurrence coefficients of the monic orthogonal polynomials
+{
+  const size_t M = xm.size();
+  size_t nPositive = 0;
+  double mu0 = 0.0;
+  bool   valid = (wm.size() == M);
+  for (size_t i = 0; valid && (i < M); i++)
+  {
+    if (wm[i] < 0.0)
+      valid = false;
+    if (wm[i] > 0.0)
+      nPositive++;
+    mu0 += wm[i];
+  }
+
+  if (!valid || (N == 0) || (nPositive < N))
+  {
+    std::cout << "Error in stieltjesRecurrence. N = " << N << " xm.size() = " << M;
+    std::cout << " wm.size() = " << wm.size() << "\n";
+    std::cout << "wm >= 0 with at least N positive weights is required\n";
+    return false;
+  }
+
+  alpha.resize(N);
+  beta.resize(N);
+  beta[0] = mu0;
+
+  //orthonormal polynomial values q_k(xm[i]) (Lanczos form of the Stieltjes procedure)
+  std::vector<double> q(M, 1.0/sqrt(mu0));
+  std::vector<double> qm1(M, 0.0);
+  std::vector<double> r(M);
+  double sqrtb = 0.0;
+
+  for (size_t k = 0; k < N; k++)
+  {
+    double a = 0.0;
+    for (size_t i = 0; i < M; i++)
+      a += wm[i]*xm[i]*q[i]*q[i];
+    alpha[k] = a;
+
+    if (k+1 == N)
+      break;
+
+    for (size_t i = 0; i < M; i++)
+      r[i] = (xm[i] - a)*q[i] - sqrtb*qm1[i];
+
+    //one step of local re-orthogonalization against q_k
+    double c = 0.0;
+    for (size_t i = 0; i < M; i++)
+      c += wm[i]*r[i]*q[i];
+    double norm = 0.0;
+    for (size_t i = 0; i < M; i++)
+    {
+      r[i] -= c*q[i];
+      norm += wm[i]*r[i]*r[i];
+    }
+
+    if (!(norm > 0.0))
+    {
+      std::cout << "Error in stieltjesRecurrence. breakdown at k = " << k+1 << "\n";
+      return false;
+    }
+
+    sqrtb     = sqrt(norm);
+    beta[k+1] = norm;
+    for (size_t i = 0; i < M; i++)
+    {
+      qm1[i] = q[i];
+      q[i]   = r[i]/sqrtb;
+    }
+  }
+
+  return true;
+}
+
+bool gaussDiscreteMeasureGrid (const size_t N, const std::vector<double>& xm,
+  const std::vector<double>& wm, std::vector<double>& x, std::vector<double>& w)
+//input:  N = order, xm[M] and wm[M] = discrete measure
+//output: x[N] and w[N] = coordinates and weights
+{
+  std::vector<double> alpha, beta;
+  if (!stieltjesRecurrence (N, xm, wm, alpha, beta))
+    return false;
+
+  return gaussRecurrenceGrid (N, alpha, beta, x, w);
+}
+
+bool gaussWeightFunctionGrid (const size_t N, const std::function<double(double)>& weight,
+  const double a, const double b, const size_t M, std::vector<double>& x,
+  std::vector<double>& w)
+//input:  N = order, weight = W(x), [a, b] interval, M = Gauss-Legendre order
+//output: x[N] and w[N] = coordinates and weights
+//        Integral{ W(x) f(x) } over [a,b] = Sum{ f(x[i])*w[i] }
+{
+  if (M < N)
+  {
+    std::cout << "Error in gaussWeightFunctionGrid. N = " << N << " M = " << M << "\n";
+    std::cout << "M >= N is required\n";
+    return false;
+  }
+
+  std::vector<double> xm, wm;
+  if (!gaussLegendreGrid (M, xm, wm, a, b))
+  {
+    std::cout << "Error in gaussWeightFunctionGrid. M = " << M << " is not supported\n";
+    return false;
+  }
+  xm.resize(M);
+  wm.resize(M);
+
+  for (size_t i = 0; i < M; i++)
+  {
+    const double W = weight(xm[i]);
+    if (W < 0.0)
+    {
+      std::cout << "Error in gaussWeightFunctionGrid. W(" << xm[i] << ") = " << W << " < 0\n";
+      return false;
+    }
+    wm[i] *= W;
+  }
+
+  return gaussDiscreteMeasureGrid (N, xm, wm, x, w);
+}
+
+}//end namespace quadgrid
@@ -0,0 +1,662 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+#include <cstdlib>
+#include <cmath>
+
+#include <algorithm>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <vector>
+
+#include <quadgrid/gauss_family_grid.hpp>
+#include <quadgrid/constant.hpp>
+
+
+namespace quadgrid
+{
+//three-term recurrence of the orthonormal polynomials p_k
+//sqrtb[k+1]*p_{k+1}(x) = (x - a[k])*p_k(x) - sqrtb[k]*p_{k-1}(x),  p_0 = 1/sqrt(mu0)
+struct gaussFamilyRecurrence
+{
+  std::vector<double> a;      //[N]
+  std::vector<double> sqrtb;  //[N+1], sqrtb[0] = 0
+  double mu0;
+};
+
+static void gaussFamilyEvaluate (const gaussFamilyRecurrence& rec, const size_t N,
+  const double x, double& step, double& logWeight, size_t& nAbove)
+//output: step      = Laguerre iteration step for the zeros of p_N at x
+//        logWeight = -log(Sum{ p_k(x)^2 }) for k < N   (log of the Christoffel number)
+//        nAbove    = sign changes of p_0(x)..p_N(x)    (number of zeros of p_N above x)
+//values are rescaled on the fly so that large N and large |x| do not overflow
+{
+  double p0  = 1.0/sqrt(rec.mu0);
+  double pm1 = 0.0;
+  double d0  = 0.0;
+  double dm1 = 0.0;
+  double e0  = 0.0;
+  double em1 = 0.0;
+
+  double sum      = p0*p0;
+  double logScale = 0.0;
+
+  nAbove = 0;
+  bool positive = true;
+
+  for (size_t k = 0; k < N; k++)
+  {
+    const double xa = x - rec.a[k];
+    const double p1 = (xa*p0 - rec.sqrtb[k]*pm1)/rec.sqrtb[k+1];
+    const double d1 = (p0 + xa*d0 - rec.sqrtb[k]*dm1)/rec.sqrtb[k+1];
+    const double e1 = (2.0*d0 + xa*e0 - rec.sqrtb[k]*em1)/rec.sqrtb[k+1];
+
+    pm1 = p0;
+    p0  = p1;
+    dm1 = d0;
+    d0  = d1;
+    em1 = e0;
+    e0  = e1;
+
+    if (k+1 < N)
+      sum += p0*p0;
+
+    if ((p0 >= 0.0) != positive)
+    {
+      nAbove++;
+      positive = !positive;
+    }
+
+    if (fabs(p0) > 1.0E100)
+    {
+      p0       *= 1.0E-100;
+      pm1      *= 1.0E-100;
+      d0       *= 1.0E-100;
+      dm1      *= 1.0E-100;
+      e0       *= 1.0E-100;
+      em1      *= 1.0E-100;
+      sum      *= 1.0E-200;
+      logScale += 100.0*log(10.0);
+    }
+  }
+
+  //Laguerre's method: globally convergent for polynomials with real zeros
+  //and cubically convergent near a zero
+  if (p0 == 0.0)
+    step = 0.0;
+  else
+  {
+    const double n = (double) N;
+    const double G = d0/p0;
+    const double H = G*G - e0/p0;
+    double root = (n - 1.0)*(n*H - G*G);
+    root = (root > 0.0) ? sqrt(root) : 0.0;
+    const double denom = (G >= 0.0) ? G + root : G - root;
+    step = (denom == 0.0) ? 0.0 : n/denom;
+  }
+
+  logWeight = -log(sum) - 2.0*logScale;
+}
+
+static void gaussFamilyBounds (const gaussFamilyRecurrence& rec, const size_t N,
+  double& lower, double& upper)
+//output: Gershgorin bounds [lower, upper] of the zeros of p_N (Jacobi matrix)
+{
+  lower =  1.0E300;
+  upper = -1.0E300;
+  for (size_t k = 0; k < N; k++)
+  {
+    const double r = rec.sqrtb[k] + rec.sqrtb[k+1];
+    if (lower > rec.a[k] - r) lower = rec.a[k] - r;
+    if (upper < rec.a[k] + r) upper = rec.a[k] + r;
+  }
+}
+
+static void gaussFamilyRootNode (const gaussFamilyRecurrence& rec, const size_t N,
+  const size_t k, double lo, double hi, double z, double& x, double& w)
+//input:  zero k (ascending) of p_N in the bracket [lo, hi], initial guess z
+//output: x = zero, w = weight
+//Laguerre iterations safeguarded with the bracket from the sign-change count
+//(each evaluation is O(N))
+{
+  const double eps = 2.220446049250313e-16;
+
+  if (!((z >= lo) && (z < hi)))
+    z = 0.5*(lo + hi);
+
+  double step, logWeight;
+  size_t nAbove;
+  for (int iter = 0; iter < 200; iter++)
+  {
+    gaussFamilyEvaluate (rec, N, z, step, logWeight, nAbove);
+
+    if (nAbove >= N-k)
+      lo = z;
+    else
+      hi = z;
+
+    //converged to the wrong zero: continue from the bracket midpoint
+    const bool   found = ((nAbove == N-k) && (step <= 0.0)) || ((nAbove+1 == N-k) && (step >= 0.0));
+    const double tol   = 4.0*eps*(fabs(z) > 1.0 ? fabs(z) : 1.0);
+
+    if (found && (fabs(step) <= tol))
+      break;
+
+    double znew = z - step;
+    if (!((znew > lo) && (znew < hi)) || (!found && (fabs(step) <= tol)))
+      znew = 0.5*(lo + hi);
+
+    if (hi - lo <= tol)
+    {
+      z = znew;
+      break;
+    }
+    z = znew;
+  }
+
+  gaussFamilyEvaluate (rec, N, z, step, logWeight, nAbove);
+  x = z;
+  w = exp(logWeight);
+}
+
+static void gaussFamilyRoot (const gaussFamilyRecurrence& rec, const size_t N,
+  std::vector<double>& x, std::vector<double>& w)
+//nodes in ascending order, each seeded by extrapolating from the previous nodes, O(N^2)
+{
+  x.resize(N);
+  w.resize(N);
+
+  double lower, upper;
+  gaussFamilyBounds (rec, N, lower, upper);
+
+  for (size_t k = 0; k < N; k++)
+  {
+    double z;
+    if (k >= 3)
+      z = 3.0*x[k-1] - 3.0*x[k-2] + x[k-3];
+    else if (k == 2)
+      z = 2.0*x[1] - x[0];
+    else if (k == 1)
+      z = 2.0*x[0] - lower;
+    else
+      z = lower;
+
+    gaussFamilyRootNode (rec, N, k, (k == 0) ? lower : x[k-1], upper, z, x[k], w[k]);
+  }
+}
+
+
+
+//differential equation p(x) u'' + q(x) u' + r(x) u = 0 of u = exp(-g(x)) y, where y is the
+//classical polynomial with the zeros of p_N, p(x) = p0 + p1 x + p2 x^2, q(x) = q0 + q1 x,
+//r(x) = r0 + r1 x + r2 x^2 and g(x) = g1 x + g2 x^2. The factor exp(-g) removes the growth
+//of the Laguerre and Hermite polynomials, whose Taylor series would lose all digits to
+//cancellation otherwise.
+struct gaussFamilyEquation
+{
+  double p0, p1, p2;
+  double q0, q1;
+  double r0, r1, r2;
+  double g1, g2;
+  double lower;   //singular point below the zeros, -1.0E300 if none
+  double upper;   //singular point above the zeros,  1.0E300 if none
+};
+
+//orders above which the nodes are marched with gaussFamilyMarch
+static const size_t gaussFamilyMarchOrder = 100;
+
+//terms of the Taylor series of gaussFamilyMarchStep
+static const int gaussFamilyTaylorOrder = 40;
+
+static bool gaussFamilyPrufer (const gaussFamilyEquation& eq, const double theta,
+  const double x, double& slope)
+//output: slope = dx/dtheta of the Pruefer angle tan(theta) = sqrt(r/p) u/u'
+//        false outside the oscillatory region
+{
+  const double p = eq.p0 + eq.p1*x + eq.p2*x*x;
+  const double r = eq.r0 + eq.r1*x + eq.r2*x*x;
+  if (!(p > 0.0) || !(r > 0.0))
+    return false;
+  const double dp    = eq.p1 + 2.0*eq.p2*x;
+  const double dr    = eq.r1 + 2.0*eq.r2*x;
+  const double q     = eq.q0 + eq.q1*x;
+  const double denom = sqrt(r/p) + (0.25*dr/r + (q - 0.5*dp)/(2.0*p))*sin(2.0*theta);
+  if (!(denom > 0.0))
+    return false;
+  slope = 1.0/denom;
+  return true;
+}
+
+static bool gaussFamilyMarchStep (const gaussFamilyEquation& eq, const double x0,
+  const double direction, double& x1, double& ratio)
+//input:  zero x0 of a solution u of eq, direction = 1 (next zero above) or -1 (below)
+//output: x1 = next zero, ratio = u'(x1)/u'(x0)
+//        false if the prediction or the Taylor series is not reliable at x0
+{
+  const double eps = 2.220446049250313e-16;
+
+  //prediction: theta advances by pi between zeros, RK4 in 40 steps
+  const int    nStep  = 40;
+  const double dtheta = direction*Pi/nStep;
+  double x = x0;
+  for (int i = 0; i < nStep; i++)
+  {
+    const double theta = i*dtheta;
+    double k1, k2, k3, k4;
+    if (!gaussFamilyPrufer (eq, theta, x, k1) ||
+        !gaussFamilyPrufer (eq, theta + 0.5*dtheta, x + 0.5*dtheta*k1, k2) ||
+        !gaussFamilyPrufer (eq, theta + 0.5*dtheta, x + 0.5*dtheta*k2, k3) ||
+        !gaussFamilyPrufer (eq, theta + dtheta, x + dtheta*k3, k4))
+      return false;
+    x += dtheta*(k1 + 2.0*k2 + 2.0*k3 + k4)/6.0;
+  }
+
+  //the series is evaluated within a third of its radius of convergence
+  const double H = x - x0;
+  const double distance = std::min(x0 - eq.lower, eq.upper - x0);
+  if (!(direction*H > 0.0) || (3.0*fabs(H) > distance))
+    return false;
+
+  //Taylor series u(x0 + t H) = Sum{ e[j] t^j } with u(x0) = 0, u'(x0) = 1/H
+  const double p0 = eq.p0 + eq.p1*x0 + eq.p2*x0*x0;
+  const double p1 = eq.p1 + 2.0*eq.p2*x0;
+  const double q0 = eq.q0 + eq.q1*x0;
+  const double r0 = eq.r0 + eq.r1*x0 + eq.r2*x0*x0;
+  const double r1 = eq.r1 + 2.0*eq.r2*x0;
+  double e[gaussFamilyTaylorOrder];
+  e[0] = 0.0;
+  e[1] = 1.0;
+  for (int j = 0; j+2 < gaussFamilyTaylorOrder; j++)
+  {
+    double sum = (p1*j*(j+1) + q0*(j+1))*H*e[j+1] + (eq.p2*j*(j-1) + eq.q1*j + r0)*H*H*e[j];
+    if (j >= 1)
+      sum += r1*H*H*H*e[j-1];
+    if (j >= 2)
+      sum += eq.r2*H*H*H*H*e[j-2];
+    e[j+2] = -sum/(p0*(j+2)*(j+1));
+  }
+
+  //the steps stop decreasing at the rounding level of the series. A prediction that is
+  //off by more than 1e-3 marks a turning point, beyond which the marching is unstable.
+  double t = 1.0;
+  double du = 0.0;
+  double dtPrevious = 1.0;
+  bool converged = false;
+  for (int iter = 0; (iter < 20) && !converged; iter++)
+  {
+    double u = 0.0;
+    du = 0.0;
+    for (int j = gaussFamilyTaylorOrder-1; j > 0; j--)
+    {
+      u  = u*t + e[j];
+      du = du*t + j*e[j];
+    }
+    u *= t;
+
+    const double dt = u/du;
+    t -= dt;
+    converged = (fabs(dt) <= 4.0*eps) || ((fabs(dt) <= 1.0E-10) && (fabs(dt) >= dtPrevious));
+    dtPrevious = fabs(dt);
+  }
+  if (!converged || !(fabs(t - 1.0) <= 1.0E-3))
+    return false;
+
+  du = 0.0;
+  for (int j = gaussFamilyTaylorOrder-1; j > 0; j--)
+    du = du*t + j*e[j];
+
+  x1    = x0 + t*H;
+  ratio = du;
+  return true;
+}
+
+static double gaussFamilyLogScale (const gaussFamilyEquation& eq, const double x)
+//output: log(p(x) exp(2 g(x))), the weight at a zero x is proportional to 1/(p(x) y'(x)^2)
+//        with y' = exp(g) u'
+{
+  return log(eq.p0 + eq.p1*x + eq.p2*x*x) + 2.0*(eq.g1*x + eq.g2*x*x);
+}
+
+static void gaussFamilyMarch (const gaussFamilyRecurrence& rec, const gaussFamilyEquation& eq,
+  const size_t N, std::vector<double>& x, std::vector<double>& w)
+//nodes in ascending order in O(N): the middle zero from the recurrence, then one step of
+//gaussFamilyMarchStep per zero in both directions, with the weights relative to the middle
+//one from the ratios of u'. The few zeros next to a singular point or a turning point, where
+//the steps are not reliable, come from the recurrence.
+{
+  x.resize(N);
+  w.resize(N);
+
+  double lower, upper;
+  gaussFamilyBounds (rec, N, lower, upper);
+
+  const size_t k0 = N/2;
+  gaussFamilyRootNode (rec, N, k0, lower, upper, 0.5*(lower + upper), x[k0], w[k0]);
+
+  //the weight of the middle zero underflows for Laguerre rules of large order
+  double step, logW0;
+  size_t nAbove;
+  gaussFamilyEvaluate (rec, N, x[k0], step, logW0, nAbove);
+  logW0 += gaussFamilyLogScale (eq, x[k0]);
+
+  size_t kUp = k0;
+  double logRatio = 0.0;
+  while (kUp+1 < N)
+  {
+    double x1, ratio;
+    if (!gaussFamilyMarchStep (eq, x[kUp], 1.0, x1, ratio))
+      break;
+    logRatio += log(fabs(ratio));
+    kUp++;
+    x[kUp] = x1;
+    w[kUp] = exp(logW0 - gaussFamilyLogScale (eq, x1) - 2.0*logRatio);
+  }
+
+  size_t kDown = k0;
+  logRatio = 0.0;
+  while (kDown > 0)
+  {
+    double x1, ratio;
+    if (!gaussFamilyMarchStep (eq, x[kDown], -1.0, x1, ratio))
+      break;
+    logRatio += log(fabs(ratio));
+    kDown--;
+    x[kDown] = x1;
+    w[kDown] = exp(logW0 - gaussFamilyLogScale (eq, x1) - 2.0*logRatio);
+  }
+
+  //the marched nodes are increasing and exactly the zeros kDown .. kUp of p_N if the
+  //sign-change counts half a spacing outside of them are right
+  bool valid = true;
+  for (size_t k = kDown; k < kUp; k++)
+    if (!(x[k] < x[k+1]))
+      valid = false;
+  if (valid && (kUp > kDown))
+  {
+    double logWeight;
+    gaussFamilyEvaluate (rec, N, x[kDown] - 0.5*(x[kDown+1] - x[kDown]), step, logWeight, nAbove);
+    valid = (nAbove == N-kDown);
+    gaussFamilyEvaluate (rec, N, x[kUp] + 0.5*(x[kUp] - x[kUp-1]), step, logWeight, nAbove);
+    valid = valid && (nAbove == N-kUp-1);
+  }
+  if (!valid)
+  {
+    gaussFamilyRoot (rec, N, x, w);
+    return;
+  }
+
+  for (size_t k = kUp+1; k < N; k++)
+  {
+    const double z = (k >= 3) ? 3.0*x[k-1] - 3.0*x[k-2] + x[k-3] : 2.0*x[k-1] - x[k-2];
+    gaussFamilyRootNode (rec, N, k, x[k-1], upper, z, x[k], w[k]);
+  }
+  for (size_t k = kDown; k > 0; k--)
+  {
+    const double z = (k+2 < N) ? 3.0*x[k] - 3.0*x[k+1] + x[k+2] : 2.0*x[k] - x[k+1];
+    gaussFamilyRootNode (rec, N, k-1, lower, x[k], z, x[k-1], w[k-1]);
+  }
+}
+
+
+
+static void gaussFamilyJacobiRecurrence (const size_t N, const double alpha,
+  const double beta, gaussFamilyRecurrence& rec)
+{
+  rec.a.resize(N);
+  rec.sqrtb.resize(N+1);
+
+  const double ab = alpha + beta;
+  rec.mu0 = exp((ab + 1.0)*log(2.0) + lgamma(alpha + 1.0) + lgamma(beta + 1.0) -
+    lgamma(ab + 2.0));
+
+  rec.sqrtb[0] = 0.0;
+  for (size_t k = 0; k < N; k++)
+  {
+    const double c = 2.0*k + ab;
+    if (k == 0)
+      rec.a[k] = (beta - alpha)/(ab + 2.0);
+    else
+      rec.a[k] = (beta*beta - alpha*alpha)/(c*(c + 2.0));
+
+    const size_t n = k+1;
+    const double d = 2.0*n + ab;
+    double b;
+    if (n == 1)
+      b = 4.0*(1.0 + alpha)*(1.0 + beta)/((2.0 + ab)*(2.0 + ab)*(3.0 + ab));
+    else
+      b = 4.0*n*(n + alpha)*(n + beta)*(n + ab)/(d*d*(d + 1.0)*(d - 1.0));
+    rec.sqrtb[n] = sqrt(b);
+  }
+}
+
+static void gaussFamilyLaguerreRecurrence (const size_t N, const double alpha,
+  gaussFamilyRecurrence& rec)
+{
+  rec.a.resize(N);
+  rec.sqrtb.resize(N+1);
+  rec.mu0 = exp(lgamma(alpha + 1.0));
+
+  rec.sqrtb[0] = 0.0;
+  for (size_t k = 0; k < N; k++)
+  {
+    rec.a[k]       = 2.0*k + alpha + 1.0;
+    rec.sqrtb[k+1] = sqrt((k + 1.0)*(k + 1.0 + alpha));
+  }
+}
+
+static void gaussFamilyHermiteRecurrence (const size_t N, gaussFamilyRecurrence& rec)
+{
+  rec.a.assign(N, 0.0);
+  rec.sqrtb.resize(N+1);
+  rec.mu0 = sqrt(Pi);
+
+  rec.sqrtb[0] = 0.0;
+  for (size_t k = 0; k < N; k++)
+    rec.sqrtb[k+1] = sqrt(0.5*(k + 1.0));
+}
+
+
+
+//reference rules (before the affine/scaling map) cached per family, order and exponents
+enum gaussFamily
+{
+  gaussFamilyJacobi,
+  gaussFamilyLaguerre,
+  gaussFamilyHermite
+};
+
+struct gaussFamilyTable
+{
+  typedef std::tuple<int, size_t, double, double> key;
+
+  std::mutex mutex;
+  std::map< key, std::pair< std::vector<double>, std::vector<double> > > grid;
+
+  void get (const gaussFamily family, const size_t N, const double alpha,
+    const double beta, std::vector<double>& x, std::vector<double>& w)
+  {
+    const key k(family, N, alpha, beta);
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      auto it = grid.find(k);
+      if (it != grid.end())
+      {
+        x = it->second.first;
+        w = it->second.second;
+        return;
+      }
+    }
+
+    const double n = (double) N;
+    gaussFamilyRecurrence rec;
+    gaussFamilyEquation eq;
+    if (family == gaussFamilyJacobi)
+    {
+      gaussFamilyJacobiRecurrence (N, alpha, beta, rec);
+      const gaussFamilyEquation e = {1.0, 0.0, -1.0, beta - alpha, -(alpha + beta + 2.0),
+        n*(n + alpha + beta + 1.0), 0.0, 0.0, 0.0, 0.0, -1.0, 1.0};
+      eq = e;
+    }
+    else if (family == gaussFamilyLaguerre)
+    {
+      //x y'' + (alpha+1-x) y' + n y = 0 with y = exp(x/2) u
+      gaussFamilyLaguerreRecurrence (N, alpha, rec);
+      const gaussFamilyEquation e = {0.0, 1.0, 0.0, alpha + 1.0, 0.0,
+        n + 0.5*(alpha + 1.0), -0.25, 0.0, 0.5, 0.0, 0.0, 1.0E300};
+      eq = e;
+    }
+    else
+    {
+      //y'' - 2x y' + 2n y = 0 with y = exp(x^2/2) u
+      gaussFamilyHermiteRecurrence (N, rec);
+      const gaussFamilyEquation e = {1.0, 0.0, 0.0, 0.0, 0.0, 2.0*n + 1.0, 0.0, -1.0, 0.0, 0.5,
+        -1.0E300, 1.0E300};
+      eq = e;
+    }
+
+    if (N > gaussFamilyMarchOrder)
+      gaussFamilyMarch (rec, eq, N, x, w);
+    else
+      gaussFamilyRoot (rec, N, x, w);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    grid[k] = std::make_pair(x, w);
+  }
+};
+
+static gaussFamilyTable& getGaussFamilyTable ()
+{
+  static gaussFamilyTable table;
+  return table;
+}
+
+
+
+bool gaussLaguerreGrid (const size_t N, std::vector<double>& x,
+  std::vector<double>& w, const double alpha, const double a, const double scale)
+//input:  N = order, alpha, [a, inf) interval, scale
+//output: x[N] and w[N] = coordinates and weights
+//        Integral{ t^alpha e^(-t) f(x) } over [a,inf) = Sum{ f(x[i])*w[i] }, t = (x-a)/scale
+{
+  if ((N == 0) || (alpha <= -1.0) || (scale <= 0.0))
+  {
+    std::cout << "Error in gaussLaguerreGrid. N = " << N << " alpha = " << alpha;
+    std::cout << " scale = " << scale << "\n";
+    std::cout << "N >= 1, alpha > -1 and scale > 0 are required\n";
+    return false;
+  }
+
+  getGaussFamilyTable().get (gaussFamilyLaguerre, N, alpha, 0.0, x, w);
+
+  for (size_t i = 0; i < N; i++)
+  {
+    x[i]  = a + scale*x[i];
+    w[i] *= scale;
+  }
+
+  return true;
+}
+
+bool gaussHermiteGrid (const size_t N, std::vector<double>& x,
+  std::vector<double>& w, const double center, const double scale)
+//input:  N = order, center, scale
+//output: x[N] and w[N] = coordinates and weights
+//        Integral{ e^(-t^2) f(x) } over (-inf,inf) = Sum{ f(x[i])*w[i] }, t = (x-center)/scale
+{
+  if ((N == 0) || (scale <= 0.0))
+  {
+    std::cout << "Error in gaussHermiteGrid. N = " << N << " scale = " << scale << "\n";
+    std::cout << "N >= 1 and scale > 0 are required\n";
+    return false;
+  }
+
+  getGaussFamilyTable().get (gaussFamilyHermite, N, 0.0, 0.0, x, w);
+
+  for (size_t i = 0; i < N; i++)
+  {
+    x[i]  = center + scale*x[i];
+    w[i] *= scale;
+  }
+
+  return true;
+}
+
+bool gaussJacobiGrid (const size_t N, std::vector<double>& x,
+  std::vector<double>& w, const double alpha, const double beta,
+  const double a, const double b)
+//input:  N = order, alpha, beta, [a, b] interval
+//output: x[N] and w[N] = coordinates and weights
+//        Integral{ (1-t)^alpha (1+t)^beta f(x) } over [a,b] = Sum{ f(x[i])*w[i] }
+{
+  if ((N == 0) || (alpha <= -1.0) || (beta <= -1.0))
+  {
+    std::cout << "Error in gaussJacobiGrid. N = " << N << " alpha = " << alpha;
+    std::cout << " beta = " << beta << "\n";
+    std::cout << "N >= 1, alpha > -1 and beta > -1 are required\n";
+    return false;
+  }
+
+  getGaussFamilyTable().get (gaussFamilyJacobi, N, alpha, beta, x, w);
+
+  const double c1 = 0.5*(b-a);
+  const double c2 = 0.5*(b+a);
+  for (size_t i = 0; i < N; i++)
+  {
+    x[i]  = c1*x[i] + c2;
+    w[i] *= c1;
+  }
+
+  return true;
+}
+
+bool gaussChebyshevGrid (const size_t N, std::vector<double>& x,
+  std::vector<double>& w, const int kind, const double a, const double b)
+//input:  N = order, kind = 1 or 2, [a, b] interval
+//output: x[N] and w[N] = coordinates and weights
+{
+  if ((N == 0) || ((kind != 1) && (kind != 2)))
+  {
+    std::cout << "Error in gaussChebyshevGrid. N = " << N << " kind = " << kind << "\n";
+    std::cout << "N >= 1 and kind = 1 or 2 are required\n";
+    return false;
+  }
+
+  x.resize(N);
+  w.resize(N);
+
+  const double c1 = 0.5*(b-a);
+  const double c2 = 0.5*(b+a);
+  for (size_t i = 0; i < N; i++)
+  {
+    if (kind == 1)
+    {
+      const double theta = Pi*(2.0*i + 1.0)/(2.0*N);
+      x[i] = -cos(theta);
+      w[i] = Pi/N;
+    }
+    else
+    {
+      const double theta = Pi*(i + 1.0)/(N + 1.0);
+      x[i] = -cos(theta);
+      w[i] = Pi/(N + 1.0)*sin(theta)*sin(theta);
+    }
+
+    x[i]  = c1*x[i] + c2;
+    w[i] *= c1;
+  }
+
+  return true;
+}
+
+}//end namespace quadgrid
@@ -0,0 +1,256 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+#include <cstdlib>
+#include <cmath>
+
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include <quadgrid/legendre_transform.hpp>
+#include <quadgrid/legendre.hpp>
+#include <quadgrid/gauss_legendre_grid.hpp>
+
+
+namespace quadgrid
+{
+//number of vectors per block of the transform kernel
+static const size_t legendreTransformBlock = 64;
+
+
+
+//parity-split Vandermonde blocks of order N on the nodes x[i] < 0 (and x = 0 for odd N),
+//applied to f(x) + f(-x) (even n) and f(x) - f(-x) (odd n)
+//  forwardEven[n/2][i]  = (2n+1)/2 w[i] P_n(x[i])  (n even)
+//  forwardOdd[n/2][i]   = (2n+1)/2 w[i] P_n(x[i])  (n odd)
+//  inverseEven[i][n/2]  = P_n(x[i])                (n even)
+//  inverseOdd[i][n/2]   = P_n(x[i])                (n odd)
+struct legendreTransformMatrix
+{
+  size_t nEven;   //number of even degrees
+  size_t nOdd;    //number of odd degrees
+  size_t nHalf;   //number of nodes x < 0
+  size_t nNode;   //nHalf + 1 if N is odd (node x = 0)
+  std::vector<double> forwardEven;
+  std::vector<double> forwardOdd;
+  std::vector<double> inverseEven;
+  std::vector<double> inverseOdd;
+};
+
+struct legendreTransformTable
+{
+  std::mutex mutex;
+  std::map<size_t, legendreTransformMatrix> matrix;
+
+  const legendreTransformMatrix* get (const size_t N)
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      auto it = matrix.find(N);
+      if (it != matrix.end())
+        return &it->second;
+    }
+
+    std::vector<double> x, w, P, dPdx;
+    if (!gaussLegendreGrid (N, x, w, -1.0, 1.0))
+      return NULL;
+
+    legendreTransformMatrix m;
+    m.nEven = (N+1)/2;
+    m.nOdd  = N/2;
+    m.nHalf = N/2;
+    m.nNode = (N+1)/2;
+    m.forwardEven.resize(m.nEven*m.nNode);
+    m.forwardOdd.resize(m.nOdd*m.nHalf);
+    m.inverseEven.resize(m.nNode*m.nEven);
+    m.inverseOdd.resize(m.nHalf*m.nOdd);
+
+    for (size_t i = 0; i < m.nNode; i++)
+    {
+      const bool   center = (i == m.nHalf);
+      const double xi     = center ? 0.0 : x[i];
+      legendrePoly (P, dPdx, xi, N);
+
+      //the weight is recomputed from the node, w = 2/((1-x^2) P_N'(x)^2), which is
+      //more accurate than the tabulated weight for large N
+      const double wi = 2.0/((1.0 - xi)*(1.0 + xi)*dPdx[N]*dPdx[N]);
+
+      for (size_t n = 0; n < N; n++)
+      {
+        const double fw = 0.5*(2.0*n + 1.0)*wi*P[n];
+        if (n % 2 == 0)
+        {
+          m.forwardEven[(n/2)*m.nNode + i] = fw;
+          m.inverseEven[i*m.nEven + n/2]   = P[n];
+        }
+        else if (!center)
+        {
+          m.forwardOdd[(n/2)*m.nHalf + i] = fw;
+          m.inverseOdd[i*m.nOdd + n/2]    = P[n];
+        }
+      }
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = matrix.insert(std::make_pair(N, m)).first;
+    return &it->second;
+  }
+};
+
+static legendreTransformTable& getLegendreTransformTable ()
+{
+  static legendreTransformTable table;
+  return table;
+}
+
+
+
+static void legendreTransformKernel (const size_t nRow, const size_t nCol,
+  const double *A, const size_t nVector, const double *B, double *C)
+//C[nRow][nVector] = A[nRow][nCol] * B[nCol][nVector]
+//vectors are contiguous in B and C so that the innermost loop is a unit-stride axpy
+{
+  #pragma omp parallel for schedule(static) if (nRow*nCol*nVector > 100000)
+  for (long r = 0; r < (long) nRow; r++)
+  {
+    const double *a = &A[r*nCol];
+    for (size_t v0 = 0; v0 < nVector; v0 += legendreTransformBlock)
+    {
+      const size_t nv = (nVector - v0 < legendreTransformBlock) ? nVector - v0 :
+        legendreTransformBlock;
+
+      double acc[legendreTransformBlock];
+      for (size_t v = 0; v < nv; v++)
+        acc[v] = 0.0;
+
+      for (size_t i = 0; i < nCol; i++)
+      {
+        const double  ai = a[i];
+        const double *b  = &B[i*nVector + v0];
+        for (size_t v = 0; v < nv; v++)
+          acc[v] += ai*b[v];
+      }
+
+      double *c = &C[r*nVector + v0];
+      for (size_t v = 0; v < nv; v++)
+        c[v] = acc[v];
+    }
+  }
+}
+
+
+
+bool legendreForward (const size_t N, const std::vector<double>& f, const size_t nVector,
+  std::vector<double>& c)
+//input:  N = order, f[nVector*N] = nodal values
+//output: c[nVector*N] = Legendre coefficients
+{
+  const legendreTransformMatrix* m = getLegendreTransformTable().get (N);
+  if ((m == NULL) || (f.size() != nVector*N))
+  {
+    std::cout << "Error in legendreForward. N = " << N << " f.size() = " << f.size();
+    std::cout << " nVector = " << nVector << "\n";
+    return false;
+  }
+
+  if (nVector == 0)
+  {
+    c.clear();
+    return true;
+  }
+
+  //even/odd parts at the nodes x[i] < 0, interleaved over the vectors
+  std::vector<double> even(m->nNode*nVector), odd(m->nHalf*nVector);
+  for (size_t v = 0; v < nVector; v++)
+  {
+    const double *fv = &f[v*N];
+    for (size_t i = 0; i < m->nHalf; i++)
+    {
+      even[i*nVector + v] = fv[i] + fv[N-1-i];
+      odd[i*nVector + v]  = fv[i] - fv[N-1-i];
+    }
+    if (m->nNode > m->nHalf)
+      even[m->nHalf*nVector + v] = fv[m->nHalf];
+  }
+
+  std::vector<double> cEven(m->nEven*nVector), cOdd(m->nOdd*nVector);
+  legendreTransformKernel (m->nEven, m->nNode, &m->forwardEven[0], nVector, &even[0], &cEven[0]);
+  if (m->nOdd > 0)
+    legendreTransformKernel (m->nOdd, m->nHalf, &m->forwardOdd[0], nVector, &odd[0], &cOdd[0]);
+
+  c.resize(nVector*N);
+  for (size_t v = 0; v < nVector; v++)
+  {
+    double *cv = &c[v*N];
+    for (size_t n = 0; n < N; n++)
+      cv[n] = (n % 2 == 0) ? cEven[(n/2)*nVector + v] : cOdd[(n/2)*nVector + v];
+  }
+
+  return true;
+}
+
+bool legendreInverse (const size_t N, const std::vector<double>& c, const size_t nVector,
+  std::vector<double>& f)
+//input:  N = order, c[nVector*N] = Legendre coefficients
+//output: f[nVector*N] = nodal values
+{
+  const legendreTransformMatrix* m = getLegendreTransformTable().get (N);
+  if ((m == NULL) || (c.size() != nVector*N))
+  {
+    std::cout << "Error in legendreInverse. N = " << N << " c.size() = " << c.size();
+    std::cout << " nVector = " << nVector << "\n";
+    return false;
+  }
+
+  if (nVector == 0)
+  {
+    f.clear();
+    return true;
+  }
+
+  std::vector<double> cEven(m->nEven*nVector), cOdd(m->nOdd*nVector);
+  for (size_t v = 0; v < nVector; v++)
+  {
+    const double *cv = &c[v*N];
+    for (size_t n = 0; n < N; n++)
+    {
+      if (n % 2 == 0)
+        cEven[(n/2)*nVector + v] = cv[n];
+      else
+        cOdd[(n/2)*nVector + v]  = cv[n];
+    }
+  }
+
+  std::vector<double> even(m->nNode*nVector), odd(m->nHalf*nVector);
+  legendreTransformKernel (m->nNode, m->nEven, &m->inverseEven[0], nVector, &cEven[0], &even[0]);
+  if (m->nOdd > 0)
+    legendreTransformKernel (m->nHalf, m->nOdd, &m->inverseOdd[0], nVector, &cOdd[0], &odd[0]);
+
+  f.resize(nVector*N);
+  for (size_t v = 0; v < nVector; v++)
+  {
+    double *fv = &f[v*N];
+    for (size_t i = 0; i < m->nHalf; i++)
+    {
+      fv[i]     = even[i*nVector + v] + odd[i*nVector + v];
+      fv[N-1-i] = even[i*nVector + v] - odd[i*nVector + v];
+    }
+    if (m->nNode > m->nHalf)
+      fv[m->nHalf] = even[m->nHalf*nVector + v];
+  }
+
+  return true;
+}
+
+}//end namespace quadgrid
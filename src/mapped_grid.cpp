@@ -0,0 +1,175 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+#include <cstdlib>
+#include <cmath>
+
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <vector>
+
+#include <quadgrid/mapped_grid.hpp>
+#include <quadgrid/gauss_legendre_grid.hpp>
+
+
+namespace quadgrid
+{
+//mapped unit-scale rules u[N], du[N] (weight times du/dt), cached per (N, infinite, map)
+struct mappedRule
+{
+  std::vector<double> u;
+  std::vector<double> du;
+};
+
+struct mappedTable
+{
+  std::mutex mutex;
+  std::map< std::tuple<size_t, bool, int>, mappedRule > rule;
+};
+
+static mappedTable& getMappedTable ()
+{
+  static mappedTable table;
+  return table;
+}
+
+
+
+static void mappedPoint (const double t, const bool infinite, const mappedGridMap map,
+  double& u, double& dudt)
+//u(t) and du/dt for the unit scale; 1-t and 1+t are formed first to keep the tails accurate
+{
+  const double m = 1.0 - t;
+  const double p = 1.0 + t;
+
+  if (!infinite)
+  {
+    if (map == mappedGridAlgebraic)
+    {
+      u    = p/m;
+      dudt = 2.0/(m*m);
+    }
+    else if (map == mappedGridExponential)
+    {
+      u    = log(2.0/m);
+      dudt = 1.0/m;
+    }
+    else
+    {
+      //s = (1+t)/2, 1-s = (1-t)/2, 1+s = (3+t)/2
+      u    = 0.5*log((3.0 + t)/m);
+      dudt = 2.0/(m*(3.0 + t));
+    }
+  }
+  else
+  {
+    if (map == mappedGridAlgebraic)
+    {
+      const double q = sqrt(m*p);
+      u    = t/q;
+      dudt = 1.0/(m*p*q);
+    }
+    else if (map == mappedGridExponential)
+    {
+      //u = asinh(q), q = t/(1-t^2), dq/dt = (1+t^2)/(1-t^2)^2
+      const double mp = m*p;
+      const double q  = t/mp;
+      u    = asinh(q);
+      dudt = (1.0 + t*t)/(mp*sqrt(mp*mp + t*t));
+    }
+    else
+    {
+      u    = 0.5*log(p/m);
+      dudt = 1.0/(m*p);
+    }
+  }
+}
+
+static bool mappedGrid (const char *name, const size_t N, const bool infinite,
+  std::vector<double>& x, std::vector<double>& w, const double a, const double scale,
+  const mappedGridMap map)
+{
+  if (!(scale > 0.0) || ((map != mappedGridAlgebraic) && (map != mappedGridExponential) &&
+                         (map != mappedGridTanh)))
+  {
+    std::cout << "Error in " << name << ". scale = " << scale << " map = " << (int) map << "\n";
+    return false;
+  }
+
+  mappedTable& table = getMappedTable();
+  const std::tuple<size_t, bool, int> key(N, infinite, (int) map);
+  const mappedRule* r = NULL;
+  {
+    std::lock_guard<std::mutex> lock(table.mutex);
+    auto it = table.rule.find(key);
+    if (it != table.rule.end())
+      r = &it->second;
+  }
+
+  if (r == NULL)
+  {
+    std::vector<double> t, wt;
+    if (!gaussLegendreGrid (N, t, wt, -1.0, 1.0))
+    {
+      std::cout << "Error in " << name << ". N = " << N << " is not supported\n";
+      return false;
+    }
+
+    mappedRule rule;
+    rule.u.resize(N);
+    rule.du.resize(N);
+    for (size_t i = 0; i < N; i++)
+    {
+      double dudt;
+      mappedPoint (t[i], infinite, map, rule.u[i], dudt);
+      rule.du[i] = wt[i]*dudt;
+    }
+
+    //another thread may have stored the rule meanwhile and be reading it: keep it
+    std::lock_guard<std::mutex> lock(table.mutex);
+    r = &table.rule.emplace(key, rule).first->second;
+  }
+
+  x.resize(N);
+  w.resize(N);
+  for (size_t i = 0; i < N; i++)
+  {
+    x[i] = a + scale*r->u[i];
+    w[i] = scale*r->du[i];
+  }
+
+  return true;
+}
+
+
+
+bool gaussLegendreSemiInfiniteGrid (const size_t N, std::vector<double>& x,
+  std::vector<double>& w, const double a, const double scale, const mappedGridMap map)
+//input:  N = order, a = lower bound, scale, map
+//output: x[N] and w[N] = coordinates and weights
+//        Integral{ f(x) } over [a, inf) = Sum{ f(x[i])*w[i] } from i = 0 to N - 1
+{
+  return mappedGrid ("gaussLegendreSemiInfiniteGrid", N, false, x, w, a, scale, map);
+}
+
+bool gaussLegendreInfiniteGrid (const size_t N, std::vector<double>& x,
+  std::vector<double>& w, const double center, const double scale, const mappedGridMap map)
+//input:  N = order, center, scale, map
+//output: x[N] and w[N] = coordinates and weights
+//        Integral{ f(x) } over (-inf, inf) = Sum{ f(x[i])*w[i] } from i = 0 to N - 1
+{
+  return mappedGrid ("gaussLegendreInfiniteGrid", N, true, x, w, center, scale, map);
+}
+
+}//end namespace quadgrid
@@ -0,0 +1,390 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+
+#include <algorithm>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+#include <quadgrid/molecular_grid.hpp>
+#include <quadgrid/mapped_grid.hpp>
+#include <quadgrid/unit_sphere_grid_lebedev.hpp>
+
+
+namespace quadgrid
+{
+struct molecularGridLebedevTable
+{
+  bool initialized = false;
+
+  std::vector<double> coord[unitSphereLebedevNumGrid];
+  std::vector<double> weight[unitSphereLebedevNumGrid];
+
+  bool initialize ()
+  {
+    if (initialized)
+      return true;
+
+    for (size_t index = 0; index < unitSphereLebedevNumGrid; index++)
+    {
+      size_t lmax, nPoint;
+      if (!unitSphereLebedev (index, lmax, nPoint, coord[index], weight[index]))
+        return false;
+    }
+
+    initialized = true;
+    return true;
+  }
+};
+
+static molecularGridLebedevTable& getMolecularGridLebedevTable ()
+{
+  static molecularGridLebedevTable table;
+  return table;
+}
+
+
+
+//neighbors of each atom sorted by increasing distance
+struct molecularGridNeighbor
+{
+  std::vector<size_t> offset;                          //[nAtom+1]
+  std::vector< std::pair<double, size_t> > neighbor;   //[nAtom*(nAtom-1)] (distance, atom)
+
+  void initialize (const size_t nAtom, const double *atomCoord)
+  {
+    offset.resize(nAtom+1);
+    neighbor.resize(nAtom*(nAtom-1));
+
+    #pragma omp parallel for schedule(static)
+    for (size_t A = 0; A < nAtom; A++)
+    {
+      std::pair<double, size_t> *list = &neighbor[A*(nAtom-1)];
+      size_t count = 0;
+      for (size_t B = 0; B < nAtom; B++)
+      {
+        if (B == A)
+          continue;
+        const double dx = atomCoord[3*A  ] - atomCoord[3*B  ];
+        const double dy = atomCoord[3*A+1] - atomCoord[3*B+1];
+        const double dz = atomCoord[3*A+2] - atomCoord[3*B+2];
+        list[count++] = std::make_pair(sqrt(dx*dx + dy*dy + dz*dz), B);
+      }
+      std::sort(list, list + count);
+    }
+
+    for (size_t A = 0; A <= nAtom; A++)
+      offset[A] = A*(nAtom-1);
+  }
+};
+
+
+
+static double beckeCell (double mu)
+{
+  for (int k = 0; k < 3; k++)
+    mu = 1.5*mu - 0.5*mu*mu*mu;
+  return 0.5*(1.0 - mu);
+}
+
+static double stratmannCell (const double mu, const double a)
+{
+  if (mu <= -a)
+    return 1.0;
+  if (mu >=  a)
+    return 0.0;
+
+  const double t  = mu/a;
+  const double t2 = t*t;
+  const double g  = t*(35.0 + t2*(-35.0 + t2*(21.0 - 5.0*t2)))/16.0;
+  return 0.5*(1.0 - g);
+}
+
+//distances from the current grid point to the atoms, evaluated at most once per point
+struct molecularGridDistance
+{
+  const double *atomCoord = nullptr;
+  const double *p         = nullptr;
+  size_t stamp            = 0;
+
+  std::vector<double> r;
+  std::vector<size_t> rStamp;
+
+  void initialize (const size_t nAtom, const double *atomCoordInput)
+  {
+    atomCoord = atomCoordInput;
+    r.assign(nAtom, 0.0);
+    rStamp.assign(nAtom, 0);
+    stamp = 0;
+  }
+
+  void setPoint (const double *point)
+  {
+    p = point;
+    stamp++;
+  }
+
+  double operator() (const size_t A)
+  {
+    if (rStamp[A] != stamp)
+    {
+      const double dx = p[0] - atomCoord[3*A  ];
+      const double dy = p[1] - atomCoord[3*A+1];
+      const double dz = p[2] - atomCoord[3*A+2];
+      r[A]      = sqrt(dx*dx + dy*dy + dz*dz);
+      rStamp[A] = stamp;
+    }
+    return r[A];
+  }
+};
+
+static double stratmannCellProduct (molecularGridDistance& r,
+  const molecularGridNeighbor& nbr, const size_t B, const double rB, const double a)
+//P_B(p) = Prod{ s(mu_BC) } over C != B
+//s(mu_BC) = 1 for R_BC >= 2*rB/(1-a), so the sorted neighbor list is cut there
+{
+  const double cut = 2.0*rB/(1.0 - a);
+
+  double P = 1.0;
+  for (size_t k = nbr.offset[B]; k < nbr.offset[B+1]; k++)
+  {
+    const double RBC = nbr.neighbor[k].first;
+    if (RBC >= cut)
+      break;
+
+    const double s = stratmannCell ((rB - r(nbr.neighbor[k].second))/RBC, a);
+    if (s == 0.0)
+      return 0.0;
+    P *= s;
+  }
+
+  return P;
+}
+
+static double stratmannWeight (molecularGridDistance& r,
+  const molecularGridNeighbor& nbr, const size_t A, const double rA, const double a)
+//only atoms B with R_AB < 2*rA/(1-a) can have P_B(p) != 0
+{
+  if (nbr.offset[A+1] == nbr.offset[A])
+    return 1.0;
+
+  //Stratmann screening: the point lies inside the region owned by A alone
+  if (rA <= 0.5*(1.0 - a)*nbr.neighbor[nbr.offset[A]].first)
+    return 1.0;
+
+  const double PA = stratmannCellProduct (r, nbr, A, rA, a);
+  if (PA == 0.0)
+    return 0.0;
+
+  const double cut = 2.0*rA/(1.0 - a);
+
+  double sum = PA;
+  for (size_t k = nbr.offset[A]; k < nbr.offset[A+1]; k++)
+  {
+    if (nbr.neighbor[k].first >= cut)
+      break;
+
+    //cheap rejection: s(mu_BA) = 0 already makes P_B(p) = 0
+    const size_t B  = nbr.neighbor[k].second;
+    const double rB = r(B);
+    if (rB - rA >= a*nbr.neighbor[k].first)
+      continue;
+
+    sum += stratmannCellProduct (r, nbr, B, rB, a);
+  }
+
+  return PA/sum;
+}
+
+static double beckeWeight (molecularGridDistance& r,
+  const molecularGridNeighbor& nbr, const size_t nAtom, const size_t A)
+//Becke cells have no compact support: all atoms contribute
+{
+  if (nAtom == 1)
+    return 1.0;
+
+  double PA  = 0.0;
+  double sum = 0.0;
+  for (size_t B = 0; B < nAtom; B++)
+  {
+    double P = 1.0;
+    for (size_t k = nbr.offset[B]; k < nbr.offset[B+1]; k++)
+    {
+      const size_t C = nbr.neighbor[k].second;
+      P *= beckeCell ((r(B) - r(C))/nbr.neighbor[k].first);
+      if (P == 0.0)
+        break;
+    }
+    sum += P;
+    if (B == A)
+      PA = P;
+  }
+
+  if (sum == 0.0)
+    return 0.0;
+
+  return PA/sum;
+}
+
+
+
+bool molecularGrid (const size_t nAtom, const double *atomCoord,
+  const double *atomRadius, const molecularGridParameter& parameter,
+  std::vector<double>& x, std::vector<double>& y, std::vector<double>& z,
+  std::vector<double>& weight, std::vector<size_t>& atomOffset)
+//input:  nAtom, atomCoord[3*nAtom], atomRadius[nAtom], parameter
+//output: x[nPoint], y[nPoint], z[nPoint], weight[nPoint], atomOffset[nAtom+1]
+//        Integral{ f(r) } = Sum{ f(x[i],y[i],z[i])*weight[i] } from i = 0 to nPoint - 1
+{
+  const size_t nRadial = parameter.nRadial;
+  const double a       = parameter.stratmannA;
+
+  atomOffset.assign(nAtom+1, 0);
+  if (nAtom == 0)
+  {
+    x.clear();
+    y.clear();
+    z.clear();
+    weight.clear();
+    return true;
+  }
+
+  if ((parameter.lebedevIndex      >= unitSphereLebedevNumGrid) ||
+      (parameter.lebedevIndexInner >= unitSphereLebedevNumGrid) ||
+      (parameter.lebedevIndexOuter >= unitSphereLebedevNumGrid))
+  {
+    std::cout << "Error in molecularGrid\n";
+    std::cout << "  Lebedev grid index must be between 0 and 10\n";
+    return false;
+  }
+
+  if ((parameter.partition == molecularGridStratmann) && ((a <= 0.0) || (a >= 1.0)))
+  {
+    std::cout << "Error in molecularGrid\n";
+    std::cout << "  stratmannA = " << a << " must be between 0 and 1\n";
+    return false;
+  }
+
+
+  //1) radial rule on [0, inf) for R = 1 and Lebedev shells (shared by all atoms)
+  std::vector<double> rRadial, wRadial;
+  if (!gaussLegendreSemiInfiniteGrid (nRadial, rRadial, wRadial, 0.0, 1.0, parameter.radialMap))
+  {
+    std::cout << "Error in molecularGrid\n";
+    std::cout << "  gaussLegendreSemiInfiniteGrid failed for nRadial = " << nRadial << "\n";
+    return false;
+  }
+
+  auto& lebedev = getMolecularGridLebedevTable();
+  if (!lebedev.initialize())
+    return false;
+
+  molecularGridNeighbor nbr;
+  nbr.initialize (nAtom, atomCoord);
+
+
+  //2) grid of each atom, built independently
+  std::vector< std::vector<double> > atomPoint(nAtom);   //[nAtomPoint*4] (x, y, z, w)
+
+  #pragma omp parallel
+  {
+    molecularGridDistance r;
+    r.initialize (nAtom, atomCoord);
+
+    #pragma omp for schedule(dynamic, 1)
+    for (size_t A = 0; A < nAtom; A++)
+    {
+      const double  R      = atomRadius[A];
+      const double *center = &atomCoord[3*A];
+
+      std::vector<double>& point = atomPoint[A];
+      point.clear();
+
+      for (size_t i = 0; i < nRadial; i++)
+      {
+        const double rShell = R*rRadial[i];
+        const double wShell = R*wRadial[i]*rShell*rShell;
+
+        if (rShell > parameter.radialCutoff*R)
+          continue;
+
+        size_t index = parameter.lebedevIndex;
+        if (rShell < parameter.pruneInner*R)
+          index = parameter.lebedevIndexInner;
+        else if (rShell > parameter.pruneOuter*R)
+          index = parameter.lebedevIndexOuter;
+
+        const std::vector<double>& crd = lebedev.coord[index];
+        const std::vector<double>& wgt = lebedev.weight[index];
+        const size_t nPoint = wgt.size();
+
+        for (size_t n = 0; n < nPoint; n++)
+        {
+          double p[3];
+          p[0] = center[0] + rShell*crd[3*n  ];
+          p[1] = center[1] + rShell*crd[3*n+1];
+          p[2] = center[2] + rShell*crd[3*n+2];
+
+          r.setPoint (p);
+
+          double wPartition;
+          if (parameter.partition == molecularGridStratmann)
+            wPartition = stratmannWeight (r, nbr, A, rShell, a);
+          else
+            wPartition = beckeWeight (r, nbr, nAtom, A);
+
+          if (wPartition == 0.0)
+            continue;
+
+          point.push_back(p[0]);
+          point.push_back(p[1]);
+          point.push_back(p[2]);
+          point.push_back(wShell*wgt[n]*wPartition);
+        }
+      }
+    }
+  }
+
+
+  //3) concatenate the atom grids into one structure-of-arrays stream
+  for (size_t A = 0; A < nAtom; A++)
+    atomOffset[A+1] = atomOffset[A] + atomPoint[A].size()/4;
+
+  const size_t nPoint = atomOffset[nAtom];
+  x.resize(nPoint);
+  y.resize(nPoint);
+  z.resize(nPoint);
+  weight.resize(nPoint);
+
+  #pragma omp parallel for schedule(static)
+  for (size_t A = 0; A < nAtom; A++)
+  {
+    const std::vector<double>& point = atomPoint[A];
+    const size_t offset = atomOffset[A];
+    const size_t count  = atomOffset[A+1] - offset;
+    for (size_t n = 0; n < count; n++)
+    {
+      x[offset+n]      = point[4*n  ];
+      y[offset+n]      = point[4*n+1];
+      z[offset+n]      = point[4*n+2];
+      weight[offset+n] = point[4*n+3];
+    }
+  }
+
+  return true;
+}
+
+}//end namespace quadgrid
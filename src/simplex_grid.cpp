@@ -0,0 +1,381 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+#include <cstdlib>
+#include <cmath>
+
+#include <algorithm>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <quadgrid/simplex_grid.hpp>
+#include <quadgrid/gauss_legendre_grid.hpp>
+#include <quadgrid/gauss_family_grid.hpp>
+
+
+namespace quadgrid
+{
+//simplices per OpenMP chunk
+static const size_t simplexChunk = 64;
+
+//largest collapsed order (the Gauss-Legendre table is complete up to 100)
+static const size_t simplexMaxN = 100;
+
+//orbit of a fully symmetric rule in barycentric coordinates, weight per point normalized
+//to the unit volume; triangle: 0 = (1/3,1/3,1/3), 1 = (a,a,1-2a), 2 = (a,b,1-a-b)
+//tetrahedron: 0 = (1/4,1/4,1/4,1/4), 1 = (a,a,a,1-3a), 2 = (a,a,1/2-a,1/2-a)
+struct simplexOrbit
+{
+  int type;
+  double weight;
+  double a;
+  double b;
+};
+
+struct simplexSymmetricRule
+{
+  size_t degree;
+  size_t nOrbit;
+  simplexOrbit orbit[3];
+};
+
+//Strang-Fix / Dunavant rules, refined to double precision on the moment equations
+static const simplexSymmetricRule triangleSymmetricTable[] =
+{
+  {1, 1, {{0, 1.0, 0.0, 0.0}}},
+  {2, 1, {{1, 1.0/3.0, 1.0/6.0, 0.0}}},
+  {4, 2, {{1, 0.22338158967801103, 0.44594849091596478, 0.0},
+          {1, 0.1099517436553223,  0.091576213509771034, 0.0}}},
+  {5, 3, {{0, 0.225, 0.0, 0.0},
+          {1, 0.12593918054482717, 0.10128650732345633, 0.0},
+          {1, 0.13239415278850616, 0.47014206410511505, 0.0}}},
+  {6, 3, {{1, 0.050844906370207318, 0.063089014491502629, 0.0},
+          {1, 0.11678627572638212,  0.24928674517090893,  0.0},
+          {2, 0.082851075618371961, 0.053145049844815898, 0.31035245103378545}}}
+};
+
+//Keast and Walkington rules, refined to double precision on the moment equations
+static const simplexSymmetricRule tetrahedronSymmetricTable[] =
+{
+  {1, 1, {{0, 1.0, 0.0, 0.0}}},
+  {2, 1, {{1, 0.25, 0.1381966011250105, 0.0}}},
+  {3, 2, {{1, 0.13852796563862832, 0.32805469675029852, 0.0},
+          {1, 0.11147203436137167, 0.10695227435276153, 0.0}}},
+  {5, 3, {{1, 0.073493043116362497, 0.092735250310891554, 0.0},
+          {1, 0.1126879257180174,   0.31088591926330039,  0.0},
+          {2, 0.042546020777080099, 0.045503704125647602, 0.0}}}
+};
+
+struct simplexRule
+{
+  std::vector<double> x;
+  std::vector<double> w;
+};
+
+struct simplexTable
+{
+  std::mutex mutex;
+  std::map<std::pair<size_t, size_t>, simplexRule> rule;
+
+  const simplexRule* get (const size_t dimension, const size_t degree)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    const std::pair<size_t, size_t> key(dimension, degree);
+    auto it = rule.find(key);
+    if (it != rule.end())
+      return &it->second;
+
+    simplexRule r;
+    if (!simplexGrid (dimension, degree, r.x, r.w))
+      return NULL;
+    return &(rule[key] = r);
+  }
+};
+
+static simplexTable& getSimplexTable ()
+{
+  static simplexTable table;
+  return table;
+}
+
+
+
+static bool simplexSymmetric (const size_t dimension, const simplexSymmetricRule *table,
+  const size_t nTable, const size_t degree, std::vector<double>& x, std::vector<double>& w)
+//expands the first tabulated rule with at least the degree
+{
+  const simplexSymmetricRule *rule = NULL;
+  for (size_t k = 0; (rule == NULL) && (k < nTable); k++)
+    if (table[k].degree >= degree)
+      rule = &table[k];
+  if ((rule == NULL) || (degree == 0))
+    return false;
+
+  const double volume = (dimension == 2) ? 0.5 : 1.0/6.0;
+  x.clear();
+  w.clear();
+  for (size_t o = 0; o < rule->nOrbit; o++)
+  {
+    const simplexOrbit& orbit = rule->orbit[o];
+    const double a = orbit.a, b = orbit.b;
+    std::vector<double> lambda;
+    if (dimension == 2)
+    {
+      if (orbit.type == 0)      lambda = {1.0/3.0, 1.0/3.0, 1.0/3.0};
+      else if (orbit.type == 1) lambda = {a, a, 1.0 - 2.0*a};
+      else                      lambda = {a, b, 1.0 - a - b};
+    }
+    else
+    {
+      if (orbit.type == 0)      lambda = {0.25, 0.25, 0.25, 0.25};
+      else if (orbit.type == 1) lambda = {a, a, a, 1.0 - 3.0*a};
+      else                      lambda = {a, a, 0.5 - a, 0.5 - a};
+    }
+
+    //distinct permutations; the cartesian point is (lambda[1], .., lambda[dimension])
+    std::sort(lambda.begin(), lambda.end());
+    do
+    {
+      for (size_t i = 0; i < dimension; i++)
+        x.push_back(lambda[i+1]);
+      w.push_back(volume*orbit.weight);
+    } while (std::next_permutation(lambda.begin(), lambda.end()));
+  }
+  return true;
+}
+
+static bool simplexCollapsed (const size_t dimension, const size_t N, std::vector<double>& x,
+  std::vector<double>& w)
+{
+  if ((N == 0) || (N > simplexMaxN))
+    return false;
+
+  //u: Gauss-Legendre on [0, 1]; v and s: Gauss-Jacobi with (1-t)^k = 2^k (1-v)^k
+  std::vector<double> xu, wu, xv, wv, xs, ws;
+  if (!gaussLegendreGridTabulated (N) || !gaussLegendreGrid (N, xu, wu, 0.0, 1.0))
+    return false;
+  xu.resize(N);
+  wu.resize(N);
+  if (!gaussJacobiGrid (N, xv, wv, 1.0, 0.0, 0.0, 1.0))
+    return false;
+  for (size_t i = 0; i < N; i++)
+    wv[i] *= 0.5;
+
+  x.clear();
+  w.clear();
+  if (dimension == 2)
+  {
+    for (size_t j = 0; j < N; j++)
+      for (size_t i = 0; i < N; i++)
+      {
+        x.push_back(xu[i]*(1.0 - xv[j]));
+        x.push_back(xv[j]);
+        w.push_back(wu[i]*wv[j]);
+      }
+    return true;
+  }
+
+  if (!gaussJacobiGrid (N, xs, ws, 2.0, 0.0, 0.0, 1.0))
+    return false;
+  for (size_t k = 0; k < N; k++)
+    ws[k] *= 0.25;
+  for (size_t k = 0; k < N; k++)
+    for (size_t j = 0; j < N; j++)
+      for (size_t i = 0; i < N; i++)
+      {
+        x.push_back(xu[i]*(1.0 - xv[j])*(1.0 - xs[k]));
+        x.push_back(xv[j]*(1.0 - xs[k]));
+        x.push_back(xs[k]);
+        w.push_back(wu[i]*wv[j]*ws[k]);
+      }
+  return true;
+}
+
+static void simplexAffine (const size_t dimension, const double *v, double *jacobian,
+  double& determinant)
+//jacobian[i*dimension + k] = v[k+1][i] - v[0][i], determinant = |det J|
+{
+  for (size_t i = 0; i < dimension; i++)
+    for (size_t k = 0; k < dimension; k++)
+      jacobian[i*dimension+k] = v[(k+1)*dimension+i] - v[i];
+
+  const double *J = jacobian;
+  if (dimension == 2)
+    determinant = J[0]*J[3] - J[1]*J[2];
+  else
+    determinant = J[0]*(J[4]*J[8] - J[5]*J[7]) - J[1]*(J[3]*J[8] - J[5]*J[6]) +
+                  J[2]*(J[3]*J[7] - J[4]*J[6]);
+  determinant = fabs(determinant);
+}
+
+
+
+bool triangleCollapsedGrid (const size_t N, std::vector<double>& x, std::vector<double>& w)
+//input:  N = points per direction
+//output: x[2 N^2] and w[N^2] = points and weights of the reference triangle
+{
+  if (!simplexCollapsed (2, N, x, w))
+  {
+    std::cout << "Error in triangleCollapsedGrid. N = " << N << " (1 .. " << simplexMaxN << ")\n";
+    return false;
+  }
+  return true;
+}
+
+bool tetrahedronCollapsedGrid (const size_t N, std::vector<double>& x, std::vector<double>& w)
+//input:  N = points per direction
+//output: x[3 N^3] and w[N^3] = points and weights of the reference tetrahedron
+{
+  if (!simplexCollapsed (3, N, x, w))
+  {
+    std::cout << "Error in tetrahedronCollapsedGrid. N = " << N << " (1 .. " << simplexMaxN << ")\n";
+    return false;
+  }
+  return true;
+}
+
+bool triangleSymmetricGrid (const size_t degree, std::vector<double>& x, std::vector<double>& w)
+//input:  degree
+//output: x[2 nPoint] and w[nPoint] = points and weights of the reference triangle
+{
+  if (!simplexSymmetric (2, triangleSymmetricTable,
+    sizeof(triangleSymmetricTable)/sizeof(triangleSymmetricTable[0]), degree, x, w))
+  {
+    std::cout << "Error in triangleSymmetricGrid. degree = " << degree << " (1 .. 6)\n";
+    return false;
+  }
+  return true;
+}
+
+bool tetrahedronSymmetricGrid (const size_t degree, std::vector<double>& x, std::vector<double>& w)
+//input:  degree
+//output: x[3 nPoint] and w[nPoint] = points and weights of the reference tetrahedron
+{
+  if (!simplexSymmetric (3, tetrahedronSymmetricTable,
+    sizeof(tetrahedronSymmetricTable)/sizeof(tetrahedronSymmetricTable[0]), degree, x, w))
+  {
+    std::cout << "Error in tetrahedronSymmetricGrid. degree = " << degree << " (1 .. 5)\n";
+    return false;
+  }
+  return true;
+}
+
+bool simplexGrid (const size_t dimension, const size_t degree, std::vector<double>& x,
+  std::vector<double>& w)
+//input:  dimension = 2 or 3, degree
+//output: x[dimension nPoint] and w[nPoint] = points and weights of the reference simplex
+{
+  if (((dimension != 2) && (dimension != 3)) || (degree/2 + 1 > simplexMaxN))
+  {
+    std::cout << "Error in simplexGrid. dimension = " << dimension << " degree = " << degree;
+    std::cout << " (dimension 2 or 3, degree < " << 2*simplexMaxN << ")\n";
+    return false;
+  }
+
+  const size_t maxSymmetric = (dimension == 2) ? 6 : 5;
+  if ((degree >= 1) && (degree <= maxSymmetric))
+    return (dimension == 2) ? triangleSymmetricGrid (degree, x, w) :
+                              tetrahedronSymmetricGrid (degree, x, w);
+
+  return simplexCollapsed (dimension, degree/2 + 1, x, w);
+}
+
+bool simplexMapBatch (const size_t dimension, const std::vector<double>& xRef,
+  const std::vector<double>& wRef, const double *vertex, const size_t nSimplex,
+  std::vector<double>& x, std::vector<double>& w)
+//input:  dimension, xRef and wRef = reference rule, vertex = simplices, nSimplex
+//output: x[nSimplex nPoint dimension] and w[nSimplex nPoint] = mapped points and weights
+{
+  const size_t nPoint = wRef.size();
+  if (((dimension != 2) && (dimension != 3)) || (xRef.size() != dimension*nPoint))
+  {
+    std::cout << "Error in simplexMapBatch. dimension = " << dimension << " xRef.size() = ";
+    std::cout << xRef.size() << " wRef.size() = " << wRef.size() << "\n";
+    return false;
+  }
+
+  x.resize(nSimplex*nPoint*dimension);
+  w.resize(nSimplex*nPoint);
+
+  #pragma omp parallel for schedule(static, simplexChunk)
+  for (size_t s = 0; s < nSimplex; s++)
+  {
+    const double *v = vertex + s*(dimension+1)*dimension;
+    double J[9], determinant;
+    simplexAffine (dimension, v, J, determinant);
+
+    for (size_t p = 0; p < nPoint; p++)
+    {
+      const double *xi = &xRef[p*dimension];
+      double *y = &x[(s*nPoint + p)*dimension];
+      for (size_t i = 0; i < dimension; i++)
+      {
+        y[i] = v[i];
+        for (size_t k = 0; k < dimension; k++)
+          y[i] += J[i*dimension+k]*xi[k];
+      }
+      w[s*nPoint + p] = determinant*wRef[p];
+    }
+  }
+
+  return true;
+}
+
+bool simplexIntegrateBatch (const std::function<double(const double*)>& f,
+  const size_t dimension, const size_t degree, const double *vertex, const size_t nSimplex,
+  std::vector<double>& integral)
+//input:  f = integrand, dimension, degree, vertex = simplices, nSimplex
+//output: integral[nSimplex]
+{
+  //same range as simplexGrid, checked here so that only one message is printed
+  const simplexRule *rule = NULL;
+  if (((dimension == 2) || (dimension == 3)) && (degree/2 + 1 <= simplexMaxN))
+    rule = getSimplexTable().get (dimension, degree);
+  if (rule == NULL)
+  {
+    std::cout << "Error in simplexIntegrateBatch. dimension = " << dimension;
+    std::cout << " degree = " << degree << "\n";
+    return false;
+  }
+
+  const size_t nPoint = rule->w.size();
+  integral.resize(nSimplex);
+
+  #pragma omp parallel for schedule(dynamic, simplexChunk)
+  for (size_t s = 0; s < nSimplex; s++)
+  {
+    const double *v = vertex + s*(dimension+1)*dimension;
+    double J[9], determinant, y[3];
+    simplexAffine (dimension, v, J, determinant);
+
+    double sum = 0.0;
+    for (size_t p = 0; p < nPoint; p++)
+    {
+      const double *xi = &rule->x[p*dimension];
+      for (size_t i = 0; i < dimension; i++)
+      {
+        y[i] = v[i];
+        for (size_t k = 0; k < dimension; k++)
+          y[i] += J[i*dimension+k]*xi[k];
+      }
+      sum += rule->w[p]*f(y);
+    }
+    integral[s] = determinant*sum;
+  }
+
+  return true;
+}
+
+}//end namespace quadgrid
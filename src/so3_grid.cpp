@@ -0,0 +1,276 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+#include <cstdlib>
+#include <cmath>
+
+#include <algorithm>
+#include <complex>
+#include <iostream>
+#include <vector>
+
+#include <quadgrid/so3_grid.hpp>
+#include <quadgrid/wigner.hpp>
+#include <quadgrid/gauss_legendre_grid.hpp>
+#include <quadgrid/unit_sphere_grid_lebedev.hpp>
+#include <quadgrid/fft.hpp>
+#include <quadgrid/constant.hpp>
+
+
+namespace quadgrid
+{
+typedef std::complex<double> so3Complex;
+
+//largest band limit of the SO(3) Fourier transform, B+1 Gauss-Legendre nodes
+static const size_t so3FourierMaxB = 99;
+
+static bool so3GaussLegendre (const size_t N, std::vector<double>& x, std::vector<double>& w)
+//input:  N supported by gaussLegendreGrid
+//output: x[N], w[N] on [-1, 1]
+{
+  if (!gaussLegendreGrid (N, x, w, -1.0, 1.0))
+    return false;
+  x.resize(N);
+  w.resize(N);
+  return true;
+}
+
+static size_t so3GridEulerN (const size_t bandLimit)
+//input:  bandLimit L
+//output: number of Gauss-Legendre nodes in cos(beta), exact for degree 2N-1 >= L
+{
+  size_t N = bandLimit/2 + 1;
+  if ((N > 100) && (N % 10 != 0))
+    N = 10*(N/10 + 1);
+  return N;
+}
+
+bool so3Grid (const size_t bandLimit, const so3GridType type, size_t& bandLimitExact,
+  std::vector<double>& euler, std::vector<double>& weight)
+//input:  bandLimit L, type
+//output: bandLimitExact, euler[3*nPoint], weight[nPoint] (sum 1)
+{
+  const size_t nGamma = bandLimit+1;
+  const size_t N = so3GridEulerN (bandLimit);
+
+  //smallest Lebedev grid of degree >= L
+  size_t index = 0;
+  while ((index < unitSphereLebedevNumGrid) && (unitSphereLebedevLmax[index] < bandLimit))
+    index++;
+  if ((type == so3GridLebedev) && (index == unitSphereLebedevNumGrid))
+  {
+    std::cout << "Error in so3Grid. bandLimit = " << bandLimit << " > "
+      << unitSphereLebedevLmax[unitSphereLebedevNumGrid-1] << " for so3GridLebedev\n";
+    return false;
+  }
+
+  //the gaps between the Lebedev degrees can make the Euler grid the smaller one
+  if ((type == so3GridEuler) || ((bandLimit+1)*N < unitSphereLebedevNumPoint[index]))
+  {
+    if (N > 1000)
+    {
+      std::cout << "Error in so3Grid. bandLimit = " << bandLimit << " > 1998\n";
+      return false;
+    }
+    std::vector<double> x, w;
+    if (!so3GaussLegendre (N, x, w))
+      return false;
+
+    const size_t nAlpha = bandLimit+1;
+    bandLimitExact = std::min(std::min(nAlpha, nGamma) - 1, 2*N - 1);
+    euler.resize(3*nAlpha*N*nGamma);
+    weight.resize(nAlpha*N*nGamma);
+    size_t i = 0;
+    for (size_t a = 0; a < nAlpha; a++)
+      for (size_t j = 0; j < N; j++)
+        for (size_t g = 0; g < nGamma; g++)
+        {
+          euler[3*i]   = 2.0*Pi*a/nAlpha;
+          euler[3*i+1] = acos(x[j]);
+          euler[3*i+2] = 2.0*Pi*g/nGamma;
+          weight[i]    = 0.5*w[j]/(nAlpha*nGamma);
+          i++;
+        }
+    return true;
+  }
+
+  size_t lmax, nPoint;
+  std::vector<double> coord, w;
+  if (!unitSphereLebedev (index, lmax, nPoint, coord, w))
+    return false;
+
+  //D^l_(m 0)(alpha, beta, 0) is a spherical harmonic of degree l in the direction (beta, alpha)
+  bandLimitExact = std::min(lmax, nGamma - 1);
+  euler.resize(3*nPoint*nGamma);
+  weight.resize(nPoint*nGamma);
+  size_t i = 0;
+  for (size_t k = 0; k < nPoint; k++)
+  {
+    const double *r = &coord[3*k];
+    const double beta  = acos(std::max(-1.0, std::min(1.0, r[2])));
+    const double alpha = atan2(r[1], r[0]);
+    for (size_t g = 0; g < nGamma; g++)
+    {
+      euler[3*i]   = alpha;
+      euler[3*i+1] = beta;
+      euler[3*i+2] = 2.0*Pi*g/nGamma;
+      weight[i]    = w[k]/(4.0*Pi*nGamma);
+      i++;
+    }
+  }
+  return true;
+}
+
+
+
+bool so3FourierGrid (const size_t B, std::vector<double>& alpha, std::vector<double>& beta,
+  std::vector<double>& gamma)
+//input:  B
+//output: alpha[2B+1], beta[B+1], gamma[2B+1]
+{
+  if (B > so3FourierMaxB)
+  {
+    std::cout << "Error in so3FourierGrid. B = " << B << " > " << so3FourierMaxB << "\n";
+    return false;
+  }
+  std::vector<double> w;
+  if (!so3GaussLegendre (B+1, beta, w))
+    return false;
+  for (size_t j = 0; j <= B; j++)
+    beta[j] = acos(beta[j]);
+
+  const size_t n = 2*B+1;
+  alpha.resize(n);
+  gamma.resize(n);
+  for (size_t a = 0; a < n; a++)
+    alpha[a] = gamma[a] = 2.0*Pi*a/n;
+  return true;
+}
+
+static void so3FFT2D (const size_t n, so3Complex *F, const bool inverse,
+  std::vector<so3Complex>& work)
+//input:  F[n*n] row-major (alpha, gamma)
+//output: F = unnormalized 2D DFT, e^(+i) for inverse
+{
+  work.resize(n);
+  for (size_t a = 0; a < n; a++)
+  {
+    work.assign(F + a*n, F + (a+1)*n);
+    fft (work, inverse);
+    for (size_t g = 0; g < n; g++)
+      F[a*n+g] = work[g];
+  }
+  for (size_t g = 0; g < n; g++)
+  {
+    for (size_t a = 0; a < n; a++)
+      work[a] = F[a*n+g];
+    fft (work, inverse);
+    for (size_t a = 0; a < n; a++)
+      F[a*n+g] = work[a];
+  }
+}
+
+bool so3FourierForward (const size_t B, const std::vector<so3Complex>& f,
+  std::vector<so3Complex>& c)
+//input:  B, f[(B+1)(2B+1)^2]
+//output: c[wignerArraySize(B)]
+{
+  std::vector<double> alpha, beta, gamma, x, w;
+  if (!so3FourierGrid (B, alpha, beta, gamma) || !so3GaussLegendre (B+1, x, w))
+    return false;
+  const size_t n = 2*B+1;
+  if (f.size() != (B+1)*n*n)
+  {
+    std::cout << "Error in so3FourierForward. f.size() = " << f.size() << " != "
+      << (B+1)*n*n << "\n";
+    return false;
+  }
+
+  const int L = (int) B;
+  c.assign(wignerArraySize (B), 0.0);
+
+  #pragma omp parallel
+  {
+    std::vector<so3Complex> F(n*n), cPartial(c.size(), 0.0), work;
+    std::vector<double> d;
+
+    #pragma omp for schedule(dynamic)
+    for (size_t j = 0; j <= B; j++)
+    {
+      //F(m,n) = Sum{ f e^(i m alpha) e^(i n gamma) }/(2B+1)^2 at index (m mod 2B+1, n mod 2B+1)
+      F.assign(f.begin() + j*n*n, f.begin() + (j+1)*n*n);
+      so3FFT2D (n, &F[0], true, work);
+      wignerSmallD (B, beta[j], d);
+
+      const double wj = 0.5*w[j]/(n*n);
+      for (int l = 0; l <= L; l++)
+        for (int m = -l; m <= l; m++)
+          for (int k = -l; k <= l; k++)
+          {
+            const size_t index = wignerArrayIndex (l, m, k);
+            cPartial[index] += (2.0*l+1.0)*wj*d[index]*F[((m+n) % n)*n + (k+n) % n];
+          }
+    }
+
+    #pragma omp critical
+    for (size_t i = 0; i < c.size(); i++)
+      c[i] += cPartial[i];
+  }
+  return true;
+}
+
+bool so3FourierInverse (const size_t B, const std::vector<so3Complex>& c,
+  std::vector<so3Complex>& f)
+//input:  B, c[wignerArraySize(B)]
+//output: f[(B+1)(2B+1)^2]
+{
+  std::vector<double> alpha, beta, gamma;
+  if (!so3FourierGrid (B, alpha, beta, gamma))
+    return false;
+  if (c.size() != wignerArraySize (B))
+  {
+    std::cout << "Error in so3FourierInverse. c.size() = " << c.size() << " != "
+      << wignerArraySize (B) << "\n";
+    return false;
+  }
+
+  const size_t n = 2*B+1;
+  const int L = (int) B;
+  f.resize((B+1)*n*n);
+
+  #pragma omp parallel
+  {
+    std::vector<so3Complex> work;
+    std::vector<double> d;
+
+    #pragma omp for schedule(dynamic)
+    for (size_t j = 0; j <= B; j++)
+    {
+      //G(m,n) = Sum{ c(l,m,n) d^l_(m n)(beta_j) }, then f = Sum{ G e^(-i m alpha) e^(-i n gamma) }
+      so3Complex *F = &f[j*n*n];
+      for (size_t i = 0; i < n*n; i++)
+        F[i] = 0.0;
+      wignerSmallD (B, beta[j], d);
+      for (int l = 0; l <= L; l++)
+        for (int m = -l; m <= l; m++)
+          for (int k = -l; k <= l; k++)
+          {
+            const size_t index = wignerArrayIndex (l, m, k);
+            F[((m+n) % n)*n + (k+n) % n] += c[index]*d[index];
+          }
+      so3FFT2D (n, F, false, work);
+    }
+  }
+  return true;
+}
+
+}//end namespace quadgrid
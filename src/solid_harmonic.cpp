@@ -0,0 +1,716 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+#include <cstdlib>
+#include <cmath>
+
+#include <algorithm>
+#include <complex>
+#include <iostream>
+#include <vector>
+
+#include <quadgrid/solid_harmonic.hpp>
+#include <quadgrid/spherical_harmonic.hpp>
+#include <quadgrid/wigner.hpp>
+#include <quadgrid/constant.hpp>
+
+
+namespace quadgrid
+{
+typedef std::complex<double> solidHarmonicComplex;
+
+//particles per vectorized block
+static const size_t multipoleBlock = 8;
+
+//factorials up to (2 multipoleMaxOrder)! and s(l,m) = sqrt((l+m)! (l-m)!)
+struct solidHarmonicTable
+{
+  std::vector<double> factorial;
+  std::vector<double> scale;     //layout of sphereHarmonicArrayIndex
+
+  solidHarmonicTable ()
+  {
+    factorial.resize(2*multipoleMaxOrder+1);
+    factorial[0] = 1.0;
+    for (size_t k = 1; k < factorial.size(); k++)
+      factorial[k] = k*factorial[k-1];
+
+    scale.resize(sphereHarmonicArraySize (multipoleMaxOrder));
+    for (size_t l = 0; l <= multipoleMaxOrder; l++)
+      for (size_t m = 0; m <= l; m++)
+        scale[sphereHarmonicArrayIndex (l, m)] = sqrt(factorial[l+m]*factorial[l-m]);
+  }
+};
+
+static const solidHarmonicTable& getSolidHarmonicTable ()
+{
+  static solidHarmonicTable table;
+  return table;
+}
+
+
+
+static bool solidHarmonicScale (std::vector<solidHarmonicComplex>& H, const size_t lmax,
+  const double r[3], const solidHarmonicNormalization normalization, const bool regular)
+//input:  H = Y(l,m) of r/|r|, lmax, r, normalization
+//output: H = r^l Y or r^-(l+1) Y in the requested normalization
+{
+  const solidHarmonicTable& table = getSolidHarmonicTable ();
+  const double rNorm = sqrt(r[0]*r[0] + r[1]*r[1] + r[2]*r[2]);
+  const double rFactor = regular ? rNorm : 1.0/rNorm;
+  double rPower = regular ? 1.0 : 1.0/rNorm;
+  for (size_t l = 0; l <= lmax; l++)
+  {
+    double factor = rPower;
+    if (normalization == solidHarmonicRacah)
+      factor *= sqrt(4.0*Pi/(2.0*l+1.0));
+    for (size_t m = 0; m <= l; m++)
+    {
+      const size_t index = sphereHarmonicArrayIndex (l, m);
+      if (normalization == solidHarmonicRacah)
+        H[index] *= regular ? factor/table.scale[index] : factor*table.scale[index];
+      else
+        H[index] *= factor;
+    }
+    rPower *= rFactor;
+  }
+  return true;
+}
+
+bool solidHarmonicRegular (std::vector<solidHarmonicComplex>& R, const size_t lmax,
+  const double r[3], const solidHarmonicNormalization normalization)
+//input:  lmax, r[3], normalization
+//output: R[sphereHarmonicArraySize(lmax)]
+{
+  if ((normalization == solidHarmonicRacah) && (lmax > multipoleMaxOrder))
+  {
+    std::cout << "Error in solidHarmonicRegular. lmax = " << lmax << " > "
+      << multipoleMaxOrder << "\n";
+    return false;
+  }
+
+  const double rNorm = sqrt(r[0]*r[0] + r[1]*r[1] + r[2]*r[2]);
+  if (rNorm == 0.0)
+  {
+    R.assign(sphereHarmonicArraySize (lmax), 0.0);
+    R[0] = (normalization == solidHarmonicRacah) ? 1.0 : sqrt(1.0/4.0/Pi);
+    return true;
+  }
+
+  const double rUnit[3] = {r[0]/rNorm, r[1]/rNorm, r[2]/rNorm};
+  sphereHarmonic (R, lmax, rUnit);
+  return solidHarmonicScale (R, lmax, r, normalization, true);
+}
+
+bool solidHarmonicIrregular (std::vector<solidHarmonicComplex>& I, const size_t lmax,
+  const double r[3], const solidHarmonicNormalization normalization)
+//input:  lmax, r[3], normalization
+//output: I[sphereHarmonicArraySize(lmax)]
+{
+  if ((normalization == solidHarmonicRacah) && (lmax > multipoleMaxOrder))
+  {
+    std::cout << "Error in solidHarmonicIrregular. lmax = " << lmax << " > "
+      << multipoleMaxOrder << "\n";
+    return false;
+  }
+
+  const double rNorm = sqrt(r[0]*r[0] + r[1]*r[1] + r[2]*r[2]);
+  if (rNorm == 0.0)
+  {
+    std::cout << "Error in solidHarmonicIrregular. r = 0\n";
+    return false;
+  }
+
+  const double rUnit[3] = {r[0]/rNorm, r[1]/rNorm, r[2]/rNorm};
+  sphereHarmonic (I, lmax, rUnit);
+  return solidHarmonicScale (I, lmax, r, normalization, false);
+}
+
+
+
+static void regularBlock (const size_t p, const double *x, const double *y, const double *z,
+  double *Rre, double *Rim)
+//input:  p, x[B], y[B], z[B] of a block of B = multipoleBlock points
+//output: Rre, Rim[sphereHarmonicArraySize(p)*B], R(l,m) of the Racah normalization
+//        R(m,m) = -(x+iy)/(2m) R(m-1,m-1)
+//        R(l,m) = ((2l-1) z R(l-1,m) - r^2 R(l-2,m))/((l+m)(l-m))
+{
+  const size_t B = multipoleBlock;
+  double r2[multipoleBlock];
+  for (size_t b = 0; b < B; b++)
+  {
+    r2[b]  = x[b]*x[b] + y[b]*y[b] + z[b]*z[b];
+    Rre[b] = 1.0;
+    Rim[b] = 0.0;
+  }
+
+  for (size_t m = 0; m <= p; m++)
+  {
+    double *R0re = Rre + sphereHarmonicArrayIndex (m, m)*B;
+    double *R0im = Rim + sphereHarmonicArrayIndex (m, m)*B;
+    if (m > 0)
+    {
+      const double *R1re = Rre + sphereHarmonicArrayIndex (m-1, m-1)*B;
+      const double *R1im = Rim + sphereHarmonicArrayIndex (m-1, m-1)*B;
+      const double c = -1.0/(2.0*m);
+      for (size_t b = 0; b < B; b++)
+      {
+        R0re[b] = c*(x[b]*R1re[b] - y[b]*R1im[b]);
+        R0im[b] = c*(x[b]*R1im[b] + y[b]*R1re[b]);
+      }
+    }
+    if (m == p)
+      break;
+
+    double *R1re = Rre + sphereHarmonicArrayIndex (m+1, m)*B;
+    double *R1im = Rim + sphereHarmonicArrayIndex (m+1, m)*B;
+    for (size_t b = 0; b < B; b++)
+    {
+      R1re[b] = z[b]*R0re[b];
+      R1im[b] = z[b]*R0im[b];
+    }
+
+    for (size_t l = m+2; l <= p; l++)
+    {
+      const double c  = 1.0/((l+m)*(l-m));
+      const double cz = (2.0*l-1.0)*c;
+      const double *R2re = Rre + sphereHarmonicArrayIndex (l-2, m)*B;
+      const double *R2im = Rim + sphereHarmonicArrayIndex (l-2, m)*B;
+      const double *Rlre = Rre + sphereHarmonicArrayIndex (l-1, m)*B;
+      const double *Rlim = Rim + sphereHarmonicArrayIndex (l-1, m)*B;
+      double *Rre0 = Rre + sphereHarmonicArrayIndex (l, m)*B;
+      double *Rim0 = Rim + sphereHarmonicArrayIndex (l, m)*B;
+      for (size_t b = 0; b < B; b++)
+      {
+        Rre0[b] = cz*z[b]*Rlre[b] - c*r2[b]*R2re[b];
+        Rim0[b] = cz*z[b]*Rlim[b] - c*r2[b]*R2im[b];
+      }
+    }
+  }
+}
+
+static void irregularBlock (const size_t p, const double *x, const double *y, const double *z,
+  double *Ire, double *Iim)
+//input:  p, x[B], y[B], z[B] of a block of B = multipoleBlock points, none at the origin
+//output: Ire, Iim[sphereHarmonicArraySize(p)*B], I(l,m) of the Racah normalization
+//        I(m,m) = -(2m-1)(x+iy)/r^2 I(m-1,m-1)
+//        I(l,m) = ((2l-1) z I(l-1,m) - (l-1+m)(l-1-m) I(l-2,m))/r^2
+{
+  const size_t B = multipoleBlock;
+  double rInv2[multipoleBlock];
+  for (size_t b = 0; b < B; b++)
+  {
+    rInv2[b] = 1.0/(x[b]*x[b] + y[b]*y[b] + z[b]*z[b]);
+    Ire[b]   = sqrt(rInv2[b]);
+    Iim[b]   = 0.0;
+  }
+
+  for (size_t m = 0; m <= p; m++)
+  {
+    double *I0re = Ire + sphereHarmonicArrayIndex (m, m)*B;
+    double *I0im = Iim + sphereHarmonicArrayIndex (m, m)*B;
+    if (m > 0)
+    {
+      const double *I1re = Ire + sphereHarmonicArrayIndex (m-1, m-1)*B;
+      const double *I1im = Iim + sphereHarmonicArrayIndex (m-1, m-1)*B;
+      const double c = -(2.0*m-1.0);
+      for (size_t b = 0; b < B; b++)
+      {
+        I0re[b] = c*rInv2[b]*(x[b]*I1re[b] - y[b]*I1im[b]);
+        I0im[b] = c*rInv2[b]*(x[b]*I1im[b] + y[b]*I1re[b]);
+      }
+    }
+    if (m == p)
+      break;
+
+    double *I1re = Ire + sphereHarmonicArrayIndex (m+1, m)*B;
+    double *I1im = Iim + sphereHarmonicArrayIndex (m+1, m)*B;
+    for (size_t b = 0; b < B; b++)
+    {
+      I1re[b] = (2.0*m+1.0)*z[b]*rInv2[b]*I0re[b];
+      I1im[b] = (2.0*m+1.0)*z[b]*rInv2[b]*I0im[b];
+    }
+
+    for (size_t l = m+2; l <= p; l++)
+    {
+      const double cz = 2.0*l-1.0;
+      const double c  = (double) (l-1+m)*(l-1-m);
+      const double *I2re = Ire + sphereHarmonicArrayIndex (l-2, m)*B;
+      const double *I2im = Iim + sphereHarmonicArrayIndex (l-2, m)*B;
+      const double *Ilre = Ire + sphereHarmonicArrayIndex (l-1, m)*B;
+      const double *Ilim = Iim + sphereHarmonicArrayIndex (l-1, m)*B;
+      double *Ire0 = Ire + sphereHarmonicArrayIndex (l, m)*B;
+      double *Iim0 = Iim + sphereHarmonicArrayIndex (l, m)*B;
+      for (size_t b = 0; b < B; b++)
+      {
+        Ire0[b] = rInv2[b]*(cz*z[b]*Ilre[b] - c*I2re[b]);
+        Iim0[b] = rInv2[b]*(cz*z[b]*Ilim[b] - c*I2im[b]);
+      }
+    }
+  }
+}
+
+static void multipoleGather (const size_t i0, const size_t nParticle, const double center[3],
+  const double *position, const double *charge, double *x, double *y, double *z, double *q)
+//input:  block start i0, particles, center
+//output: relative positions and charges of the block; missing particles get r = (1,0,0), q = 0
+{
+  for (size_t b = 0; b < multipoleBlock; b++)
+  {
+    const size_t i = i0 + b;
+    if (i < nParticle)
+    {
+      x[b] = position[3*i]   - center[0];
+      y[b] = position[3*i+1] - center[1];
+      z[b] = position[3*i+2] - center[2];
+      q[b] = (charge) ? charge[i] : 0.0;
+    }
+    else
+    {
+      x[b] = 1.0;
+      y[b] = 0.0;
+      z[b] = 0.0;
+      q[b] = 0.0;
+    }
+  }
+}
+
+static bool multipoleCheck (const char *name, const size_t p, const size_t sizeExpansion)
+//input:  routine name, order p, size of an expansion
+//output: false if p is out of range or the size is not sphereHarmonicArraySize(p)
+{
+  if (p > multipoleMaxOrder)
+  {
+    std::cout << "Error in " << name << ". p = " << p << " > " << multipoleMaxOrder << "\n";
+    return false;
+  }
+  if (sizeExpansion != sphereHarmonicArraySize (p))
+  {
+    std::cout << "Error in " << name << ". expansion size " << sizeExpansion << " != "
+      << sphereHarmonicArraySize (p) << "\n";
+    return false;
+  }
+  return true;
+}
+
+static void multipoleResize (const size_t p, std::vector<solidHarmonicComplex>& A)
+//output: A = 0 of size sphereHarmonicArraySize(p) if A is empty
+{
+  if (A.empty())
+    A.assign(sphereHarmonicArraySize (p), 0.0);
+}
+
+static bool multipoleCheckBlock (const char *name, const size_t nParticle, const double center[3],
+  const double *position)
+//input:  routine name, particles, center
+//output: false if a particle is at the center
+{
+  for (size_t i = 0; i < nParticle; i++)
+    if ((position[3*i] == center[0]) && (position[3*i+1] == center[1]) &&
+        (position[3*i+2] == center[2]))
+    {
+      std::cout << "Error in " << name << ". particle " << i << " is at the center\n";
+      return false;
+    }
+  return true;
+}
+
+
+
+bool multipoleP2M (const size_t p, const double center[3], const size_t nParticle,
+  const double *position, const double *charge, std::vector<solidHarmonicComplex>& M)
+//input:  p, center[3], nParticle, position[3*nParticle], charge[nParticle]
+//output: M[sphereHarmonicArraySize(p)] += Sum{ q conj(R(l,m)) }
+{
+  multipoleResize (p, M);
+  if (!multipoleCheck ("multipoleP2M", p, M.size()))
+    return false;
+
+  const size_t B = multipoleBlock;
+  const size_t size = sphereHarmonicArraySize (p);
+  std::vector<double> Rre(size*B), Rim(size*B);
+  double x[multipoleBlock], y[multipoleBlock], z[multipoleBlock], q[multipoleBlock];
+  for (size_t i0 = 0; i0 < nParticle; i0 += B)
+  {
+    multipoleGather (i0, nParticle, center, position, charge, x, y, z, q);
+    regularBlock (p, x, y, z, &Rre[0], &Rim[0]);
+    for (size_t k = 0; k < size; k++)
+    {
+      double re = 0.0, im = 0.0;
+      for (size_t b = 0; b < B; b++)
+      {
+        re += q[b]*Rre[k*B+b];
+        im -= q[b]*Rim[k*B+b];
+      }
+      M[k] += solidHarmonicComplex(re, im);
+    }
+  }
+  return true;
+}
+
+bool multipoleP2L (const size_t p, const double center[3], const size_t nParticle,
+  const double *position, const double *charge, std::vector<solidHarmonicComplex>& L)
+//input:  p, center[3], nParticle, position[3*nParticle], charge[nParticle]
+//output: L[sphereHarmonicArraySize(p)] += Sum{ q conj(I(l,m)) }
+{
+  multipoleResize (p, L);
+  if (!multipoleCheck ("multipoleP2L", p, L.size()))
+    return false;
+  if (!multipoleCheckBlock ("multipoleP2L", nParticle, center, position))
+    return false;
+
+  const size_t B = multipoleBlock;
+  const size_t size = sphereHarmonicArraySize (p);
+  std::vector<double> Ire(size*B), Iim(size*B);
+  double x[multipoleBlock], y[multipoleBlock], z[multipoleBlock], q[multipoleBlock];
+  for (size_t i0 = 0; i0 < nParticle; i0 += B)
+  {
+    multipoleGather (i0, nParticle, center, position, charge, x, y, z, q);
+    irregularBlock (p, x, y, z, &Ire[0], &Iim[0]);
+    for (size_t k = 0; k < size; k++)
+    {
+      double re = 0.0, im = 0.0;
+      for (size_t b = 0; b < B; b++)
+      {
+        re += q[b]*Ire[k*B+b];
+        im -= q[b]*Iim[k*B+b];
+      }
+      L[k] += solidHarmonicComplex(re, im);
+    }
+  }
+  return true;
+}
+
+
+
+static void multipoleRotate (const size_t p, const std::vector<double>& d, const double phi,
+  const bool forward, std::vector<solidHarmonicComplex>& a)
+//input:  coefficients a(l,m), m >= 0, of a real function Sum{ a(l,m) Y(l,m) }, a(l,-m) = (-1)^m conj(a(l,m))
+//        d = Wigner matrices of beta
+//output: forward:  coefficients in the frame where the direction (beta, phi) is +z
+//                  a'(l,n) = Sum{ a(l,m) e^(i m phi) d^l_(m n) }
+//        backward: the inverse, a(l,m) = e^(-i m phi) Sum{ d^l_(m n) a'(l,n) }
+{
+  std::vector<solidHarmonicComplex> b(p+1), e(p+1);
+  for (size_t m = 0; m <= p; m++)
+    e[m] = std::polar(1.0, (forward ? 1.0 : -1.0)*m*phi);
+
+  for (size_t l = 0; l <= p; l++)
+  {
+    const size_t offset = wignerArrayIndex (l, -(int) l, -(int) l);
+    const int n2 = 2*l+1;
+    solidHarmonicComplex *al = &a[sphereHarmonicArrayIndex (l, 0)];
+    if (forward)
+      for (size_t m = 0; m <= l; m++)
+        al[m] *= e[m];
+
+    for (size_t n = 0; n <= l; n++)
+    {
+      solidHarmonicComplex sum = 0.0;
+      if (forward)
+      {
+        //d^l_(m n) for m = 0, +-1 .. +-l
+        sum = al[0]*d[offset + l*n2 + n+l];
+        for (size_t m = 1; m <= l; m++)
+        {
+          const double sign = (m % 2 == 0) ? 1.0 : -1.0;
+          sum += al[m]*d[offset + (l+m)*n2 + n+l] + sign*std::conj(al[m])*d[offset + (l-m)*n2 + n+l];
+        }
+      }
+      else
+      {
+        //d^l_(n m) for m = 0, +-1 .. +-l
+        sum = al[0]*d[offset + (n+l)*n2 + l];
+        for (size_t m = 1; m <= l; m++)
+        {
+          const double sign = (m % 2 == 0) ? 1.0 : -1.0;
+          sum += al[m]*d[offset + (n+l)*n2 + l+m] + sign*std::conj(al[m])*d[offset + (n+l)*n2 + l-m];
+        }
+      }
+      b[n] = sum;
+    }
+
+    for (size_t m = 0; m <= l; m++)
+      al[m] = forward ? b[m] : b[m]*e[m];
+  }
+}
+
+//expansion types of multipoleTranslate
+enum multipoleShift
+{
+  multipoleShiftM2M,
+  multipoleShiftM2L,
+  multipoleShiftL2L
+};
+
+static void multipoleTranslate (const size_t p, const double from[3],
+  const std::vector<solidHarmonicComplex>& A, const double to[3], const multipoleShift shift,
+  std::vector<solidHarmonicComplex>& B)
+//input:  expansion A about from, order p, type of the translation
+//output: B += translated expansion about to
+//        rotate (to - from) onto +z, translate along z in O(p^3), rotate back
+{
+  const solidHarmonicTable& table = getSolidHarmonicTable ();
+  const size_t size = sphereHarmonicArraySize (p);
+  const double t[3] = {to[0] - from[0], to[1] - from[1], to[2] - from[2]};
+  const double D = sqrt(t[0]*t[0] + t[1]*t[1] + t[2]*t[2]);
+  if (D == 0.0)
+  {
+    for (size_t k = 0; k < size; k++)
+      B[k] += A[k];
+    return;
+  }
+
+  const double beta = acos(std::max(-1.0, std::min(1.0, t[2]/D)));
+  const double phi  = atan2(t[1], t[0]);
+  std::vector<double> d;
+  wignerSmallD (p, beta, d);
+
+  //multipole coefficients times s and local coefficients over s are coefficients of Y(l,m)
+  const bool inMultipole  = (shift != multipoleShiftL2L);
+  const bool outMultipole = (shift == multipoleShiftM2M);
+  std::vector<solidHarmonicComplex> a(size), c(size, 0.0);
+  for (size_t k = 0; k < size; k++)
+    a[k] = inMultipole ? A[k]*table.scale[k] : A[k]/table.scale[k];
+  multipoleRotate (p, d, phi, true, a);
+  for (size_t k = 0; k < size; k++)
+    a[k] = inMultipole ? a[k]/table.scale[k] : a[k]*table.scale[k];
+
+  //translation along z by +D (from -> to)
+  std::vector<double> power(2*p+2);
+  if (shift == multipoleShiftM2L)
+  {
+    //L(j,m) = (-1)^(j+m) Sum{ (l+j)! M(l,m)/D^(l+j+1) }
+    power[0] = 1.0;
+    for (size_t k = 1; k < power.size(); k++)
+      power[k] = power[k-1]/D;
+    for (size_t m = 0; m <= p; m++)
+      for (size_t j = m; j <= p; j++)
+      {
+        solidHarmonicComplex sum = 0.0;
+        for (size_t l = m; l <= p; l++)
+          sum += table.factorial[l+j]*power[l+j+1]*a[sphereHarmonicArrayIndex (l, m)];
+        c[sphereHarmonicArrayIndex (j, m)] = ((j+m) % 2 == 0) ? sum : -sum;
+      }
+  }
+  else
+  {
+    //M2M: M'(l,m) = Sum{ M(j,m) (-D)^(l-j)/(l-j)! }, L2L: L'(j,m) = Sum{ L(l,m) D^(l-j)/(l-j)! }
+    const double step = (shift == multipoleShiftM2M) ? -D : D;
+    power[0] = 1.0;
+    for (size_t k = 1; k <= p; k++)
+      power[k] = power[k-1]*step/k;
+    for (size_t m = 0; m <= p; m++)
+      for (size_t j = m; j <= p; j++)
+        for (size_t l = j; l <= p; l++)
+        {
+          if (shift == multipoleShiftM2M)
+            c[sphereHarmonicArrayIndex (l, m)] += power[l-j]*a[sphereHarmonicArrayIndex (j, m)];
+          else
+            c[sphereHarmonicArrayIndex (j, m)] += power[l-j]*a[sphereHarmonicArrayIndex (l, m)];
+        }
+  }
+
+  for (size_t k = 0; k < size; k++)
+    c[k] = outMultipole ? c[k]*table.scale[k] : c[k]/table.scale[k];
+  multipoleRotate (p, d, phi, false, c);
+  for (size_t k = 0; k < size; k++)
+    B[k] += outMultipole ? c[k]/table.scale[k] : c[k]*table.scale[k];
+}
+
+bool multipoleM2M (const size_t p, const double centerFrom[3],
+  const std::vector<solidHarmonicComplex>& M, const double centerTo[3],
+  std::vector<solidHarmonicComplex>& Mto)
+//input:  p, M[sphereHarmonicArraySize(p)] about centerFrom
+//output: Mto += M about centerTo
+{
+  multipoleResize (p, Mto);
+  if (!multipoleCheck ("multipoleM2M", p, M.size()) || !multipoleCheck ("multipoleM2M", p, Mto.size()))
+    return false;
+  multipoleTranslate (p, centerFrom, M, centerTo, multipoleShiftM2M, Mto);
+  return true;
+}
+
+bool multipoleM2L (const size_t p, const double centerFrom[3],
+  const std::vector<solidHarmonicComplex>& M, const double centerTo[3],
+  std::vector<solidHarmonicComplex>& L)
+//input:  p, M[sphereHarmonicArraySize(p)] about centerFrom
+//output: L += local expansion about centerTo
+{
+  multipoleResize (p, L);
+  if (!multipoleCheck ("multipoleM2L", p, M.size()) || !multipoleCheck ("multipoleM2L", p, L.size()))
+    return false;
+  if ((centerFrom[0] == centerTo[0]) && (centerFrom[1] == centerTo[1]) && (centerFrom[2] == centerTo[2]))
+  {
+    std::cout << "Error in multipoleM2L. the centers coincide\n";
+    return false;
+  }
+  multipoleTranslate (p, centerFrom, M, centerTo, multipoleShiftM2L, L);
+  return true;
+}
+
+bool multipoleL2L (const size_t p, const double centerFrom[3],
+  const std::vector<solidHarmonicComplex>& L, const double centerTo[3],
+  std::vector<solidHarmonicComplex>& Lto)
+//input:  p, L[sphereHarmonicArraySize(p)] about centerFrom
+//output: Lto += L about centerTo
+{
+  multipoleResize (p, Lto);
+  if (!multipoleCheck ("multipoleL2L", p, L.size()) || !multipoleCheck ("multipoleL2L", p, Lto.size()))
+    return false;
+  multipoleTranslate (p, centerFrom, L, centerTo, multipoleShiftL2L, Lto);
+  return true;
+}
+
+
+
+static void multipoleEvaluateBlock (const size_t p, const std::vector<solidHarmonicComplex>& C,
+  const double *Hre, const double *Him, const bool local, double *phi, double *g)
+//input:  expansion C of order p, solid harmonics H of a block (R up to p for a local
+//        expansion, I up to p+1 for a multipole expansion when g is set)
+//output: phi[B] = Sum{ C(l,m) H(l,m) } over -l <= m <= l
+//        g[3*B] (optional) gradient with, for l' = l-1 (local) or l+1 (multipole),
+//        d/dz = +-Sum{ C(l,m) H(l',m) } and (d/dx + i d/dy) = Sum{ C(l,m) H(l',m+1) } over -l <= m <= l
+{
+  const size_t B = multipoleBlock;
+  for (size_t b = 0; b < B; b++)
+    phi[b] = 0.0;
+  for (size_t l = 0; l <= p; l++)
+    for (size_t m = 0; m <= l; m++)
+    {
+      const size_t k = sphereHarmonicArrayIndex (l, m);
+      const double f  = (m == 0) ? 1.0 : 2.0;
+      const double cr = f*C[k].real(), ci = f*C[k].imag();
+      for (size_t b = 0; b < B; b++)
+        phi[b] += cr*Hre[k*B+b] - ci*Him[k*B+b];
+    }
+  if (!g)
+    return;
+
+  double gx[multipoleBlock], gy[multipoleBlock], gz[multipoleBlock];
+  for (size_t b = 0; b < B; b++)
+    gx[b] = gy[b] = gz[b] = 0.0;
+  const double signZ = local ? 1.0 : -1.0;
+  for (size_t l = local ? 1 : 0; l <= p; l++)
+  {
+    const size_t ll = local ? l-1 : l+1;
+    for (size_t m = 0; m <= l; m++)
+    {
+      const size_t k = sphereHarmonicArrayIndex (l, m);
+      const double cr = C[k].real(), ci = C[k].imag();
+
+      //d/dz, the pair +-m gives 2 Re
+      if (m <= ll)
+      {
+        const size_t kk = sphereHarmonicArrayIndex (ll, m);
+        const double f = signZ*((m == 0) ? 1.0 : 2.0);
+        for (size_t b = 0; b < B; b++)
+          gz[b] += f*(cr*Hre[kk*B+b] - ci*Him[kk*B+b]);
+      }
+
+      //+m: C(l,m) H(l',m+1)
+      if (m+1 <= ll)
+      {
+        const size_t kk = sphereHarmonicArrayIndex (ll, m+1);
+        for (size_t b = 0; b < B; b++)
+        {
+          gx[b] += cr*Hre[kk*B+b] - ci*Him[kk*B+b];
+          gy[b] += cr*Him[kk*B+b] + ci*Hre[kk*B+b];
+        }
+      }
+
+      //-m: C(l,-m) H(l',1-m) = -conj(C(l,m) H(l',m-1))
+      if (m >= 1)
+      {
+        const size_t kk = sphereHarmonicArrayIndex (ll, m-1);
+        for (size_t b = 0; b < B; b++)
+        {
+          gx[b] -= cr*Hre[kk*B+b] - ci*Him[kk*B+b];
+          gy[b] += cr*Him[kk*B+b] + ci*Hre[kk*B+b];
+        }
+      }
+    }
+  }
+  for (size_t b = 0; b < B; b++)
+  {
+    g[3*b]   = gx[b];
+    g[3*b+1] = gy[b];
+    g[3*b+2] = gz[b];
+  }
+}
+
+static bool multipoleEvaluate (const char *name, const size_t p, const double center[3],
+  const std::vector<solidHarmonicComplex>& C, const size_t nParticle, const double *position,
+  double *potential, double *gradient, const bool local)
+//input:  expansion C about center, particles
+//output: potential[nParticle] +=, gradient[3*nParticle] += (optional)
+{
+  if (!multipoleCheck (name, p, C.size()))
+    return false;
+  if (!local && !multipoleCheckBlock (name, nParticle, center, position))
+    return false;
+
+  const size_t B = multipoleBlock;
+  const size_t pH = (local || !gradient) ? p : p+1;
+  const size_t size = sphereHarmonicArraySize (pH);
+  const size_t nBlock = (nParticle + B - 1)/B;
+
+  #pragma omp parallel
+  {
+    std::vector<double> Hre(size*B), Him(size*B);
+    double x[multipoleBlock], y[multipoleBlock], z[multipoleBlock], q[multipoleBlock];
+    double phi[multipoleBlock], g[3*multipoleBlock];
+
+    #pragma omp for schedule(static)
+    for (size_t block = 0; block < nBlock; block++)
+    {
+      const size_t i0 = block*B;
+      multipoleGather (i0, nParticle, center, position, nullptr, x, y, z, q);
+      if (local)
+        regularBlock (pH, x, y, z, &Hre[0], &Him[0]);
+      else
+        irregularBlock (pH, x, y, z, &Hre[0], &Him[0]);
+      multipoleEvaluateBlock (p, C, &Hre[0], &Him[0], local, phi, gradient ? g : nullptr);
+
+      for (size_t b = 0; (b < B) && (i0 + b < nParticle); b++)
+      {
+        potential[i0+b] += phi[b];
+        if (gradient)
+          for (size_t k = 0; k < 3; k++)
+            gradient[3*(i0+b)+k] += g[3*b+k];
+      }
+    }
+  }
+  return true;
+}
+
+bool multipoleL2P (const size_t p, const double center[3],
+  const std::vector<solidHarmonicComplex>& L, const size_t nParticle,
+  const double *position, double *potential, double *gradient)
+//input:  p, L[sphereHarmonicArraySize(p)] about center, nParticle, position[3*nParticle]
+//output: potential[nParticle] +=, gradient[3*nParticle] += (optional)
+{
+  return multipoleEvaluate ("multipoleL2P", p, center, L, nParticle, position, potential,
+    gradient, true);
+}
+
+bool multipoleM2P (const size_t p, const double center[3],
+  const std::vector<solidHarmonicComplex>& M, const size_t nParticle,
+  const double *position, double *potential, double *gradient)
+//input:  p, M[sphereHarmonicArraySize(p)] about center, nParticle, position[3*nParticle]
+//output: potential[nParticle] +=, gradient[3*nParticle] += (optional)
+{
+  return multipoleEvaluate ("multipoleM2P", p, center, M, nParticle, position, potential,
+    gradient, false);
+}
+
+}//end namespace quadgrid
@@ -0,0 +1,484 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+#include <cstdlib>
+#include <cmath>
+
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <set>
+#include <vector>
+
+#include <quadgrid/sparse_grid.hpp>
+#include <quadgrid/gauss_legendre_grid.hpp>
+#include <quadgrid/clenshaw_curtis_grid.hpp>
+
+
+namespace quadgrid
+{
+typedef std::vector<size_t> sparseGridIndex;
+
+//1D nodes closer than this on [-1, 1] are the same node
+static const double sparseGridNodeTolerance = 1.0E-13;
+
+//1D family on [-1, 1]: distinct nodes, the level at which each node first appears and
+//the difference weights dw[m][node] = w_m(node) - w_(m-1)(node), m = 1 .. maxLevel
+struct sparseGridFamily
+{
+  size_t maxLevel;
+  std::vector<double> node;
+  std::vector< std::vector<size_t> > newNode;   //[m] nodes first appearing at level m
+  std::vector< std::vector<size_t> > support;   //[m] nodes with dw[m] != 0
+  std::vector< std::vector<double> > dw;        //[m][node]
+};
+
+static bool sparseGridLevelRule (const sparseGridRule rule, const size_t m,
+  std::vector<double>& x, std::vector<double>& w)
+{
+  if (rule == sparseGridGaussLegendre)
+  {
+    const size_t n = 2*m-1;
+    if (!gaussLegendreGrid (n, x, w, -1.0, 1.0))
+      return false;
+    x.resize(n);
+    w.resize(n);
+    return true;
+  }
+  if (rule == sparseGridClenshawCurtis)
+    return clenshawCurtisGrid ((m == 1) ? 1 : (((size_t) 1) << (m-1)) + 1, x, w, -1.0, 1.0);
+  return fejerGrid ((((size_t) 1) << m) - 1, x, w, 2, -1.0, 1.0);
+}
+
+static void sparseGridBuildFamily (const sparseGridRule rule, sparseGridFamily& family)
+{
+  family.maxLevel = (rule == sparseGridGaussLegendre) ? 50 :
+                    (rule == sparseGridClenshawCurtis) ? 11 : 10;
+
+  std::map<double, size_t> lookup;
+  std::vector< std::vector<double> > weight(family.maxLevel+1);
+  family.newNode.resize(family.maxLevel+1);
+
+  for (size_t m = 1; m <= family.maxLevel; m++)
+  {
+    std::vector<double> x, w;
+    sparseGridLevelRule (rule, m, x, w);
+
+    std::vector<size_t> id(x.size());
+    for (size_t i = 0; i < x.size(); i++)
+    {
+      //nearest registered node
+      auto it = lookup.lower_bound(x[i] - sparseGridNodeTolerance);
+      if ((it != lookup.end()) && (it->first <= x[i] + sparseGridNodeTolerance))
+        id[i] = it->second;
+      else
+      {
+        id[i] = family.node.size();
+        lookup[x[i]] = id[i];
+        family.node.push_back(x[i]);
+        family.newNode[m].push_back(id[i]);
+      }
+    }
+
+    weight[m].assign(family.node.size(), 0.0);
+    for (size_t i = 0; i < x.size(); i++)
+      weight[m][id[i]] += w[i];
+  }
+
+  const size_t nNode = family.node.size();
+  family.dw.assign(family.maxLevel+1, std::vector<double>(nNode, 0.0));
+  family.support.resize(family.maxLevel+1);
+  for (size_t m = 1; m <= family.maxLevel; m++)
+  {
+    weight[m].resize(nNode, 0.0);
+    for (size_t k = 0; k < nNode; k++)
+    {
+      family.dw[m][k] = weight[m][k] - ((m > 1) ? weight[m-1][k] : 0.0);
+      if (family.dw[m][k] != 0.0)
+        family.support[m].push_back(k);
+    }
+  }
+}
+
+struct sparseGridTable
+{
+  std::mutex mutex;
+  std::map<int, sparseGridFamily> family;
+
+  const sparseGridFamily* get (const sparseGridRule rule)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = family.find((int) rule);
+    if (it != family.end())
+      return &it->second;
+
+    sparseGridFamily& f = family[(int) rule];
+    sparseGridBuildFamily (rule, f);
+    return &f;
+  }
+};
+
+static sparseGridTable& getSparseGridTable ()
+{
+  static sparseGridTable table;
+  return table;
+}
+
+
+
+static bool sparseGridCheck (const char *name, const size_t d, const sparseGridRule rule,
+  const std::vector<double>& lower, const std::vector<double>& upper)
+{
+  if ((d == 0) || (lower.size() != d) || (upper.size() != d) ||
+      ((rule != sparseGridGaussLegendre) && (rule != sparseGridClenshawCurtis) &&
+       (rule != sparseGridFejer2)))
+  {
+    std::cout << "Error in " << name << ". d = " << d << " lower.size() = " << lower.size();
+    std::cout << " upper.size() = " << upper.size() << " rule = " << (int) rule << "\n";
+    return false;
+  }
+  return true;
+}
+
+static void sparseGridIndexDFS (const size_t d, const double level,
+  const std::vector<double>& anisotropy, sparseGridIndex& l, const size_t i, const double used,
+  std::vector<sparseGridIndex>& indexSet)
+{
+  if (i == d)
+  {
+    indexSet.push_back(l);
+    return;
+  }
+  for (l[i] = 1; used + anisotropy[i]*(l[i]-1) <= level*(1.0 + 1.0E-12); l[i]++)
+    sparseGridIndexDFS (d, level, anisotropy, l, i+1, used + anisotropy[i]*(l[i]-1), indexSet);
+  l[i] = 1;
+}
+
+static double sparseGridWeightDFS (const sparseGridFamily& family,
+  const std::set<sparseGridIndex>& member, const size_t *id, const sparseGridIndex& first,
+  sparseGridIndex& l, const size_t i)
+//Sum{ Prod{ dw[l[j]][id[j]] } } over the members l >= first of the index set
+{
+  const size_t d = first.size();
+  if (i == d)
+    return 1.0;
+
+  double sum = 0.0;
+  for (size_t m = first[i]; m <= family.maxLevel; m++)
+  {
+    //the set is downward closed: once l leaves it, larger l[i] do too
+    l[i] = m;
+    if (member.find(l) == member.end())
+      break;
+    const double dw = family.dw[m][id[i]];
+    if (dw != 0.0)
+      sum += dw*sparseGridWeightDFS (family, member, id, first, l, i+1);
+  }
+  l[i] = first[i];
+  return sum;
+}
+
+
+
+bool sparseGridIndexSet (const size_t d, const double level, const std::vector<double>& anisotropy,
+  std::vector< std::vector<size_t> >& indexSet)
+//input:  d = dimensions, level, anisotropy[d] or empty
+//output: indexSet = { l : Sum{ anisotropy[i] (l[i]-1) } <= level }
+{
+  std::vector<double> a(anisotropy);
+  if (a.empty())
+    a.assign(d, 1.0);
+
+  bool valid = (d > 0) && (a.size() == d) && (level >= 0.0);
+  for (size_t i = 0; valid && (i < d); i++)
+    valid = (a[i] > 0.0);
+  if (!valid)
+  {
+    std::cout << "Error in sparseGridIndexSet. d = " << d << " level = " << level;
+    std::cout << " anisotropy.size() = " << anisotropy.size() << "\n";
+    return false;
+  }
+
+  indexSet.clear();
+  sparseGridIndex l(d, 1);
+  sparseGridIndexDFS (d, level, a, l, 0, 0.0, indexSet);
+
+  return true;
+}
+
+bool sparseGridStream (const size_t d, const std::vector< std::vector<size_t> >& indexSet,
+  const sparseGridRule rule, const std::vector<double>& lower, const std::vector<double>& upper,
+  const size_t blockSize,
+  const std::function<void(const double*, const double*, const size_t)>& block)
+//input:  d, indexSet, rule, box [lower, upper], blockSize
+//output: block(x, w, nPoint) for consecutive blocks of the distinct points
+{
+  if (!sparseGridCheck ("sparseGridStream", d, rule, lower, upper))
+    return false;
+  const sparseGridFamily& family = *getSparseGridTable().get (rule);
+
+  //the index set must be downward closed and within the levels of the family
+  std::set<sparseGridIndex> member(indexSet.begin(), indexSet.end());
+  for (auto it = member.begin(); it != member.end(); ++it)
+  {
+    bool valid = (it->size() == d);
+    for (size_t i = 0; valid && (i < d); i++)
+    {
+      valid = ((*it)[i] >= 1) && ((*it)[i] <= family.maxLevel);
+      if (valid && ((*it)[i] > 1))
+      {
+        sparseGridIndex back(*it);
+        back[i]--;
+        valid = (member.find(back) != member.end());
+      }
+    }
+    if (!valid || (blockSize == 0))
+    {
+      std::cout << "Error in sparseGridStream. the index set is not downward closed,";
+      std::cout << " has levels outside 1 .. " << family.maxLevel << " or blockSize = 0\n";
+      return false;
+    }
+  }
+
+  double scale = 1.0;
+  std::vector<double> half(d), center(d);
+  for (size_t i = 0; i < d; i++)
+  {
+    half[i]   = 0.5*(upper[i] - lower[i]);
+    center[i] = 0.5*(upper[i] + lower[i]);
+    scale    *= half[i];
+  }
+
+  std::vector<size_t> id(blockSize*d);
+  std::vector<sparseGridIndex> first(blockSize);
+  std::vector<double> x(blockSize*d), w(blockSize);
+  size_t nBlock = 0;
+
+  auto flush = [&]()
+  {
+    #pragma omp parallel
+    {
+      sparseGridIndex l(d);
+
+      #pragma omp for schedule(static)
+      for (size_t p = 0; p < nBlock; p++)
+      {
+        l = first[p];
+        w[p] = scale*sparseGridWeightDFS (family, member, &id[p*d], first[p], l, 0);
+        for (size_t i = 0; i < d; i++)
+          x[p*d+i] = center[i] + half[i]*family.node[id[p*d+i]];
+      }
+    }
+    block (&x[0], &w[0], nBlock);
+    nBlock = 0;
+  };
+
+  //points are grouped by the level at which each coordinate first appears
+  std::vector<size_t> counter(d);
+  for (auto it = member.begin(); it != member.end(); ++it)
+  {
+    const sparseGridIndex& f = *it;
+    bool empty = false;
+    for (size_t i = 0; i < d; i++)
+      empty = empty || family.newNode[f[i]].empty();
+    if (empty)
+      continue;
+
+    std::fill(counter.begin(), counter.end(), 0);
+    while (true)
+    {
+      for (size_t i = 0; i < d; i++)
+        id[nBlock*d+i] = family.newNode[f[i]][counter[i]];
+      first[nBlock] = f;
+      if (++nBlock == blockSize)
+        flush ();
+
+      size_t i = 0;
+      for (; i < d; i++)
+      {
+        if (++counter[i] < family.newNode[f[i]].size())
+          break;
+        counter[i] = 0;
+      }
+      if (i == d)
+        break;
+    }
+  }
+  if (nBlock > 0)
+    flush ();
+
+  return true;
+}
+
+bool sparseGrid (const size_t d, const double level, const std::vector<double>& anisotropy,
+  const sparseGridRule rule, const std::vector<double>& lower, const std::vector<double>& upper,
+  std::vector<double>& x, std::vector<double>& w)
+//input:  d, level, anisotropy, rule, box [lower, upper]
+//output: x[nPoint*d] and w[nPoint] = points and merged weights
+{
+  std::vector< std::vector<size_t> > indexSet;
+  if (!sparseGridIndexSet (d, level, anisotropy, indexSet))
+    return false;
+
+  x.clear();
+  w.clear();
+  return sparseGridStream (d, indexSet, rule, lower, upper, 4096,
+    [&](const double *xBlock, const double *wBlock, const size_t nPoint)
+    {
+      x.insert(x.end(), xBlock, xBlock + nPoint*d);
+      w.insert(w.end(), wBlock, wBlock + nPoint);
+    });
+}
+
+bool sparseGridIntegrateAdaptive (const std::function<double(const double*)>& f, const size_t d,
+  const sparseGridRule rule, const std::vector<double>& lower, const std::vector<double>& upper,
+  const double absTol, const size_t maxEvaluation, double& integral, double& error,
+  std::vector< std::vector<size_t> >& indexSet)
+//input:  f, d, rule, box [lower, upper], absTol, maxEvaluation
+//output: integral, error = Sum{ |surplus| } of the active indices, indexSet
+{
+  if (!sparseGridCheck ("sparseGridIntegrateAdaptive", d, rule, lower, upper))
+    return false;
+  const sparseGridFamily& family = *getSparseGridTable().get (rule);
+
+  double scale = 1.0;
+  std::vector<double> half(d), center(d);
+  for (size_t i = 0; i < d; i++)
+  {
+    half[i]   = 0.5*(upper[i] - lower[i]);
+    center[i] = 0.5*(upper[i] + lower[i]);
+    scale    *= half[i];
+  }
+
+  std::map<std::vector<size_t>, double> value;   //f at the node ids
+  size_t nEvaluation = 0;
+
+  //surplus Delta_l f = Sum{ f(x) Prod{ dw[l[i]](x[i]) } } over the tensor support
+  auto surplus = [&](const sparseGridIndex& l) -> double
+  {
+    std::vector< std::vector<size_t> > key;
+    std::vector<double> weight;
+    std::vector<size_t> counter(d, 0), id(d);
+    while (true)
+    {
+      double prod = scale;
+      for (size_t i = 0; i < d; i++)
+      {
+        id[i] = family.support[l[i]][counter[i]];
+        prod *= family.dw[l[i]][id[i]];
+      }
+      key.push_back(id);
+      weight.push_back(prod);
+
+      size_t i = 0;
+      for (; i < d; i++)
+      {
+        if (++counter[i] < family.support[l[i]].size())
+          break;
+        counter[i] = 0;
+      }
+      if (i == d)
+        break;
+    }
+
+    //evaluate the new points in parallel
+    std::vector<size_t> missing;
+    for (size_t p = 0; p < key.size(); p++)
+      if (value.find(key[p]) == value.end())
+        missing.push_back(p);
+
+    std::vector<double> fx(missing.size());
+    #pragma omp parallel
+    {
+      std::vector<double> x(d);
+
+      #pragma omp for schedule(dynamic, 16)
+      for (size_t k = 0; k < missing.size(); k++)
+      {
+        for (size_t i = 0; i < d; i++)
+          x[i] = center[i] + half[i]*family.node[key[missing[k]][i]];
+        fx[k] = f(&x[0]);
+      }
+    }
+    for (size_t k = 0; k < missing.size(); k++)
+      value[key[missing[k]]] = fx[k];
+    nEvaluation += missing.size();
+
+    double sum = 0.0;
+    for (size_t p = 0; p < key.size(); p++)
+      sum += weight[p]*value[key[p]];
+    return sum;
+  };
+
+  std::map<sparseGridIndex, double> old, active;
+  active[sparseGridIndex(d, 1)] = surplus (sparseGridIndex(d, 1));
+
+  bool converged = false;
+  while (true)
+  {
+    error = 0.0;
+    auto best = active.begin();
+    for (auto it = active.begin(); it != active.end(); ++it)
+    {
+      error += fabs(it->second);
+      if (fabs(it->second) > fabs(best->second))
+        best = it;
+    }
+    if (error <= absTol)
+    {
+      converged = true;
+      break;
+    }
+    if (active.empty() || (nEvaluation >= maxEvaluation))
+      break;
+
+    const sparseGridIndex l = best->first;
+    old[l] = best->second;
+    active.erase(best);
+
+    //admissible forward neighbors: every backward neighbor is old
+    for (size_t j = 0; j < d; j++)
+    {
+      sparseGridIndex k(l);
+      if (++k[j] > family.maxLevel)
+        continue;
+
+      bool admissible = true;
+      for (size_t i = 0; admissible && (i < d); i++)
+        if (k[i] > 1)
+        {
+          sparseGridIndex back(k);
+          back[i]--;
+          admissible = (old.find(back) != old.end());
+        }
+      if (admissible)
+        active[k] = surplus (k);
+    }
+  }
+
+  integral = 0.0;
+  indexSet.clear();
+  for (auto it = old.begin(); it != old.end(); ++it)
+  {
+    integral += it->second;
+    indexSet.push_back(it->first);
+  }
+  for (auto it = active.begin(); it != active.end(); ++it)
+  {
+    integral += it->second;
+    indexSet.push_back(it->first);
+  }
+
+  return converged;
+}
+
+}//end namespace quadgrid
@@ -0,0 +1,425 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+#include <cstdlib>
+#include <cmath>
+
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <quadgrid/spectral_element.hpp>
+#include <quadgrid/gauss_legendre_grid.hpp>
+#include <quadgrid/barycentric.hpp>
+#include <quadgrid/legendre.hpp>
+#include <quadgrid/constant.hpp>
+
+
+namespace quadgrid
+{
+//elements per vectorized block
+static const size_t spectralElementBlock = 8;
+
+//largest number of nodes per direction
+static const size_t spectralElementMaxN = 100;
+
+struct spectralElementRule
+{
+  std::vector<double> x;
+  std::vector<double> w;
+  std::vector<double> D;
+  std::vector<double> K;
+};
+
+static void spectralElementBuild (const size_t N, const spectralElementNodes nodes,
+  spectralElementRule& r)
+{
+  if (nodes == spectralElementGaussLegendre)
+  {
+    gaussLegendreGrid (N, r.x, r.w, -1.0, 1.0);
+    r.x.resize(N);
+    r.w.resize(N);
+  }
+  else
+  {
+    //interior nodes: zeros of P'_n, n = N-1, with P''_n = (2x P'_n - n(n+1) P_n)/(1-x^2)
+    const size_t n = N-1;
+    std::vector<double> P, dPdx;
+    r.x.assign(N, 0.0);
+    r.w.assign(N, 0.0);
+    r.x[0] = -1.0;
+    r.x[n] =  1.0;
+    for (size_t k = 1; 2*k <= n; k++)
+    {
+      double t = -cos(Pi*k/n);
+      for (size_t iteration = 0; iteration < 100; iteration++)
+      {
+        legendrePoly (P, dPdx, t, n);
+        const double d2 = (2.0*t*dPdx[n] - n*(n+1.0)*P[n])/(1.0 - t*t);
+        const double dt = dPdx[n]/d2;
+        t -= dt;
+        if (fabs(dt) <= 1.0E-16)
+          break;
+      }
+      r.x[k]   =  t;
+      r.x[n-k] = -t;
+    }
+    if (n % 2 == 0)
+      r.x[n/2] = 0.0;
+
+    for (size_t k = 0; k < N; k++)
+    {
+      legendrePoly (P, r.x[k], n);
+      r.w[k] = 2.0/(n*(n+1.0)*P[n]*P[n]);
+    }
+  }
+
+  std::vector<double> lambda;
+  barycentricWeight (r.x, lambda);
+  differentiationMatrix (r.x, lambda, r.D);
+
+  //K = D^T W D
+  r.K.assign(N*N, 0.0);
+  for (size_t i = 0; i < N; i++)
+    for (size_t j = 0; j < N; j++)
+    {
+      double sum = 0.0;
+      for (size_t k = 0; k < N; k++)
+        sum += r.D[k*N+i]*r.w[k]*r.D[k*N+j];
+      r.K[i*N+j] = sum;
+    }
+}
+
+struct spectralElementTable
+{
+  std::mutex mutex;
+  std::map<std::pair<size_t, int>, spectralElementRule> rule;
+
+  const spectralElementRule* get (const size_t N, const spectralElementNodes nodes)
+  {
+    if ((N == 0) || (N > spectralElementMaxN) ||
+        ((nodes != spectralElementGaussLegendre) && (nodes != spectralElementGaussLobatto)) ||
+        ((nodes == spectralElementGaussLobatto) && (N < 2)))
+      return NULL;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    const std::pair<size_t, int> key(N, (int) nodes);
+    auto it = rule.find(key);
+    if (it != rule.end())
+      return &it->second;
+
+    spectralElementRule r;
+    spectralElementBuild (N, nodes, r);
+    return &(rule[key] = r);
+  }
+};
+
+static spectralElementTable& getSpectralElementTable ()
+{
+  static spectralElementTable table;
+  return table;
+}
+
+
+
+//out = A applied along direction axis of in; in and out are node-major blocks
+//[node][spectralElementBlock]. NC > 0 fixes N at compile time, NC = 0 uses nRuntime.
+template<size_t NC>
+static void spectralElementAxis (const size_t nRuntime, const size_t dimension,
+  const size_t axis, const double *A, const double *in, double *out)
+{
+  const size_t n = (NC > 0) ? NC : nRuntime;
+  const size_t B = spectralElementBlock;
+
+  size_t stride = 1, nLine = 1;
+  for (size_t d = 0; d < dimension; d++)
+  {
+    if (d < axis)
+      stride *= n;
+    if (d > 0)
+      nLine *= n;
+  }
+
+  for (size_t a = 0; a < nLine; a++)
+  {
+    const size_t base = (a % stride) + (a/stride)*stride*n;
+    for (size_t i = 0; i < n; i++)
+    {
+      double sum[B];
+      for (size_t b = 0; b < B; b++)
+        sum[b] = 0.0;
+      for (size_t k = 0; k < n; k++)
+      {
+        const double aik = A[i*n+k];
+        const double *x = in + (base + k*stride)*B;
+        for (size_t b = 0; b < B; b++)
+          sum[b] += aik*x[b];
+      }
+      double *y = out + (base + i*stride)*B;
+      for (size_t b = 0; b < B; b++)
+        y[b] = sum[b];
+    }
+  }
+}
+
+typedef void (*spectralElementAxisKernel)(const size_t, const size_t, const size_t,
+  const double*, const double*, double*);
+
+static spectralElementAxisKernel spectralElementSelect (const size_t N)
+{
+  switch (N)
+  {
+    case  2: return &spectralElementAxis<2>;
+    case  3: return &spectralElementAxis<3>;
+    case  4: return &spectralElementAxis<4>;
+    case  5: return &spectralElementAxis<5>;
+    case  6: return &spectralElementAxis<6>;
+    case  7: return &spectralElementAxis<7>;
+    case  8: return &spectralElementAxis<8>;
+    case  9: return &spectralElementAxis<9>;
+    case 10: return &spectralElementAxis<10>;
+    case 11: return &spectralElementAxis<11>;
+    case 12: return &spectralElementAxis<12>;
+    case 13: return &spectralElementAxis<13>;
+    case 14: return &spectralElementAxis<14>;
+    case 15: return &spectralElementAxis<15>;
+    case 16: return &spectralElementAxis<16>;
+    default: return &spectralElementAxis<0>;
+  }
+}
+
+static size_t spectralElementNodeCount (const size_t dimension, const size_t N)
+{
+  size_t nNode = 1;
+  for (size_t d = 0; d < dimension; d++)
+    nNode *= N;
+  return nNode;
+}
+
+static void spectralElementGather (const size_t nNode, const size_t e0, const size_t nb,
+  const double *u, double *block)
+//block[node][b] = u of element e0+b, zero for b >= nb
+{
+  const size_t B = spectralElementBlock;
+  for (size_t b = 0; b < B; b++)
+  {
+    const double *ue = u + (e0+b)*nNode;
+    for (size_t node = 0; node < nNode; node++)
+      block[node*B+b] = (b < nb) ? ue[node] : 0.0;
+  }
+}
+
+static void spectralElementScatter (const size_t nNode, const size_t e0, const size_t nb,
+  const double *block, double *v)
+{
+  const size_t B = spectralElementBlock;
+  for (size_t b = 0; b < nb; b++)
+  {
+    double *ve = v + (e0+b)*nNode;
+    for (size_t node = 0; node < nNode; node++)
+      ve[node] = block[node*B+b];
+  }
+}
+
+static bool spectralElementCheckBox (const char *name, const size_t dimension, const size_t N,
+  const spectralElementNodes nodes, const spectralElementRule*& rule)
+{
+  rule = getSpectralElementTable().get (N, nodes);
+  if ((dimension < 1) || (dimension > 3) || (rule == NULL))
+  {
+    std::cout << "Error in " << name << ". dimension = " << dimension << " N = " << N;
+    std::cout << " nodes = " << (int) nodes << "\n";
+    return false;
+  }
+  return true;
+}
+
+
+
+bool spectralElementOperator (const size_t N, const spectralElementNodes nodes,
+  std::vector<double>& x, std::vector<double>& w, std::vector<double>& D,
+  std::vector<double>& K)
+//input:  N = nodes per direction, nodes = Gauss-Legendre or Gauss-Lobatto
+//output: x[N], w[N], D[N*N] and K[N*N] of the reference element [-1, 1]
+{
+  const spectralElementRule *rule = getSpectralElementTable().get (N, nodes);
+  if (rule == NULL)
+  {
+    std::cout << "Error in spectralElementOperator. N = " << N << " nodes = " << (int) nodes;
+    std::cout << " (1 .. " << spectralElementMaxN << ", Gauss-Lobatto from 2)\n";
+    return false;
+  }
+
+  x = rule->x;
+  w = rule->w;
+  D = rule->D;
+  K = rule->K;
+  return true;
+}
+
+bool spectralElementTensorApply (const size_t dimension, const size_t N,
+  const std::vector< std::vector<double> >& A, const size_t nElement, const double *u,
+  double *v)
+//input:  dimension, N, A[dimension] = 1D matrices, nElement, u = nodal values
+//output: v = (A[2] x A[1] x A[0]) u for every element
+{
+  bool valid = (dimension >= 1) && (dimension <= 3) && (N > 0) && (A.size() == dimension);
+  for (size_t d = 0; valid && (d < dimension); d++)
+    valid = (A[d].size() == N*N);
+  if (!valid)
+  {
+    std::cout << "Error in spectralElementTensorApply. dimension = " << dimension << " N = " << N;
+    std::cout << " A.size() = " << A.size() << "\n";
+    return false;
+  }
+
+  const size_t nNode = spectralElementNodeCount (dimension, N);
+  const size_t nBlock = (nElement + spectralElementBlock - 1)/spectralElementBlock;
+  const spectralElementAxisKernel axis = spectralElementSelect (N);
+
+  #pragma omp parallel
+  {
+    std::vector<double> buffer0(nNode*spectralElementBlock), buffer1(nNode*spectralElementBlock);
+
+    #pragma omp for schedule(static)
+    for (size_t k = 0; k < nBlock; k++)
+    {
+      const size_t e0 = k*spectralElementBlock;
+      const size_t nb = (nElement - e0 < spectralElementBlock) ? nElement - e0 : spectralElementBlock;
+      spectralElementGather (nNode, e0, nb, u, &buffer0[0]);
+
+      //one contraction per direction, ping-pong between the buffers
+      double *in = &buffer0[0], *out = &buffer1[0];
+      for (size_t d = 0; d < dimension; d++)
+      {
+        axis (N, dimension, d, &A[d][0], in, out);
+        std::swap(in, out);
+      }
+      spectralElementScatter (nNode, e0, nb, in, v);
+    }
+  }
+
+  return true;
+}
+
+bool spectralElementStiffnessApply (const size_t dimension, const size_t N,
+  const spectralElementNodes nodes, const size_t nElement, const double *h, const double *u,
+  double *v)
+//input:  dimension, N, nodes, nElement, h[nElement*dimension] = element sizes, u
+//output: v = K_e u_e for every element
+{
+  const spectralElementRule *rule;
+  if (!spectralElementCheckBox ("spectralElementStiffnessApply", dimension, N, nodes, rule))
+    return false;
+
+  const size_t B = spectralElementBlock;
+  const size_t nNode = spectralElementNodeCount (dimension, N);
+  const size_t nBlock = (nElement + B - 1)/B;
+  const spectralElementAxisKernel axis = spectralElementSelect (N);
+
+  //weight[d][node] = product of the weights of the directions other than d
+  std::vector<double> weight(dimension*nNode, 1.0);
+  for (size_t node = 0; node < nNode; node++)
+  {
+    size_t rest = node;
+    for (size_t d = 0; d < dimension; d++)
+    {
+      const double wd = rule->w[rest % N];
+      rest /= N;
+      for (size_t other = 0; other < dimension; other++)
+        if (other != d)
+          weight[other*nNode+node] *= wd;
+    }
+  }
+
+  #pragma omp parallel
+  {
+    std::vector<double> buffer(nNode*B), term(nNode*B), sum(nNode*B);
+    double scale[3][spectralElementBlock];
+
+    #pragma omp for schedule(static)
+    for (size_t k = 0; k < nBlock; k++)
+    {
+      const size_t e0 = k*B;
+      const size_t nb = (nElement - e0 < B) ? nElement - e0 : B;
+      spectralElementGather (nNode, e0, nb, u, &buffer[0]);
+
+      //scale[d][b] = (2/h_d) Prod{ h_d'/2 }, d' != d
+      for (size_t d = 0; d < dimension; d++)
+        for (size_t b = 0; b < B; b++)
+        {
+          double c = 0.0;
+          if (b < nb)
+          {
+            c = 2.0/h[(e0+b)*dimension+d];
+            for (size_t other = 0; other < dimension; other++)
+              if (other != d)
+                c *= 0.5*h[(e0+b)*dimension+other];
+          }
+          scale[d][b] = c;
+        }
+
+      for (size_t i = 0; i < nNode*B; i++)
+        sum[i] = 0.0;
+      for (size_t d = 0; d < dimension; d++)
+      {
+        axis (N, dimension, d, &rule->K[0], &buffer[0], &term[0]);
+        const double *wd = &weight[d*nNode];
+        for (size_t node = 0; node < nNode; node++)
+          for (size_t b = 0; b < B; b++)
+            sum[node*B+b] += scale[d][b]*wd[node]*term[node*B+b];
+      }
+      spectralElementScatter (nNode, e0, nb, &sum[0], v);
+    }
+  }
+
+  return true;
+}
+
+bool spectralElementMassApply (const size_t dimension, const size_t N,
+  const spectralElementNodes nodes, const size_t nElement, const double *h, const double *u,
+  double *v)
+//input:  dimension, N, nodes, nElement, h[nElement*dimension] = element sizes, u
+//output: v = M_e u_e for every element
+{
+  const spectralElementRule *rule;
+  if (!spectralElementCheckBox ("spectralElementMassApply", dimension, N, nodes, rule))
+    return false;
+
+  const size_t nNode = spectralElementNodeCount (dimension, N);
+  std::vector<double> weight(nNode, 1.0);
+  for (size_t node = 0; node < nNode; node++)
+  {
+    size_t rest = node;
+    for (size_t d = 0; d < dimension; d++)
+    {
+      weight[node] *= rule->w[rest % N];
+      rest /= N;
+    }
+  }
+
+  #pragma omp parallel for schedule(static)
+  for (size_t e = 0; e < nElement; e++)
+  {
+    double c = 1.0;
+    for (size_t d = 0; d < dimension; d++)
+      c *= 0.5*h[e*dimension+d];
+    for (size_t node = 0; node < nNode; node++)
+      v[e*nNode+node] = c*weight[node]*u[e*nNode+node];
+  }
+
+  return true;
+}
+
+}//end namespace quadgrid
@@ -0,0 +1,1069 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+#include <cstdlib>
+#include <cmath>
+
+#include <algorithm>
+#include <complex>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <quadgrid/sphere_transform.hpp>
+#include <quadgrid/spherical_harmonic.hpp>
+#include <quadgrid/unit_sphere_grid_gauss_legendre.hpp>
+#include <quadgrid/fft.hpp>
+
+//memory-mapped files of the Legendre tables
+#if defined(__unix__) || defined(__APPLE__)
+#define QUADGRID_SPHERE_TRANSFORM_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#else
+#define QUADGRID_SPHERE_TRANSFORM_MMAP 0
+#endif
+
+
+namespace quadgrid
+{
+typedef std::complex<double> sphereTransformComplex;
+
+static bool sphereTransformGrid (const char *name, const size_t lmax, const size_t gridLmax,
+  size_t& N, std::vector<double>& theta, std::vector<double>& w)
+//input:  name of the caller, lmax, gridLmax
+//output: N, theta[N], w[N] of unitSphereGaussLegendre(gridLmax)
+{
+  if (gridLmax < lmax)
+  {
+    std::cout << "Error in " << name << ". gridLmax = " << gridLmax << " < lmax = " << lmax << "\n";
+    return false;
+  }
+  std::vector<double> phi;
+  return unitSphereGaussLegendre (gridLmax, N, theta, w, phi);
+}
+
+//first degrees of the ring plans at which the Legendre tables exceed the threshold
+//on the rings h < nHalf = (N+1)/2, ring N-1-h at pi - theta[h] has P(l,m) (-1)^(l+m)
+struct sphereTransformPlan
+{
+  size_t lmax;
+  size_t N;
+  size_t nHalf;
+  double threshold;                //threshold the plan was computed with
+  std::vector<size_t> lstart;      //lstart[h*(lmax+1) + m], lmax + 1 if the column is skipped
+  std::vector<double> z;           //cos(theta[h]), scalar plans only
+  std::vector<double> seed;        //P(lstart,m), P(lstart+1,m) at seed[2*(h*(lmax+1) + m)]
+  std::vector<double> a;           //P(l,m) = a (z P(l-1,m) - b P(l-2,m)) at sphereTransformColumn(lmax, m) + l - m
+  std::vector<double> b;
+};
+
+//offset of the tiles that are recomputed
+static const size_t sphereTransformRecompute = (size_t) -1;
+
+//tile columns of sphereTransformTileLegendre stored for the order blocks within the budget
+struct sphereTransformLegendreTable
+{
+  std::vector<sphereTransformLegendreBlock> block;
+  size_t nTile = 0;
+  std::vector<size_t> offset;      //offset[m*nTile + h/2] of the tile of ring pair h in data
+  std::vector<double> heap;
+  size_t bytes = 0;                //stored bytes, counted against the budget
+  double *data = nullptr;
+  void *mapped = nullptr;
+  size_t mappedBytes = 0;
+
+  const double* tile (const size_t m, const size_t t) const
+  {
+    const size_t k = offset[m*nTile + t];
+    return (k == sphereTransformRecompute) ? nullptr : data + k;
+  }
+
+  ~sphereTransformLegendreTable ()
+  {
+#if QUADGRID_SPHERE_TRANSFORM_MMAP
+    if (mapped != nullptr)
+      munmap(mapped, mappedBytes);
+#endif
+  }
+};
+
+struct sphereTransformPlanCache
+{
+  std::mutex mutex;
+  double threshold = 1.0E-20;
+  size_t budget = 0;
+  size_t used = 0;                 //bytes of the cached tables and reserved by the tables being built
+  size_t generation = 0;           //incremented whenever the cached tables are released
+  std::string directory;
+  std::map< std::tuple<int, size_t, size_t, double>, std::shared_ptr<const sphereTransformPlan> > plan;
+  std::map< std::tuple<size_t, size_t, double>, std::shared_ptr<const sphereTransformLegendreTable> > table;
+};
+
+static sphereTransformPlanCache& getSphereTransformPlanCache ()
+{
+  static sphereTransformPlanCache cache;
+  return cache;
+}
+
+bool sphereTransformSetPolarThreshold (const double threshold)
+{
+  if (!(threshold >= 0.0) || !std::isfinite(threshold))
+  {
+    std::cout << "Error in sphereTransformSetPolarThreshold. threshold = " << threshold << "\n";
+    return false;
+  }
+  sphereTransformPlanCache& cache = getSphereTransformPlanCache ();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  //plans and tables of another threshold are never looked up again, running transforms hold theirs
+  if (threshold != cache.threshold)
+  {
+    cache.plan.clear();
+    cache.table.clear();
+    cache.used = 0;
+    cache.generation++;
+  }
+  cache.threshold = threshold;
+  return true;
+}
+
+double sphereTransformPolarThreshold ()
+{
+  sphereTransformPlanCache& cache = getSphereTransformPlanCache ();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  return cache.threshold;
+}
+
+bool sphereTransformSetLegendreBudget (const size_t bytes, const std::string& directory)
+{
+  if (!directory.empty() && !QUADGRID_SPHERE_TRANSFORM_MMAP)
+  {
+    std::cout << "Error in sphereTransformSetLegendreBudget. no memory-mapped files on this platform\n";
+    return false;
+  }
+  sphereTransformPlanCache& cache = getSphereTransformPlanCache ();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  cache.budget = bytes;
+  cache.directory = directory;
+  //tables in use by running transforms are released with their last reference
+  cache.table.clear();
+  cache.used = 0;
+  cache.generation++;
+  return true;
+}
+
+static inline size_t sphereTransformColumn (const size_t lmax, const size_t m)
+//input:  lmax, m
+//output: offset of (m,m) in the column layout [(0,0) .. (lmax,0), (1,1) .. (lmax,1), ...]
+{
+  return m*(lmax+1) - m*(m-1)/2;
+}
+
+static void sphereTransformLegendre (const size_t lmax, const double theta,
+  std::vector<sphereTransformComplex>& Y, std::vector<double>& P)
+//input:  lmax, theta
+//output: P[sphereHarmonicArrayIndex(l, m)] = Y(l,m)(theta, 0), Y is work space
+{
+  sphereHarmonic (Y, lmax, theta, 0.0);
+  P.resize(Y.size());
+  for (size_t k = 0; k < Y.size(); k++)
+    P[k] = Y[k].real();
+}
+
+static void sphereTransformPlanCompute (const int s, const size_t lmax, const size_t N,
+  const std::vector<double>& theta, const double threshold, sphereTransformPlan& plan)
+//input:  spin s (0 for scalar transforms), lmax, N, theta[N], threshold
+//output: plan with the first degree per ring pair and order at which the tables of
+//        sphereHarmonic (s = 0) or sphereHarmonicSpinLegendre (s > 0) exceed the threshold
+{
+  const size_t L = lmax + 1, nHalf = (N+1)/2;
+  plan.lmax = lmax;
+  plan.N = N;
+  plan.threshold = threshold;
+  plan.nHalf = nHalf;
+  plan.lstart.assign(nHalf*L, L);
+
+  //the shared recurrence coefficients are set up once outside of the threads
+  std::vector<sphereTransformComplex> Y;
+  sphereHarmonic (Y, lmax, 0.0, 0.0);
+
+  if (s == 0)
+  {
+    plan.z.resize(nHalf);
+    plan.seed.assign(2*nHalf*L, 0.0);
+    plan.a.assign(sphereHarmonicArraySize (lmax), 0.0);
+    plan.b.assign(sphereHarmonicArraySize (lmax), 0.0);
+    for (size_t m = 0; m <= lmax; m++)
+      for (size_t l = m+2; l <= lmax; l++)
+      {
+        const size_t k = sphereTransformColumn (lmax, m) + l - m;
+        const double ll = (double) l*l, mm = (double) m*m, l1 = l - 1.0;
+        plan.a[k] = sqrt((4.0*ll - 1.0)/(ll - mm));
+        plan.b[k] = sqrt((l1*l1 - mm)/(4.0*l1*l1 - 1.0));
+      }
+  }
+
+  #pragma omp parallel
+  {
+    std::vector<sphereTransformComplex> Yring;
+    std::vector<double> P, lambdaPlus, lambdaMinus;
+
+    #pragma omp for schedule(dynamic)
+    for (size_t h = 0; h < nHalf; h++)
+    {
+      //|P| and the pair |lambda_s|, |lambda_-s| are the same on both rings
+      size_t *lstart = &plan.lstart[h*L];
+      if (s == 0)
+      {
+        plan.z[h] = cos(theta[h]);
+        sphereTransformLegendre (lmax, theta[h], Yring, P);
+      }
+      else
+        sphereHarmonicSpinLegendre (lambdaPlus, lambdaMinus, s, lmax, theta[h]);
+      for (size_t m = 0; m <= lmax; m++)
+      {
+        size_t l = std::max(m, (size_t) s);
+        for (; l <= lmax; l++)
+        {
+          const size_t k = sphereHarmonicArrayIndex (l, m);
+          if ((s == 0) ? (fabs(P[k]) > threshold) :
+              ((fabs(lambdaPlus[k]) > threshold) || (fabs(lambdaMinus[k]) > threshold)))
+            break;
+        }
+        lstart[m] = l;
+      }
+
+      if (s == 0)
+        for (size_t m = 0; m <= lmax; m++)
+        {
+          double *seed = &plan.seed[2*(h*L + m)];
+          if (lstart[m] <= lmax)
+            seed[0] = P[sphereHarmonicArrayIndex (lstart[m], m)];
+          if (lstart[m]+1 <= lmax)
+            seed[1] = P[sphereHarmonicArrayIndex (lstart[m]+1, m)];
+        }
+    }
+  }
+}
+
+static std::shared_ptr<const sphereTransformPlan> sphereTransformGetPlan (const int s, const size_t lmax,
+  const size_t gridLmax, const size_t N, const std::vector<double>& theta)
+//input:  spin s (0 for scalar transforms), lmax, gridLmax, N, theta[N] of the grid
+//output: plan of the current threshold, shared with the cache
+{
+  sphereTransformPlanCache& cache = getSphereTransformPlanCache ();
+  std::tuple<int, size_t, size_t, double> key;
+  {
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    key = std::make_tuple(s, lmax, gridLmax, cache.threshold);
+    auto it = cache.plan.find(key);
+    if (it != cache.plan.end())
+      return it->second;
+  }
+
+  std::shared_ptr<sphereTransformPlan> plan = std::make_shared<sphereTransformPlan>();
+  sphereTransformPlanCompute (s, lmax, N, theta, std::get<3>(key), *plan);
+
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  //a threshold set in between applies to the next call
+  if (std::get<3>(key) == cache.threshold)
+    cache.plan[key] = plan;
+  return plan;
+}
+
+static void sphereTransformColumnLegendre (const sphereTransformPlan& plan, const size_t h,
+  const size_t m, const size_t lbegin, double *P)
+//input:  scalar plan, ring h < nHalf, order m, first degree lbegin >= m
+//output: P[l - lbegin] = P(l,m)(theta[h]) for lbegin <= l <= lmax, zero below lstart(h, m)
+{
+  const size_t lmax = plan.lmax, L = lmax + 1, l0 = plan.lstart[h*L + m];
+  for (size_t l = lbegin; l < std::min(l0, L); l++)
+    P[l-lbegin] = 0.0;
+  if (l0 > lmax)
+    return;
+
+  const double z = plan.z[h], *seed = &plan.seed[2*(h*L + m)];
+  const double *a = &plan.a[sphereTransformColumn (lmax, m) - m], *b = &plan.b[sphereTransformColumn (lmax, m) - m];
+  P[l0-lbegin] = seed[0];
+  if (l0+1 <= lmax)
+    P[l0+1-lbegin] = seed[1];
+  for (size_t l = l0+2; l <= lmax; l++)
+    P[l-lbegin] = a[l]*(z*P[l-1-lbegin] - b[l]*P[l-2-lbegin]);
+}
+
+static inline size_t sphereTransformTileStart (const sphereTransformPlan& plan, const size_t m,
+  const size_t h)
+//input:  scalar plan, order m, first ring pair h of a tile
+//output: first degree of the tile of the ring pairs h and h + 1 (if < nHalf)
+{
+  const size_t L = plan.lmax + 1;
+  size_t lbegin = plan.lstart[h*L + m];
+  if (h+1 < plan.nHalf)
+    lbegin = std::min(lbegin, plan.lstart[(h+1)*L + m]);
+  return lbegin;
+}
+
+static void sphereTransformTileLegendre (const sphereTransformPlan& plan, const size_t m,
+  const size_t h, const size_t lbegin, double *P)
+//input:  scalar plan, order m, first ring pair h of a tile, its first degree lbegin <= lmax
+//output: P[r*(lmax+1-lbegin) + l - lbegin] = P(l,m) on the ring pair h + r, zero if h + r = nHalf
+{
+  const size_t nDegree = plan.lmax + 1 - lbegin;
+  sphereTransformColumnLegendre (plan, h, m, lbegin, P);
+  if (h+1 < plan.nHalf)
+    sphereTransformColumnLegendre (plan, h+1, m, lbegin, P + nDegree);
+  else
+    std::fill(P + nDegree, P + 2*nDegree, 0.0);
+}
+
+//orders per store or recompute decision of the Legendre tables
+static const size_t sphereTransformOrderBlock = 16;
+
+static bool sphereTransformLegendreTableCompute (const sphereTransformPlan& plan, const size_t budget,
+  const std::string& directory, sphereTransformLegendreTable& table)
+//input:  scalar plan, budget in bytes, directory of the mapped file (empty for the heap)
+//output: table with the order blocks that fit into the budget stored (first fit in m)
+{
+  const size_t lmax = plan.lmax, L = lmax + 1, nTile = (plan.nHalf+1)/2;
+  table.nTile = nTile;
+  table.offset.assign(L*nTile, sphereTransformRecompute);
+  table.block.clear();
+
+  size_t size = 0;
+  for (size_t mBegin = 0; mBegin <= lmax; mBegin += sphereTransformOrderBlock)
+  {
+    sphereTransformLegendreBlock b;
+    b.mBegin = mBegin;
+    b.mEnd   = std::min(mBegin + sphereTransformOrderBlock, L);
+    b.bytes  = 0;
+    for (size_t m = b.mBegin; m < b.mEnd; m++)
+      for (size_t t = 0; t < nTile; t++)
+      {
+        const size_t lbegin = sphereTransformTileStart (plan, m, 2*t);
+        if (lbegin <= lmax)
+          b.bytes += 2*(L - lbegin)*sizeof(double);
+      }
+    b.stored = (size*sizeof(double) + b.bytes <= budget);
+    b.mapped = b.stored && !directory.empty();
+    if (b.stored)
+      for (size_t m = b.mBegin; m < b.mEnd; m++)
+        for (size_t t = 0; t < nTile; t++)
+        {
+          const size_t lbegin = sphereTransformTileStart (plan, m, 2*t);
+          if (lbegin > lmax)
+            continue;
+          table.offset[m*nTile + t] = size;
+          size += 2*(L - lbegin);
+        }
+    table.block.push_back(b);
+  }
+  table.bytes = size*sizeof(double);
+  if (size == 0)
+    return true;
+
+  if (directory.empty())
+  {
+    table.heap.resize(size);
+    table.data = &table.heap[0];
+  }
+  else
+  {
+#if QUADGRID_SPHERE_TRANSFORM_MMAP
+    //the file is unlinked at once, its pages live until munmap
+    const std::string name = directory + "/quadgrid_legendre_XXXXXX";
+    std::vector<char> path(name.begin(), name.end());
+    path.push_back('\0');
+    const int fd = mkstemp(&path[0]);
+    if (fd < 0)
+    {
+      std::cout << "Error in sphereTransformLegendreTableCompute. cannot create " << name
+        << ", the tables are recomputed\n";
+      return false;
+    }
+    unlink(&path[0]);
+    void *mapped = MAP_FAILED;
+    if (ftruncate(fd, (off_t) (size*sizeof(double))) == 0)
+      mapped = mmap(nullptr, size*sizeof(double), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapped == MAP_FAILED)
+    {
+      std::cout << "Error in sphereTransformLegendreTableCompute. cannot map " << size*sizeof(double)
+        << " bytes in " << directory << ", the tables are recomputed\n";
+      return false;
+    }
+    table.mapped = mapped;
+    table.mappedBytes = size*sizeof(double);
+    table.data = (double*) mapped;
+#else
+    return false;
+#endif
+  }
+
+  #pragma omp parallel for schedule(dynamic)
+  for (size_t m = 0; m <= lmax; m++)
+    for (size_t t = 0; t < nTile; t++)
+    {
+      const size_t k = table.offset[m*nTile + t];
+      if (k != sphereTransformRecompute)
+        sphereTransformTileLegendre (plan, m, 2*t, sphereTransformTileStart (plan, m, 2*t), table.data + k);
+    }
+  return true;
+}
+
+static std::shared_ptr<const sphereTransformLegendreTable> sphereTransformGetLegendreTable (
+  const sphereTransformPlan& plan, const size_t gridLmax)
+//input:  scalar plan, gridLmax
+//output: table of the plan's threshold within the part of the budget left by the cached tables,
+//        shared with the cache
+{
+  sphereTransformPlanCache& cache = getSphereTransformPlanCache ();
+  std::tuple<size_t, size_t, double> key;
+  size_t budget, generation;
+  std::string directory;
+  {
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    //the tiles follow the lstart of the plan, which may predate the current threshold
+    key = std::make_tuple(plan.lmax, gridLmax, plan.threshold);
+    auto it = cache.table.find(key);
+    if (it != cache.table.end())
+      return it->second;
+    //the rest of the budget is reserved until the table is built, concurrent builds get none
+    budget = cache.budget - cache.used;
+    cache.used = cache.budget;
+    generation = cache.generation;
+    directory = cache.directory;
+  }
+
+  std::shared_ptr<sphereTransformLegendreTable> table = std::make_shared<sphereTransformLegendreTable>();
+  if (!sphereTransformLegendreTableCompute (plan, budget, directory, *table))
+  {
+    //without the file every block is recomputed
+    table->offset.assign(table->offset.size(), sphereTransformRecompute);
+    for (size_t b = 0; b < table->block.size(); b++)
+      table->block[b].stored = table->block[b].mapped = false;
+    table->bytes = 0;
+  }
+
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  //a budget or threshold set in between applies to the next call, a table of a plan that
+  //predates the current threshold serves its caller only
+  if (generation == cache.generation)
+  {
+    if ((plan.threshold == cache.threshold) && cache.table.emplace(key, table).second)
+      cache.used -= budget - table->bytes;
+    else
+      cache.used -= budget;
+  }
+  return table;
+}
+
+//fields per pass of the batched transforms, the coefficients of one order m and pass stay in cache
+static const size_t sphereTransformFieldBlock = 32;
+
+template<size_t nField>
+static void sphereTransformInverseKernel (const size_t nDegree, const double *const P[2],
+  const double *c, const size_t ldc, double *sumA[2], double *sumB[2])
+//input:  nDegree degrees l = lbegin .. lbegin + nDegree - 1 of one order m, columns P[r][l - lbegin]
+//        of two ring pairs, coefficients c[(l - lbegin)*ldc + 2v + (0, 1)] of nField fields
+//output: sumA[r][2v + (0, 1)] += Sum{ P c } over the degrees l - lbegin even, sumB over the odd ones
+{
+  //register tile of 2 ring pairs x nField complex fields for both parities
+  double accA[2][2*nField] = {}, accB[2][2*nField] = {};
+  size_t i = 0;
+  for (; i+1 < nDegree; i += 2)
+  {
+    const double *x = c + i*ldc, *y = x + ldc;
+    for (size_t r = 0; r < 2; r++)
+    {
+      const double p = P[r][i], q = P[r][i+1];
+      for (size_t k = 0; k < 2*nField; k++)
+      {
+        accA[r][k] += p*x[k];
+        accB[r][k] += q*y[k];
+      }
+    }
+  }
+  if (i < nDegree)
+  {
+    const double *x = c + i*ldc;
+    for (size_t r = 0; r < 2; r++)
+      for (size_t k = 0; k < 2*nField; k++)
+        accA[r][k] += P[r][i]*x[k];
+  }
+  for (size_t r = 0; r < 2; r++)
+    for (size_t k = 0; k < 2*nField; k++)
+    {
+      sumA[r][k] += accA[r][k];
+      sumB[r][k] += accB[r][k];
+    }
+}
+
+template<size_t nField>
+static void sphereTransformForwardKernel (const size_t nDegree, const double *const P[2],
+  const double *const spectrumA[2], const double *const spectrumB[2], double *c, const size_t ldc)
+//input:  nDegree degrees l = lbegin .. lbegin + nDegree - 1 of one order m, columns P[r][l - lbegin]
+//        of two ring pairs, spectra of nField fields for l - lbegin even (A) and odd (B)
+//output: c[(l - lbegin)*ldc + 2v + (0, 1)] += Sum{ P spectrum }
+{
+  double A[2][2*nField], B[2][2*nField];
+  for (size_t r = 0; r < 2; r++)
+    for (size_t k = 0; k < 2*nField; k++)
+    {
+      A[r][k] = spectrumA[r][k];
+      B[r][k] = spectrumB[r][k];
+    }
+  size_t i = 0;
+  for (; i+1 < nDegree; i += 2)
+  {
+    double *x = c + i*ldc, *y = x + ldc;
+    const double p0 = P[0][i], p1 = P[1][i], q0 = P[0][i+1], q1 = P[1][i+1];
+    for (size_t k = 0; k < 2*nField; k++)
+    {
+      x[k] += p0*A[0][k] + p1*A[1][k];
+      y[k] += q0*B[0][k] + q1*B[1][k];
+    }
+  }
+  if (i < nDegree)
+  {
+    double *x = c + i*ldc;
+    for (size_t k = 0; k < 2*nField; k++)
+      x[k] += P[0][i]*A[0][k] + P[1][i]*A[1][k];
+  }
+}
+
+static void sphereTransformLegendreStage (const bool inverse, const sphereTransformPlan& plan,
+  const sphereTransformLegendreTable& table, const size_t nField, std::vector<double>& cT,
+  std::vector<double>& spectrumEven, std::vector<double>& spectrumOdd)
+//input:  inverse, scalar plan, its Legendre table, nField <= sphereTransformFieldBlock,
+//        inverse: coefficients cT[2*((sphereTransformColumn(lmax, m) + l - m)*nField + v) + (0, 1)]
+//        forward: spectra of l + m even and odd at [2*((m*nHalf + h)*nField + v) + (0, 1)]
+//output: inverse: spectrumEven, spectrumOdd = Sum{ P(l,m) c(l,m) } over l + m even and odd
+//        forward: cT = Sum{ P(l,m) spectrum }
+{
+  const size_t lmax = plan.lmax, nHalf = plan.nHalf, L = lmax + 1, ld = 2*nField;
+  const double zero[2*sphereTransformFieldBlock] = {};
+
+  #pragma omp parallel
+  {
+    std::vector<double> column(2*L);
+
+    #pragma omp for schedule(dynamic)
+    for (size_t m = 0; m <= lmax; m++)
+      for (size_t h = 0; h < nHalf; h += 2)
+      {
+        //tile of the ring pairs h and h + 1, the second one is empty at the end of an odd nHalf,
+        //stored or recomputed
+        const size_t nPair = std::min((size_t) 2, nHalf - h);
+        const size_t lbegin = sphereTransformTileStart (plan, m, h);
+        if (lbegin > lmax)
+          continue;
+        const size_t nDegree = L - lbegin;
+        const double *tile = table.tile (m, h/2);
+        if (tile == nullptr)
+        {
+          sphereTransformTileLegendre (plan, m, h, lbegin, &column[0]);
+          tile = &column[0];
+        }
+        const double *P[2] = {tile, tile + nDegree};
+
+        //degrees of even l - lbegin have the parity of lbegin + m
+        const bool evenA = ((lbegin + m) % 2 == 0);
+        double *c = &cT[2*(sphereTransformColumn (lmax, m) + lbegin - m)*nField];
+        double *even[2], *odd[2];
+        for (size_t r = 0; r < 2; r++)
+        {
+          const size_t k = 2*(m*nHalf + std::min(h+r, nHalf-1))*nField;
+          even[r] = (r < nPair) ? &spectrumEven[k] : nullptr;
+          odd[r]  = (r < nPair) ? &spectrumOdd[k] : nullptr;
+        }
+
+        size_t v = 0;
+        if (inverse)
+        {
+          double dummy[2*sphereTransformFieldBlock] = {};
+          for (; v < nField; )
+          {
+            const size_t nTile = (nField - v >= 4) ? 4 : ((nField - v >= 2) ? 2 : 1);
+            double *sumA[2], *sumB[2];
+            for (size_t r = 0; r < 2; r++)
+            {
+              sumA[r] = (r < nPair) ? ((evenA ? even[r] : odd[r]) + 2*v) : dummy;
+              sumB[r] = (r < nPair) ? ((evenA ? odd[r] : even[r]) + 2*v) : dummy;
+            }
+            if (nTile == 4)
+              sphereTransformInverseKernel<4> (nDegree, P, c + 2*v, ld, sumA, sumB);
+            else if (nTile == 2)
+              sphereTransformInverseKernel<2> (nDegree, P, c + 2*v, ld, sumA, sumB);
+            else
+              sphereTransformInverseKernel<1> (nDegree, P, c + 2*v, ld, sumA, sumB);
+            v += nTile;
+          }
+        }
+        else
+        {
+          for (; v < nField; )
+          {
+            const size_t nTile = (nField - v >= 4) ? 4 : ((nField - v >= 2) ? 2 : 1);
+            const double *spectrumA[2], *spectrumB[2];
+            for (size_t r = 0; r < 2; r++)
+            {
+              spectrumA[r] = (r < nPair) ? ((evenA ? even[r] : odd[r]) + 2*v) : zero;
+              spectrumB[r] = (r < nPair) ? ((evenA ? odd[r] : even[r]) + 2*v) : zero;
+            }
+            if (nTile == 4)
+              sphereTransformForwardKernel<4> (nDegree, P, spectrumA, spectrumB, c + 2*v, ld);
+            else if (nTile == 2)
+              sphereTransformForwardKernel<2> (nDegree, P, spectrumA, spectrumB, c + 2*v, ld);
+            else
+              sphereTransformForwardKernel<1> (nDegree, P, spectrumA, spectrumB, c + 2*v, ld);
+            v += nTile;
+          }
+        }
+      }
+  }
+}
+
+bool sphereTransformRingStart (const int s, const size_t lmax, const size_t gridLmax,
+  std::vector<size_t>& lstart)
+//input:  s, lmax, gridLmax
+//output: lstart[N*(lmax+1)]
+{
+  if ((s < 0) || (s > 2))
+  {
+    std::cout << "Error in sphereTransformRingStart. s = " << s << " is not 0, 1 or 2\n";
+    return false;
+  }
+  size_t N;
+  std::vector<double> theta, w;
+  if (!sphereTransformGrid ("sphereTransformRingStart", lmax, gridLmax, N, theta, w))
+    return false;
+  std::shared_ptr<const sphereTransformPlan> plan = sphereTransformGetPlan (s, lmax, gridLmax, N, theta);
+  const size_t L = lmax + 1;
+  lstart.resize(N*L);
+  for (size_t h = 0; h < plan->nHalf; h++)
+    for (size_t m = 0; m <= lmax; m++)
+      lstart[h*L + m] = lstart[(N-1-h)*L + m] = plan->lstart[h*L + m];
+  return true;
+}
+
+bool sphereTransformLegendreTables (const size_t lmax, const size_t gridLmax,
+  std::vector<sphereTransformLegendreBlock>& block)
+//input:  lmax, gridLmax
+//output: block[(lmax+16)/16]
+{
+  size_t N;
+  std::vector<double> theta, w;
+  if (!sphereTransformGrid ("sphereTransformLegendreTables", lmax, gridLmax, N, theta, w))
+    return false;
+  std::shared_ptr<const sphereTransformPlan> plan = sphereTransformGetPlan (0, lmax, gridLmax, N, theta);
+  std::shared_ptr<const sphereTransformLegendreTable> table = sphereTransformGetLegendreTable (*plan, gridLmax);
+  block = table->block;
+  return true;
+}
+
+bool sphereTransformInverse (const size_t lmax, const size_t gridLmax,
+  const std::vector<sphereTransformComplex>& c, const size_t nVector, std::vector<double>& f)
+//input:  lmax, gridLmax, c[nVector*sphereHarmonicArraySize(lmax)]
+//output: f[nVector*2N*N]
+{
+  size_t N;
+  std::vector<double> theta, w;
+  if (!sphereTransformGrid ("sphereTransformInverse", lmax, gridLmax, N, theta, w))
+    return false;
+  const size_t size = sphereHarmonicArraySize (lmax);
+  if (c.size() != nVector*size)
+  {
+    std::cout << "Error in sphereTransformInverse. c.size() = " << c.size() << " != "
+      << nVector*size << "\n";
+    return false;
+  }
+
+  const size_t nPhi = 2*N, nGrid = N*nPhi, L = lmax + 1;
+  f.resize(nVector*nGrid);
+  std::shared_ptr<const sphereTransformPlan> plan = sphereTransformGetPlan (0, lmax, gridLmax, N, theta);
+
+  std::shared_ptr<const sphereTransformLegendreTable> table = sphereTransformGetLegendreTable (*plan, gridLmax);
+  const size_t nHalf = plan->nHalf;
+  std::vector<double> cT, spectrumEven, spectrumOdd;
+
+  for (size_t v0 = 0; v0 < nVector; v0 += sphereTransformFieldBlock)
+  {
+    //coefficients of one pass with the fields fastest in columns of equal m
+    const size_t nField = std::min(sphereTransformFieldBlock, nVector - v0);
+    cT.resize(2*size*nField);
+    for (size_t m = 0; m <= lmax; m++)
+      for (size_t l = m; l <= lmax; l++)
+      {
+        double *x = &cT[2*(sphereTransformColumn (lmax, m) + l - m)*nField];
+        for (size_t v = 0; v < nField; v++)
+        {
+          const sphereTransformComplex& ck = c[(v0+v)*size + sphereHarmonicArrayIndex (l, m)];
+          x[2*v]   = ck.real();
+          x[2*v+1] = ck.imag();
+        }
+      }
+    spectrumEven.assign(2*L*nHalf*nField, 0.0);
+    spectrumOdd.assign(2*L*nHalf*nField, 0.0);
+    sphereTransformLegendreStage (true, *plan, *table, nField, cT, spectrumEven, spectrumOdd);
+
+    #pragma omp parallel
+    {
+      std::vector<sphereTransformComplex> ring(nPhi), ringMirror(nPhi);
+
+      #pragma omp for schedule(dynamic)
+      for (size_t h = 0; h < nHalf; h++)
+      {
+        const size_t hMirror = N-1-h;
+        for (size_t v = 0; v < nField; v++)
+        {
+          //f = Re( Sum{ (2 - delta_m0) G(m) e^(i m phi) } ) with G = even + odd on ring h and
+          //G = even - odd on its mirror
+          for (size_t j = 0; j < nPhi; j++)
+            ring[j] = ringMirror[j] = 0.0;
+          for (size_t m = 0; m <= lmax; m++)
+          {
+            const size_t k = 2*((m*nHalf + h)*nField + v);
+            const double factor = (m == 0) ? 1.0 : 2.0;
+            const sphereTransformComplex even(spectrumEven[k], spectrumEven[k+1]);
+            const sphereTransformComplex odd(spectrumOdd[k], spectrumOdd[k+1]);
+            ring[m]       = factor*(even + odd);
+            ringMirror[m] = factor*(even - odd);
+          }
+          fft (ring, true);
+          double *fv = &f[(v0+v)*nGrid + h*nPhi];
+          for (size_t j = 0; j < nPhi; j++)
+            fv[j] = ring[j].real();
+          if (hMirror == h)
+            continue;
+          fft (ringMirror, true);
+          fv = &f[(v0+v)*nGrid + hMirror*nPhi];
+          for (size_t j = 0; j < nPhi; j++)
+            fv[j] = ringMirror[j].real();
+        }
+      }
+    }
+  }
+  return true;
+}
+
+bool sphereTransformForward (const size_t lmax, const size_t gridLmax, const std::vector<double>& f,
+  const size_t nVector, std::vector<sphereTransformComplex>& c)
+//input:  lmax, gridLmax, f[nVector*2N*N]
+//output: c[nVector*sphereHarmonicArraySize(lmax)]
+{
+  size_t N;
+  std::vector<double> theta, w;
+  if (!sphereTransformGrid ("sphereTransformForward", lmax, gridLmax, N, theta, w))
+    return false;
+  const size_t nPhi = 2*N, nGrid = N*nPhi, L = lmax + 1;
+  if (f.size() != nVector*nGrid)
+  {
+    std::cout << "Error in sphereTransformForward. f.size() = " << f.size() << " != "
+      << nVector*nGrid << "\n";
+    return false;
+  }
+
+  const size_t size = sphereHarmonicArraySize (lmax);
+  c.assign(nVector*size, 0.0);
+  std::shared_ptr<const sphereTransformPlan> plan = sphereTransformGetPlan (0, lmax, gridLmax, N, theta);
+
+  std::shared_ptr<const sphereTransformLegendreTable> table = sphereTransformGetLegendreTable (*plan, gridLmax);
+  const size_t nHalf = plan->nHalf;
+  std::vector<double> cT, spectrumEven, spectrumOdd;
+
+  for (size_t v0 = 0; v0 < nVector; v0 += sphereTransformFieldBlock)
+  {
+    const size_t nField = std::min(sphereTransformFieldBlock, nVector - v0);
+    spectrumEven.resize(2*L*nHalf*nField);
+    spectrumOdd.resize(2*L*nHalf*nField);
+
+    #pragma omp parallel
+    {
+      std::vector<sphereTransformComplex> ring(nPhi), ringMirror(nPhi);
+
+      #pragma omp for schedule(dynamic)
+      for (size_t h = 0; h < nHalf; h++)
+      {
+        const size_t hMirror = N-1-h;
+        for (size_t v = 0; v < nField; v++)
+        {
+          //F(m) = Sum{ f e^(-i m phi) }, c(l,m) = Sum{ w P(l,m) F(m) } over ring h and its mirror:
+          //P (w F + w' F') for l + m even and P (w F - w' F') for l + m odd
+          const double *fv = &f[(v0+v)*nGrid + h*nPhi];
+          for (size_t j = 0; j < nPhi; j++)
+            ring[j] = fv[j];
+          fft (ring, false);
+          if (hMirror != h)
+          {
+            fv = &f[(v0+v)*nGrid + hMirror*nPhi];
+            for (size_t j = 0; j < nPhi; j++)
+              ringMirror[j] = fv[j];
+            fft (ringMirror, false);
+          }
+          else
+            for (size_t m = 0; m <= lmax; m++)
+              ringMirror[m] = 0.0;
+          for (size_t m = 0; m <= lmax; m++)
+          {
+            const size_t k = 2*((m*nHalf + h)*nField + v);
+            const sphereTransformComplex F = w[h]*ring[m], FMirror = w[hMirror]*ringMirror[m];
+            spectrumEven[k] = (F + FMirror).real();
+            spectrumEven[k+1] = (F + FMirror).imag();
+            spectrumOdd[k] = (F - FMirror).real();
+            spectrumOdd[k+1] = (F - FMirror).imag();
+          }
+        }
+      }
+    }
+
+    cT.assign(2*size*nField, 0.0);
+    sphereTransformLegendreStage (false, *plan, *table, nField, cT, spectrumEven, spectrumOdd);
+    for (size_t m = 0; m <= lmax; m++)
+      for (size_t l = m; l <= lmax; l++)
+      {
+        const double *x = &cT[2*(sphereTransformColumn (lmax, m) + l - m)*nField];
+        for (size_t v = 0; v < nField; v++)
+          c[(v0+v)*size + sphereHarmonicArrayIndex (l, m)] = sphereTransformComplex(x[2*v], x[2*v+1]);
+      }
+  }
+  return true;
+}
+
+
+
+static bool sphereTransformSpinGrid (const char *name, const int s, const size_t lmax,
+  const size_t gridLmax, size_t& N, std::vector<double>& theta, std::vector<double>& w)
+//input:  name of the caller, spin s, lmax, gridLmax
+//output: N, theta[N], w[N] of unitSphereGaussLegendre(gridLmax) with 2N > 2 lmax
+{
+  if ((s != 1) && (s != 2))
+  {
+    std::cout << "Error in " << name << ". s = " << s << " is not 1 or 2\n";
+    return false;
+  }
+  if (!sphereTransformGrid (name, lmax, gridLmax, N, theta, w))
+    return false;
+  //complex fields carry the orders -lmax .. lmax on each ring
+  if (2*N <= 2*lmax)
+  {
+    std::cout << "Error in " << name << ". 2N = " << 2*N << " angles phi for lmax = " << lmax << "\n";
+    return false;
+  }
+  return true;
+}
+
+bool sphereTransformSpinInverse (const int s, const size_t lmax, const size_t gridLmax,
+  const std::vector<sphereTransformComplex>& E, const std::vector<sphereTransformComplex>& B,
+  const size_t nVector, std::vector<sphereTransformComplex>& f)
+//input:  s, lmax, gridLmax, E, B[nVector*sphereHarmonicArraySize(lmax)]
+//output: f[nVector*2N*N]
+{
+  size_t N;
+  std::vector<double> theta, w;
+  if (!sphereTransformSpinGrid ("sphereTransformSpinInverse", s, lmax, gridLmax, N, theta, w))
+    return false;
+  const size_t size = sphereHarmonicArraySize (lmax);
+  if ((E.size() != nVector*size) || (B.size() != nVector*size))
+  {
+    std::cout << "Error in sphereTransformSpinInverse. E.size() = " << E.size() << ", B.size() = "
+      << B.size() << " != " << nVector*size << "\n";
+    return false;
+  }
+
+  const size_t nPhi = 2*N, nGrid = N*nPhi;
+  const double signSpin = (s % 2 == 0) ? 1.0 : -1.0;
+  f.resize(nVector*nGrid);
+  std::shared_ptr<const sphereTransformPlan> plan = sphereTransformGetPlan (s, lmax, gridLmax, N, theta);
+
+  #pragma omp parallel
+  {
+    std::vector<sphereTransformComplex> ring(nPhi), ringMirror(nPhi);
+    std::vector<double> lambdaPlus, lambdaMinus;
+
+    #pragma omp for schedule(dynamic)
+    for (size_t h = 0; h < plan->nHalf; h++)
+    {
+      //spin s and -s tables of the ring from one recurrence, on the mirror ring at pi - theta
+      //lambda_s = (-1)^(l+m) lambda_-s(theta) and lambda_-s = (-1)^(l+m) lambda_s(theta)
+      sphereHarmonicSpinLegendre (lambdaPlus, lambdaMinus, s, lmax, theta[h]);
+      const size_t *lstart = &plan->lstart[h*(lmax+1)], hMirror = N-1-h;
+      for (size_t v = 0; v < nVector; v++)
+      {
+        //F(m)  = -Sum{ (E + iB) lambda_s },
+        //F(-m) = -(-1)^s Sum{ (conj(E) + i conj(B)) lambda_-s }, f = Sum{ F(m) e^(i m phi) }
+        const sphereTransformComplex *Ev = &E[v*size], *Bv = &B[v*size];
+        for (size_t j = 0; j < nPhi; j++)
+          ring[j] = ringMirror[j] = 0.0;
+        for (size_t m = 0; m <= lmax; m++)
+        {
+          sphereTransformComplex Fplus = 0.0, Fminus = 0.0, FplusMirror = 0.0, FminusMirror = 0.0;
+          double parity = ((lstart[m] + m) % 2 == 0) ? 1.0 : -1.0;
+          for (size_t l = lstart[m]; l <= lmax; l++)
+          {
+            const size_t k = sphereHarmonicArrayIndex (l, m);
+            const sphereTransformComplex EB = Ev[k] + sphereTransformComplex(0.0, 1.0)*Bv[k];
+            const sphereTransformComplex EBconj = std::conj(Ev[k]) + sphereTransformComplex(0.0, 1.0)*std::conj(Bv[k]);
+            Fplus  += EB*lambdaPlus[k];
+            Fminus += EBconj*lambdaMinus[k];
+            FplusMirror  += parity*EB*lambdaMinus[k];
+            FminusMirror += parity*EBconj*lambdaPlus[k];
+            parity = -parity;
+          }
+          ring[m] -= Fplus;
+          ringMirror[m] -= FplusMirror;
+          if (m > 0)
+          {
+            ring[nPhi-m] -= signSpin*Fminus;
+            ringMirror[nPhi-m] -= signSpin*FminusMirror;
+          }
+        }
+        fft (ring, true);
+        for (size_t j = 0; j < nPhi; j++)
+          f[v*nGrid + h*nPhi + j] = ring[j];
+        if (hMirror == h)
+          continue;
+        fft (ringMirror, true);
+        for (size_t j = 0; j < nPhi; j++)
+          f[v*nGrid + hMirror*nPhi + j] = ringMirror[j];
+      }
+    }
+  }
+  return true;
+}
+
+bool sphereTransformSpinForward (const int s, const size_t lmax, const size_t gridLmax,
+  const std::vector<sphereTransformComplex>& f, const size_t nVector,
+  std::vector<sphereTransformComplex>& E, std::vector<sphereTransformComplex>& B)
+//input:  s, lmax, gridLmax, f[nVector*2N*N]
+//output: E, B[nVector*sphereHarmonicArraySize(lmax)]
+{
+  size_t N;
+  std::vector<double> theta, w;
+  if (!sphereTransformSpinGrid ("sphereTransformSpinForward", s, lmax, gridLmax, N, theta, w))
+    return false;
+  const size_t nPhi = 2*N, nGrid = N*nPhi;
+  if (f.size() != nVector*nGrid)
+  {
+    std::cout << "Error in sphereTransformSpinForward. f.size() = " << f.size() << " != "
+      << nVector*nGrid << "\n";
+    return false;
+  }
+
+  const size_t size = sphereHarmonicArraySize (lmax);
+  const double signSpin = (s % 2 == 0) ? 1.0 : -1.0;
+  E.assign(nVector*size, 0.0);
+  B.assign(nVector*size, 0.0);
+  std::shared_ptr<const sphereTransformPlan> plan = sphereTransformGetPlan (s, lmax, gridLmax, N, theta);
+
+  #pragma omp parallel
+  {
+    std::vector<sphereTransformComplex> ring(nPhi), ringMirror(nPhi), EPartial(E.size(), 0.0),
+      BPartial(B.size(), 0.0);
+    std::vector<double> lambdaPlus, lambdaMinus;
+
+    #pragma omp for schedule(dynamic)
+    for (size_t h = 0; h < plan->nHalf; h++)
+    {
+      sphereHarmonicSpinLegendre (lambdaPlus, lambdaMinus, s, lmax, theta[h]);
+      const size_t *lstart = &plan->lstart[h*(lmax+1)], hMirror = N-1-h;
+      for (size_t v = 0; v < nVector; v++)
+      {
+        //a = Sum{ w f conj(sY) } = -(E + iB), b = Sum{ w conj(f) conj((-s)Y) } = -(-1)^s (E - iB),
+        //the mirror ring enters with lambda_s and lambda_-s exchanged and the sign (-1)^(l+m)
+        for (size_t j = 0; j < nPhi; j++)
+          ring[j] = f[v*nGrid + h*nPhi + j];
+        fft (ring, false);
+        if (hMirror != h)
+        {
+          for (size_t j = 0; j < nPhi; j++)
+            ringMirror[j] = f[v*nGrid + hMirror*nPhi + j];
+          fft (ringMirror, false);
+        }
+        else
+          for (size_t j = 0; j < nPhi; j++)
+            ringMirror[j] = 0.0;
+        sphereTransformComplex *Ev = &EPartial[v*size], *Bv = &BPartial[v*size];
+        for (size_t m = 0; m <= lmax; m++)
+        {
+          const sphereTransformComplex Fplus = w[h]*ring[m];
+          const sphereTransformComplex Fminus = signSpin*w[h]*std::conj(ring[(nPhi-m) % nPhi]);
+          const sphereTransformComplex FplusMirror = w[hMirror]*ringMirror[m];
+          const sphereTransformComplex FminusMirror = signSpin*w[hMirror]*std::conj(ringMirror[(nPhi-m) % nPhi]);
+          double parity = ((lstart[m] + m) % 2 == 0) ? 1.0 : -1.0;
+          for (size_t l = lstart[m]; l <= lmax; l++)
+          {
+            const size_t k = sphereHarmonicArrayIndex (l, m);
+            const sphereTransformComplex a = lambdaPlus[k]*Fplus + parity*lambdaMinus[k]*FplusMirror;
+            const sphereTransformComplex b = lambdaMinus[k]*Fminus + parity*lambdaPlus[k]*FminusMirror;
+            Ev[k] -= 0.5*(a + b);
+            Bv[k] += sphereTransformComplex(0.0, 0.5)*(a - b);
+            parity = -parity;
+          }
+        }
+      }
+    }
+
+    #pragma omp critical
+    for (size_t k = 0; k < E.size(); k++)
+    {
+      E[k] += EPartial[k];
+      B[k] += BPartial[k];
+    }
+  }
+  return true;
+}
+
+bool sphereTransformVectorInverse (const size_t lmax, const size_t gridLmax,
+  const std::vector<sphereTransformComplex>& gradient, const std::vector<sphereTransformComplex>& curl,
+  const size_t nVector, std::vector<double>& vTheta, std::vector<double>& vPhi)
+//input:  lmax, gridLmax, gradient, curl[nVector*sphereHarmonicArraySize(lmax)]
+//output: vTheta, vPhi[nVector*2N*N]
+{
+  //vTheta + i vPhi = Sum{ gradient (Psi_theta + i Psi_phi) + curl (Phi_theta + i Phi_phi) } is the
+  //spin 1 field of E = gradient, B = curl
+  std::vector<sphereTransformComplex> f;
+  if (!sphereTransformSpinInverse (1, lmax, gridLmax, gradient, curl, nVector, f))
+    return false;
+  vTheta.resize(f.size());
+  vPhi.resize(f.size());
+  for (size_t k = 0; k < f.size(); k++)
+  {
+    vTheta[k] = f[k].real();
+    vPhi[k]   = f[k].imag();
+  }
+  return true;
+}
+
+bool sphereTransformVectorForward (const size_t lmax, const size_t gridLmax,
+  const std::vector<double>& vTheta, const std::vector<double>& vPhi, const size_t nVector,
+  std::vector<sphereTransformComplex>& gradient, std::vector<sphereTransformComplex>& curl)
+//input:  lmax, gridLmax, vTheta, vPhi[nVector*2N*N]
+//output: gradient, curl[nVector*sphereHarmonicArraySize(lmax)]
+{
+  if (vTheta.size() != vPhi.size())
+  {
+    std::cout << "Error in sphereTransformVectorForward. vTheta.size() = " << vTheta.size()
+      << " != vPhi.size() = " << vPhi.size() << "\n";
+    return false;
+  }
+  std::vector<sphereTransformComplex> f(vTheta.size());
+  for (size_t k = 0; k < f.size(); k++)
+    f[k] = sphereTransformComplex(vTheta[k], vPhi[k]);
+  return sphereTransformSpinForward (1, lmax, gridLmax, f, nVector, gradient, curl);
+}
+
+}//end namespace quadgrid
@@ -15,6 +15,7 @@
 #include <cmath>
 
 #include <complex>
+#include <iostream>
 #include <vector>
 
 #include <quadgrid/spherical_harmonic.hpp>
@@ -38,7 +39,7 @@ struct sphereHarmonicTable
 
   void initialize (size_t lmaxInput)
   {
-    if ((lmaxInput < lmax) && (lmax != 0))
+    if ((lmaxInput <= lmax) && (lmax != 0))
       return;
 
     lmax = lmaxInput;
@@ -162,6 +163,199 @@ void sphereHarmonic (std::vector<std::complex<double>>& Ylm, const size_t lmax,
 
 
 
+static void sphereHarmonicGradientLevel (const size_t l, const size_t nPoint, const double *rUnit,
+  const std::complex<double> *Ylm, std::complex<double> *gradYlm)
+//input:  degree l >= 1, rUnit[3*nPoint], Ylm of degrees l-1 and l
+//output: gradYlm of degree l
+//        S = r^l Y(l,m), a = sqrt((2l+1)/(2l-1)):
+//        dS/dz              =  a sqrt((l-m)(l+m)) Y(l-1,m)
+//        (d/dx + i d/dy) S  =  a sqrt((l-m)(l-m-1)) Y(l-1,m+1)
+//        (d/dx - i d/dy) S  = -a sqrt((l+m)(l+m-1)) Y(l-1,m-1), Y(l-1,-1) = -conj(Y(l-1,1))
+//        grad Y = grad S - l Y rUnit
+{
+  const double *x = rUnit, *y = rUnit + nPoint, *z = rUnit + 2*nPoint;
+  const double a = sqrt((2.0*l+1.0)/(2.0*l-1.0));
+  for (size_t m = 0; m <= l; m++)
+  {
+    const size_t k = sphereHarmonicArrayIndex (l, m);
+    const double cz     = a*sqrt((double) (l-m)*(l+m));
+    const double cplus  = (m+1 < l) ? a*sqrt((double) (l-m)*(l-m-1)) : 0.0;
+    //Dminus = cminus Y(l-1,m-1) for m > 0 and cminus conj(Y(l-1,1)) for m = 0
+    const double cminus = ((m > 0) ? -1.0 : 1.0)*a*sqrt((double) (l+m)*(l+m-1));
+    const double conjMinus = (m > 0) ? 1.0 : -1.0;
+    //zero Y(l-1,m) and Y(l-1,m+1) are read at index 0 with zero factors
+    const std::complex<double> *Yz     = Ylm + ((m < l) ? sphereHarmonicArrayIndex (l-1, m) : 0)*nPoint;
+    const std::complex<double> *Yplus  = Ylm + ((m+1 < l) ? sphereHarmonicArrayIndex (l-1, m+1) : 0)*nPoint;
+    const std::complex<double> *Yminus = Ylm + sphereHarmonicArrayIndex (l-1, (m > 0) ? m-1 : 1)*nPoint;
+    const std::complex<double> *Y = Ylm + k*nPoint;
+    std::complex<double> *gx = gradYlm + 3*k*nPoint, *gy = gx + nPoint, *gz = gy + nPoint;
+    //real arithmetic, complex products would not vectorize
+    for (size_t p = 0; p < nPoint; p++)
+    {
+      const double plusRe  = cplus*Yplus[p].real(), plusIm = cplus*Yplus[p].imag();
+      const double minusRe = cminus*Yminus[p].real(), minusIm = conjMinus*cminus*Yminus[p].imag();
+      const double lYRe = l*Y[p].real(), lYIm = l*Y[p].imag();
+      //d/dx = (Dplus + Dminus)/2, d/dy = -i (Dplus - Dminus)/2
+      gx[p] = std::complex<double>(0.5*(plusRe + minusRe) - lYRe*x[p], 0.5*(plusIm + minusIm) - lYIm*x[p]);
+      gy[p] = std::complex<double>(0.5*(plusIm - minusIm) - lYRe*y[p], -0.5*(plusRe - minusRe) - lYIm*y[p]);
+      gz[p] = std::complex<double>(cz*Yz[p].real() - lYRe*z[p], cz*Yz[p].imag() - lYIm*z[p]);
+    }
+  }
+}
+
+void sphereHarmonic (std::vector<std::complex<double>>& Ylm,
+  std::vector<std::complex<double>>& gradYlm, const size_t lmax, const size_t nPoint,
+  const double *rUnit)
+//input:  lmax, nPoint, rUnit[3*nPoint] SoA
+//output: Ylm[sphereHarmonicArraySize(lmax)*nPoint], gradYlm[3*sphereHarmonicArraySize(lmax)*nPoint]
+{
+  auto& table = getSphereHarmonicTable();
+  table.initialize(lmax);
+
+  const size_t sizeYlm = sphereHarmonicArraySize (lmax);
+  Ylm.resize(sizeYlm*nPoint);
+  gradYlm.resize(3*sizeYlm*nPoint);
+
+  const double *x = rUnit, *y = rUnit + nPoint, *z = rUnit + 2*nPoint;
+  for (size_t p = 0; p < nPoint; p++)
+  {
+    Ylm[p] = table.Y00;
+    gradYlm[p] = gradYlm[nPoint+p] = gradYlm[2*nPoint+p] = 0.0;
+  }
+  if (lmax == 0)
+    return;
+
+  for (size_t p = 0; p < nPoint; p++)
+  {
+    Ylm[nPoint+p]   = table.Y10*z[p];
+    Ylm[2*nPoint+p] = table.Y11*std::complex<double>(x[p], y[p]);
+  }
+  sphereHarmonicGradientLevel (1, nPoint, rUnit, &Ylm[0], &gradYlm[0]);
+
+  //the recurrence of sphereHarmonic with the directions innermost
+  for (size_t l = 2; l <= lmax; l++)
+  {
+    const size_t l_index = sphereHarmonicArrayIndex (l, 0);
+    const size_t l_index_m1 = sphereHarmonicArrayIndex (l-1, 0);
+    const size_t l_index_m2 = sphereHarmonicArrayIndex (l-2, 0);
+    for (size_t m = 0; m <= l-2; m++)
+    {
+      const double fact1 = table.C3[l-1]/table.B1[l+m]/table.B1[l-m];
+      const double fact2 = table.C4[l-1]*table.B2[l-1+m]*table.B2[l-1-m];
+      std::complex<double> *Y1 = &Ylm[(l_index+m)*nPoint];
+      const std::complex<double> *Y2 = &Ylm[(l_index_m1+m)*nPoint];
+      const std::complex<double> *Y3 = &Ylm[(l_index_m2+m)*nPoint];
+      for (size_t p = 0; p < nPoint; p++)
+        Y1[p] = fact1*z[p]*Y2[p] - fact2*Y3[p];
+    }
+
+    std::complex<double> *Y1 = &Ylm[(l_index+l-1)*nPoint];
+    std::complex<double> *Y0 = &Ylm[(l_index+l)*nPoint];
+    const std::complex<double> *Y2 = &Ylm[(l_index_m1+l-1)*nPoint];
+    const double c1 = table.C1[l-1], c2 = table.C2[l-1];
+    for (size_t p = 0; p < nPoint; p++)
+    {
+      const double re = Y2[p].real(), im = Y2[p].imag();
+      Y1[p] = std::complex<double>(c2*z[p]*re, c2*z[p]*im);
+      Y0[p] = std::complex<double>(c1*(x[p]*re - y[p]*im), c1*(x[p]*im + y[p]*re));
+    }
+
+    sphereHarmonicGradientLevel (l, nPoint, rUnit, &Ylm[0], &gradYlm[0]);
+  }
+}
+
+void sphereHarmonicSpinLegendre (std::vector<double>& lambdaPlus, std::vector<double>& lambdaMinus,
+  const int s, const size_t lmax, const double theta)
+//input:  0 <= s <= 2, lmax, 0 < theta < Pi
+//output: lambdaPlus, lambdaMinus[sphereHarmonicArraySize(lmax)] for spin s and -s
+{
+  std::vector<std::complex<double>> Y;
+  sphereHarmonic (Y, lmax, theta, 0.0);
+  lambdaPlus.resize(Y.size());
+  lambdaMinus.resize(Y.size());
+
+  const double sinTheta = sin(theta);
+  const double cotTheta = cos(theta)/sinTheta;
+  for (size_t l = 0; l <= lmax; l++)
+    for (size_t m = 0; m <= l; m++)
+    {
+      const size_t k = sphereHarmonicArrayIndex (l, m);
+      const double P = Y[k].real();
+      if ((s == 0) || (l < (size_t) s))
+      {
+        lambdaPlus[k] = lambdaMinus[k] = (s == 0) ? P : 0.0;
+        continue;
+      }
+
+      //dP/dtheta = ( sqrt((l-m)(l+m+1)) P(l,m+1) - sqrt((l+m)(l-m+1)) P(l,m-1) )/2, P(l,-1) = -P(l,1)
+      const double Pnext = (m < l) ? Y[k+1].real() : 0.0;
+      const double Pprev = (m > 0) ? Y[k-1].real() : -Pnext;
+      const double dP = 0.5*(sqrt((double) (l-m)*(l+m+1))*Pnext - sqrt((double) (l+m)*(l-m+1))*Pprev);
+      const double X = m/sinTheta;
+      const double L2 = (double) l*(l+1);
+      if (s == 1)
+      {
+        lambdaPlus[k]  = -(dP - X*P)/sqrt(L2);
+        lambdaMinus[k] =  (dP + X*P)/sqrt(L2);
+      }
+      else
+      {
+        //d^2P/dtheta^2 from the Legendre equation
+        const double norm = 1.0/sqrt((l-1.0)*L2*(l+2.0));
+        lambdaPlus[k]  = (-2.0*(cotTheta + X)*dP + (2.0*X*cotTheta + 2.0*X*X - L2)*P)*norm;
+        lambdaMinus[k] = (-2.0*(cotTheta - X)*dP + (-2.0*X*cotTheta + 2.0*X*X - L2)*P)*norm;
+      }
+    }
+}
+
+bool sphereHarmonicSpin (std::vector<std::complex<double>>& sYlm, const int s, const size_t lmax,
+  const double theta, const double phi)
+//input:  -2 <= s <= 2, lmax, 0 < theta < Pi, phi
+//output: sYlm[sphereHarmonicSpinArraySize(lmax)]
+{
+  if ((s < -2) || (s > 2))
+  {
+    std::cout << "Error in sphereHarmonicSpin. s = " << s << " is not supported\n";
+    return false;
+  }
+  std::vector<double> lambdaPlus, lambdaMinus;
+  sphereHarmonicSpinLegendre (lambdaPlus, lambdaMinus, abs(s), lmax, theta);
+  const std::vector<double>& lambda     = (s >= 0) ? lambdaPlus : lambdaMinus;
+  const std::vector<double>& lambdaFlip = (s >= 0) ? lambdaMinus : lambdaPlus;
+
+  sYlm.resize(sphereHarmonicSpinArraySize (lmax));
+  for (size_t l = 0; l <= lmax; l++)
+    for (size_t m = 0; m <= l; m++)
+    {
+      const size_t k = sphereHarmonicArrayIndex (l, m);
+      sYlm[sphereHarmonicSpinArrayIndex (l, (int) m)] = std::polar(1.0, m*phi)*lambda[k];
+      //sY(l,-m) = (-1)^(s+m) conj((-s)Y(l,m))
+      const double sign = ((s + (int) m) % 2 == 0) ? 1.0 : -1.0;
+      sYlm[sphereHarmonicSpinArrayIndex (l, -(int) m)] = std::polar(sign, -(double) m*phi)*lambdaFlip[k];
+    }
+  return true;
+}
+
+void sphereHarmonicVector (std::vector<std::complex<double>>& Psi, const size_t lmax,
+  const double theta, const double phi)
+//input:  lmax, 0 < theta < Pi, phi
+//output: Psi[2*sphereHarmonicArraySize(lmax)]
+{
+  std::vector<double> lambdaPlus, lambdaMinus;
+  sphereHarmonicSpinLegendre (lambdaPlus, lambdaMinus, 1, lmax, theta);
+
+  //Psi_theta = dP/dtheta/sqrt(l(l+1)) e^(i m phi), Psi_phi = i m/sin(theta) P/sqrt(l(l+1)) e^(i m phi)
+  Psi.resize(2*lambdaPlus.size());
+  for (size_t l = 0; l <= lmax; l++)
+    for (size_t m = 0; m <= l; m++)
+    {
+      const size_t k = sphereHarmonicArrayIndex (l, m);
+      const std::complex<double> phase = std::polar(1.0, m*phi);
+      Psi[2*k]   = 0.5*(lambdaMinus[k] - lambdaPlus[k])*phase;
+      Psi[2*k+1] = std::complex<double>(0.0, 0.5*(lambdaMinus[k] + lambdaPlus[k]))*phase;
+    }
+}
+
 }//end namespace quadgrid
 
 
@@ -0,0 +1,267 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+#include <cstdlib>
+#include <cmath>
+
+#include <complex>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <quadgrid/wigner.hpp>
+#include <quadgrid/spherical_harmonic.hpp>
+
+
+namespace quadgrid
+{
+typedef std::complex<double> wignerComplex;
+
+//largest total number of cached rotation matrix entries
+static const size_t wignerCacheLimit = size_t(1) << 25;
+
+static void wignerRisbo (const size_t lmax, const double beta,
+  const std::function<void(const size_t, const std::vector<double>&)>& level)
+//input:  lmax, beta
+//output: level(l, e) for l = 0 .. lmax with e[(l-m)(2l+1) + (l-n)] = d^l_(m n)(beta)
+//        half-integer steps j = J/2 on the indices i = j - m, k = j - n:
+//        d^j(i,k) = ( sqrt((2j-i)(2j-k)) q d(i,k) + sqrt(i (2j-k)) p d(i-1,k)
+//                   - sqrt((2j-i) k) p d(i,k-1) + sqrt(i k) q d(i-1,k-1) )/(2j)
+//        with d = d^(j-1/2), p = sin(beta/2), q = cos(beta/2)
+{
+  const double p = sin(0.5*beta);
+  const double q = cos(0.5*beta);
+  std::vector<double> sq(2*lmax+2);
+  for (size_t k = 0; k < sq.size(); k++)
+    sq[k] = sqrt((double) k);
+
+  std::vector<double> e(1, 1.0), f;
+  level (0, e);
+  for (size_t J = 1; J <= 2*lmax; J++)
+  {
+    //(J+1) x (J+1) from J x J
+    const size_t n = J+1;
+    const double scale = 1.0/J;
+    f.assign(n*n, 0.0);
+    for (size_t i = 0; i < J; i++)
+      for (size_t k = 0; k < J; k++)
+      {
+        const double v = scale*e[i*J+k];
+        f[i*n+k]       += sq[J-i]*sq[J-k]*q*v;
+        f[(i+1)*n+k]   += sq[i+1]*sq[J-k]*p*v;
+        f[i*n+k+1]     -= sq[J-i]*sq[k+1]*p*v;
+        f[(i+1)*n+k+1] += sq[i+1]*sq[k+1]*q*v;
+      }
+    e.swap(f);
+    if (J % 2 == 0)
+      level (J/2, e);
+  }
+}
+
+bool wignerSmallD (const size_t lmax, const double beta, std::vector<double>& d)
+//input:  lmax, beta
+//output: d[wignerArraySize(lmax)]
+{
+  d.resize(wignerArraySize (lmax));
+  wignerRisbo (lmax, beta, [&](const size_t l, const std::vector<double>& e)
+  {
+    const size_t n2 = 2*l+1;
+    //e is indexed by l-m, l-n, d by m+l, n+l
+    double *dl = &d[wignerArrayIndex (l, -(int) l, -(int) l)];
+    for (size_t i = 0; i < n2; i++)
+      for (size_t k = 0; k < n2; k++)
+        dl[(n2-1-i)*n2 + n2-1-k] = e[i*n2+k];
+  });
+  return true;
+}
+
+
+
+//rotation matrices of one beta for real functions, degree l block at l(l+1)(2l+1)/6:
+//S+(n,m) = d_(n m) + (-1)^m d_(n -m), S-(n,m) = d_(n m) - (-1)^m d_(n -m) for m > 0,
+//S+(n,0) = S-(n,0) = d_(n 0), n, m = 0 .. l
+struct wignerRotation
+{
+  std::vector<double> Splus;
+  std::vector<double> Sminus;
+};
+
+static size_t wignerRotationOffset (const size_t l)
+{
+  return l*(l+1)*(2*l+1)/6;
+}
+
+static void wignerRotationLevel (const size_t l, const std::vector<double>& e, double *Splus,
+  double *Sminus)
+//input:  l, e[(l-m)(2l+1) + (l-n)] = d^l_(m n)
+//output: Splus, Sminus[(l+1)*(l+1)]
+{
+  const size_t n2 = 2*l+1;
+  for (size_t n = 0; n <= l; n++)
+  {
+    const double *row = &e[(l-n)*n2];
+    Splus[n*(l+1)]  = row[l];
+    Sminus[n*(l+1)] = row[l];
+    for (size_t m = 1; m <= l; m++)
+    {
+      const double sign = (m % 2 == 0) ? 1.0 : -1.0;
+      Splus[n*(l+1)+m]  = row[l-m] + sign*row[l+m];
+      Sminus[n*(l+1)+m] = row[l-m] - sign*row[l+m];
+    }
+  }
+}
+
+struct wignerTable
+{
+  std::mutex mutex;
+  std::map< std::pair<size_t, double>, std::shared_ptr<const wignerRotation> > rotation;
+  size_t cachedSize = 0;
+
+  std::shared_ptr<const wignerRotation> get (const size_t lmax, const double beta)
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      auto it = rotation.find(std::make_pair(lmax, beta));
+      if (it != rotation.end())
+        return it->second;
+    }
+
+    const size_t size = wignerRotationOffset (lmax+1);
+    std::shared_ptr<wignerRotation> r = std::make_shared<wignerRotation>();
+    r->Splus.resize(size);
+    r->Sminus.resize(size);
+    wignerRisbo (lmax, beta, [&](const size_t l, const std::vector<double>& e)
+    {
+      const size_t offset = wignerRotationOffset (l);
+      wignerRotationLevel (l, e, &r->Splus[offset], &r->Sminus[offset]);
+    });
+
+    std::lock_guard<std::mutex> lock(mutex);
+    //start over when the cache is full, entries in use stay alive through their shared_ptr
+    if (cachedSize + 2*size > wignerCacheLimit)
+    {
+      rotation.clear();
+      cachedSize = 0;
+    }
+    rotation[std::make_pair(lmax, beta)] = r;
+    cachedSize += 2*size;
+    return r;
+  }
+};
+
+static wignerTable& getWignerTable ()
+{
+  static wignerTable table;
+  return table;
+}
+
+static void sphereHarmonicRotateLevel (const size_t l, const double *Splus, const double *Sminus,
+  const std::vector<wignerComplex>& phaseAlpha, const std::vector<wignerComplex>& phaseGamma,
+  const size_t nVector, wignerComplex *c, std::vector<double>& work)
+//input:  degree l, S+ and S- of the degree, phases e^(-i m alpha), e^(-i m gamma), vectors c
+//output: degree l of every vector rotated
+//        Re(y) = S+ Re(x), Im(y) = S- Im(x), x = e^(-i m gamma) c, c' = e^(-i n alpha) y
+{
+  const size_t size = sphereHarmonicArraySize (phaseAlpha.size()-1);
+  const size_t n1 = l+1;
+  work.resize(4*n1*nVector);
+  double *xr = &work[0], *xi = xr + n1*nVector, *yr = xi + n1*nVector, *yi = yr + n1*nVector;
+
+  for (size_t m = 0; m <= l; m++)
+    for (size_t v = 0; v < nVector; v++)
+    {
+      const wignerComplex x = phaseGamma[m]*c[v*size + sphereHarmonicArrayIndex (l, m)];
+      xr[m*nVector+v] = x.real();
+      xi[m*nVector+v] = x.imag();
+    }
+
+  for (size_t n = 0; n <= l; n++)
+  {
+    double *yrn = yr + n*nVector, *yin = yi + n*nVector;
+    for (size_t v = 0; v < nVector; v++)
+      yrn[v] = yin[v] = 0.0;
+    for (size_t m = 0; m <= l; m++)
+    {
+      const double sp = Splus[n*n1+m], sm = Sminus[n*n1+m];
+      const double *xrm = xr + m*nVector, *xim = xi + m*nVector;
+      for (size_t v = 0; v < nVector; v++)
+      {
+        yrn[v] += sp*xrm[v];
+        yin[v] += sm*xim[v];
+      }
+    }
+  }
+
+  for (size_t n = 0; n <= l; n++)
+    for (size_t v = 0; v < nVector; v++)
+      c[v*size + sphereHarmonicArrayIndex (l, n)] =
+        phaseAlpha[n]*wignerComplex(yr[n*nVector+v], yi[n*nVector+v]);
+}
+
+bool sphereHarmonicRotate (const size_t lmax, const double alpha, const double beta,
+  const double gamma, const size_t nVector, std::vector<wignerComplex>& c)
+//input:  lmax, Euler angles, c[nVector*sphereHarmonicArraySize(lmax)]
+//output: c rotated
+{
+  const size_t size = sphereHarmonicArraySize (lmax);
+  if (c.size() != nVector*size)
+  {
+    std::cout << "Error in sphereHarmonicRotate. c.size() = " << c.size() << " != "
+      << nVector*size << "\n";
+    return false;
+  }
+
+  std::vector<wignerComplex> phaseAlpha(lmax+1), phaseGamma(lmax+1);
+  for (size_t m = 0; m <= lmax; m++)
+  {
+    phaseAlpha[m] = std::polar(1.0, -(double) m*alpha);
+    phaseGamma[m] = std::polar(1.0, -(double) m*gamma);
+  }
+
+  if (2*wignerRotationOffset (lmax+1) > wignerCacheLimit)
+  {
+    //too large to keep: rotate each degree as the recursion reaches it
+    std::vector<double> Splus, Sminus, work;
+    wignerRisbo (lmax, beta, [&](const size_t l, const std::vector<double>& e)
+    {
+      Splus.resize((l+1)*(l+1));
+      Sminus.resize((l+1)*(l+1));
+      wignerRotationLevel (l, e, &Splus[0], &Sminus[0]);
+      sphereHarmonicRotateLevel (l, &Splus[0], &Sminus[0], phaseAlpha, phaseGamma, nVector,
+        &c[0], work);
+    });
+    return true;
+  }
+
+  std::shared_ptr<const wignerRotation> r = getWignerTable ().get(lmax, beta);
+  #pragma omp parallel
+  {
+    std::vector<double> work;
+
+    #pragma omp for schedule(dynamic)
+    for (size_t i = 0; i <= lmax; i++)
+    {
+      //largest degrees first
+      const size_t l = lmax - i;
+      const size_t offset = wignerRotationOffset (l);
+      sphereHarmonicRotateLevel (l, &r->Splus[offset], &r->Sminus[offset], phaseAlpha,
+        phaseGamma, nVector, &c[0], work);
+    }
+  }
+  return true;
+}
+
+}//end namespace quadgrid
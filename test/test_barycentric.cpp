@@ -0,0 +1,134 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+
+
+
+//on the Gauss-Legendre nodes of [-2, 3] the following test interpolates
+//f1 = sin(3x) + exp(x/2) and f2 = 1/(9 + x^2) at 1000 points and differentiates
+//them with the spectral differentiation matrix. the cached Gauss-Legendre weights
+//are also compared with the general O(N^2) barycentric weights
+
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+
+#include <iostream>
+#include <vector>
+
+#include <quadgrid/barycentric.hpp>
+#include <quadgrid/gauss_legendre_grid.hpp>
+using namespace quadgrid;
+
+
+static void checkError (const char *name, const size_t N, const double maxError,
+  const double tolerance)
+{
+  char sTmp[500];
+  sprintf(sTmp, "%-14s N = %4lu maxError = %.2le\n", name, N, maxError);
+  std::cout << sTmp;
+
+  if (maxError > tolerance)
+  {
+    sprintf(sTmp, "Error. error = %.2le > %.2le\n", maxError, tolerance);
+    std::cout << sTmp;
+    exit(0);
+  }
+}
+
+static double f1 (const double x)  { return sin(3.0*x) + exp(0.5*x); }
+static double f2 (const double x)  { return 1.0/(9.0 + x*x); }
+static double df1 (const double x) { return 3.0*cos(3.0*x) + 0.5*exp(0.5*x); }
+static double df2 (const double x) { return -2.0*x/((9.0 + x*x)*(9.0 + x*x)); }
+
+
+int main()
+{
+  const double a = -2.0;
+  const double b =  3.0;
+  const size_t M = 1000;
+
+  std::vector<double> t(M);
+  for (size_t i = 0; i < M; i++)
+    t[i] = a + (b - a)*(i + 0.5)/M;
+
+  const size_t arrayOrder[8] = {40, 50, 60, 70, 80, 90, 100, 200};
+
+  for (size_t n = 0; n < 8; n++)
+  {
+    const size_t N = arrayOrder[n];
+
+    std::vector<double> x, w, lambda, lambdaGeneral;
+    if (!gaussLegendreGrid (N, x, w, a, b))
+      exit(0);
+    x.resize(N);
+    if (!gaussLegendreBarycentricWeight (N, lambda))
+      exit(0);
+
+    //1) cached weights against the general formula (both normalized)
+    if (N <= 100)
+    {
+      barycentricWeight (x, lambdaGeneral);
+      double maxError = 0.0;
+      const double ratio = lambdaGeneral[0]/lambda[0];
+      for (size_t j = 0; j < N; j++)
+      {
+        const double error = fabs(lambda[j]*ratio - lambdaGeneral[j]);
+        if (maxError < error) maxError = error;
+      }
+      checkError ("weights", N, maxError, 1.0E-10);
+    }
+
+    //2) batched interpolation of two fields
+    std::vector<double> f(2*N), ft;
+    for (size_t j = 0; j < N; j++)
+    {
+      f[j]   = f1(x[j]);
+      f[N+j] = f2(x[j]);
+    }
+    if (!barycentricInterpolate (x, lambda, f, 2, t, ft))
+      exit(0);
+
+    double maxError = 0.0;
+    for (size_t i = 0; i < M; i++)
+    {
+      const double error = fabs(ft[i] - f1(t[i])) + fabs(ft[M+i] - f2(t[i]));
+      if (maxError < error) maxError = error;
+    }
+    checkError ("interpolation", N, maxError, 1.0E-12);
+
+    //3) differentiation matrix
+    std::vector<double> D;
+    if (!gaussLegendreDifferentiationMatrix (N, a, b, D))
+      exit(0);
+
+    maxError = 0.0;
+    for (size_t i = 0; i < N; i++)
+    {
+      double sum1 = 0.0;
+      double sum2 = 0.0;
+      for (size_t j = 0; j < N; j++)
+      {
+        sum1 += D[i*N+j]*f[j];
+        sum2 += D[i*N+j]*f[N+j];
+      }
+      const double error = fabs(sum1 - df1(x[i])) + fabs(sum2 - df2(x[i]));
+      if (maxError < error) maxError = error;
+    }
+    checkError ("derivative", N, maxError, 1.0E-9);
+  }
+
+
+  return 1;
+}
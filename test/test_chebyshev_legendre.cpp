@@ -0,0 +1,119 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+
+
+
+//for each order N the following test converts random Chebyshev coefficients with
+//chebyshevToLegendre, compares both series at random points (Legendre side by
+//legendrePoly) and converts back with legendreToChebyshev; the largest order only
+//checks the round trip
+
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+#include <quadgrid/chebyshev_legendre.hpp>
+#include <quadgrid/legendre.hpp>
+using namespace quadgrid;
+
+
+int main()
+{
+  const size_t nPoint = 20;
+
+  //direct conversions below 128, Toeplitz-Hankel conversions above
+  std::vector<size_t> arrayOrder;
+  for (size_t N = 1; N <= 40; N++)
+    arrayOrder.push_back(N);
+  arrayOrder.push_back(127);
+  arrayOrder.push_back(128);
+  arrayOrder.push_back(500);
+  arrayOrder.push_back(1000);
+  arrayOrder.push_back(4096);
+  arrayOrder.push_back(100000);
+
+  srand(12345);
+
+  std::vector<double> P;
+  for (size_t i = 0; i < arrayOrder.size(); i++)
+  {
+    const size_t N = arrayOrder[i];
+
+    std::vector<double> a(N), c, aBack;
+    double norm = 0.0;
+    for (size_t k = 0; k < N; k++)
+    {
+      a[k] = 2.0*rand()/RAND_MAX - 1.0;
+      norm += fabs(a[k]);
+    }
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    if (!chebyshevToLegendre (a, c))
+      exit(0);
+    if (!legendreToChebyshev (c, aBack))
+      exit(0);
+    const double time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    //1) both series at random points, relative to the bound Sum{ |a[k]| }, skipped for the
+    //largest order where the O(N) evaluation per point would dominate the test
+    const bool checkSeries = (N <= 10000);
+    double maxErrorSeries = 0.0;
+    for (size_t j = 0; (j < nPoint) && checkSeries; j++)
+    {
+      const double x = 2.0*rand()/RAND_MAX - 1.0;
+      const double theta = acos(x);
+      legendrePoly (P, x, N);
+
+      double sumT = 0.0, sumP = 0.0;
+      for (size_t k = 0; k < N; k++)
+      {
+        sumT += a[k]*cos(k*theta);
+        sumP += c[k]*P[k];
+      }
+      const double error = fabs(sumT - sumP)/norm;
+      if (maxErrorSeries < error) maxErrorSeries = error;
+    }
+
+    //2) round trip
+    double maxErrorBack = 0.0;
+    for (size_t k = 0; k < N; k++)
+    {
+      const double error = fabs(aBack[k] - a[k]);
+      if (maxErrorBack < error) maxErrorBack = error;
+    }
+
+    char sTmp[500];
+    if (checkSeries)
+      sprintf(sTmp, "N = %6lu maxError = %.2le (series, relative) %.2le (round trip) time = %.3lf s\n",
+        N, maxErrorSeries, maxErrorBack, time);
+    else
+      sprintf(sTmp, "N = %6lu maxError = skipped  (series, relative) %.2le (round trip) time = %.3lf s\n",
+        N, maxErrorBack, time);
+    std::cout << sTmp;
+
+    if ((maxErrorSeries > 1.0E-13) || (maxErrorBack > 1.0E-10))
+    {
+      std::cout << "Error. error > 1.0E-13 (series) or 1.0E-10 (round trip)\n";
+      exit(0);
+    }
+  }
+
+
+  return 1;
+}
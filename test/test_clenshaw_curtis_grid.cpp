@@ -0,0 +1,166 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+
+
+
+//1) Clenshaw-Curtis and Fejer type-1/type-2 rules integrate (x+1)^k, k <= N-1,
+//   over [-2, 3] for N = 1 .. 200 and a few large (non power of two) N
+//2) the FFT weights are compared with the O(N^2) cosine/sine sums
+//3) the progressive integrator reuses every sample: exp(x) cos(5x) over [0, 2]
+
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+
+#include <iostream>
+#include <vector>
+
+#include <quadgrid/clenshaw_curtis_grid.hpp>
+#include <quadgrid/constant.hpp>
+using namespace quadgrid;
+
+
+static void checkError (const char *name, const size_t N, const double maxError)
+{
+  char sTmp[500];
+  sprintf(sTmp, "%-16s N = %5lu maxError = %.2le\n", name, N, maxError);
+  std::cout << sTmp;
+
+  if (maxError > 1.0E-12)
+  {
+    sprintf(sTmp, "Error. error = %.2le > 1.0E-12\n", maxError);
+    std::cout << sTmp;
+    exit(0);
+  }
+}
+
+static double directWeight (const int rule, const size_t N, const size_t j)
+//rule 0 = Clenshaw-Curtis, 1 = Fejer type 1, 2 = Fejer type 2 on [-1, 1]
+{
+  double sum = 0.0;
+  if (rule == 0)
+  {
+    if (N == 1)
+      return 2.0;
+    const size_t n = N-1;
+    for (size_t k = 0; 2*k <= n; k++)
+      sum += ((k == 0) || (2*k == n) ? 1.0 : 2.0)*cos(2.0*k*j*Pi/n)/(1.0 - 4.0*k*k);
+    return (((j == 0) || (j == n)) ? 1.0 : 2.0)/n*sum;
+  }
+  else if (rule == 1)
+  {
+    const double theta = Pi*(2.0*j + 1.0)/(2.0*N);
+    for (size_t k = 1; 2*k <= N; k++)
+      sum += cos(2.0*k*theta)/(4.0*k*k - 1.0);
+    return 2.0/N*(1.0 - 2.0*sum);
+  }
+  else
+  {
+    const size_t n     = N+1;
+    const double theta = Pi*(j + 1.0)/n;
+    for (size_t k = 1; 2*k <= n; k++)
+      sum += sin((2.0*k - 1.0)*theta)/(2.0*k - 1.0);
+    return 4.0*sin(theta)/n*sum;
+  }
+}
+
+
+int main()
+{
+  const size_t kMax = 20;
+  const double a    = -2.0;
+  const double b    =  3.0;
+
+  std::vector<size_t> arrayOrder;
+  for (size_t N = 1; N <= 200; N++)
+    arrayOrder.push_back(N);
+  arrayOrder.push_back(1000);
+  arrayOrder.push_back(1025);
+  arrayOrder.push_back(4097);
+  arrayOrder.push_back(6561);
+
+  const char *name[3] = {"Clenshaw-Curtis", "Fejer type 1", "Fejer type 2"};
+
+  std::vector<double> x, w;
+  for (size_t i = 0; i < arrayOrder.size(); i++)
+  {
+    const size_t N    = arrayOrder[i];
+    const size_t kTop = (N-1 < kMax) ? N-1 : kMax;
+
+    for (int rule = 0; rule < 3; rule++)
+    {
+      bool ok = (rule == 0) ? clenshawCurtisGrid (N, x, w, a, b) : fejerGrid (N, x, w, rule, a, b);
+      if (!ok)
+        exit(0);
+
+      //1) moments
+      double maxError = 0.0;
+      for (size_t k = 0; k <= kTop; k++)
+      {
+        double sum = 0.0;
+        for (size_t j = 0; j < N; j++)
+          sum += w[j]*pow(x[j] + 1.0, (double) k);
+        const double anal  = (pow(b + 1.0, k + 1.0) - pow(a + 1.0, k + 1.0))/(k + 1.0);
+        const double error = fabs(sum - anal)/anal;
+        if (maxError < error) maxError = error;
+      }
+
+      //2) FFT against direct weights (scaled to [-1, 1])
+      if (N <= 200)
+      {
+        for (size_t j = 0; j < N; j++)
+        {
+          const double error = fabs(w[j]*2.0/(b - a) - directWeight (rule, N, j));
+          if (maxError < error) maxError = error;
+        }
+      }
+
+      checkError (name[rule], N, maxError);
+    }
+  }
+
+
+  //3) progressive integration
+  {
+    size_t nEval = 0;
+    auto f = [&nEval](double t) { nEval++; return exp(t)*cos(5.0*t); };
+
+    double integral, error;
+    std::vector<double> xSample, fSample;
+    if (!clenshawCurtisIntegrate (f, 0.0, 2.0, 1.0E-14, 0.0, 1025, integral, error,
+      xSample, fSample))
+    {
+      std::cout << "Error. clenshawCurtisIntegrate did not converge\n";
+      exit(0);
+    }
+
+    const double anal = (exp(2.0)*(cos(10.0) + 5.0*sin(10.0)) - 1.0)/26.0;
+
+    char sTmp[500];
+    sprintf(sTmp, "progressive      N = %5lu nEval = %lu integral = %.15f (anal) %.15f (nume)\n",
+      xSample.size(), nEval, anal, integral);
+    std::cout << sTmp;
+
+    if (nEval != xSample.size())
+    {
+      std::cout << "Error. samples were not reused\n";
+      exit(0);
+    }
+    checkError ("progressive", xSample.size(), fabs(integral - anal)/fabs(anal));
+  }
+
+
+  return 1;
+}
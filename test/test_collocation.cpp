@@ -0,0 +1,191 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+
+
+
+//1) simplifying conditions of the tableaus: B(p) Sum{ b_j c_j^(k-1) } = 1/k up to the order
+//   and C(q) Sum{ a_ij c_j^(k-1) } = c_i^k/k (q = s, Lobatto IIIC q = s-1) for s <= 20
+//2) eigen-decomposition A = T diag(lambda) Tinv (1e-13 for s <= 8, 1e-6 for s <= 20)
+//   and the stability function R(-1), the (s-f, s) Pade approximant of exp(-1)
+//3) the reference integrator reaches the classical order on y' = cos(t) y, integrates it to
+//   the rounding level with 4 steps for s = 8 .. 20, and integrates the stiff problem
+//   y' = -1e6 (y - cos t) - sin t with steps far above 1e-6
+
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+
+#include <algorithm>
+#include <complex>
+#include <iostream>
+#include <vector>
+
+#include <quadgrid/collocation.hpp>
+using namespace quadgrid;
+
+
+static void checkError (const char *name, const double error, const double tolerance)
+{
+  char sTmp[500];
+  sprintf(sTmp, "%-44s error = %.2le\n", name, error);
+  std::cout << sTmp;
+
+  if (!(error <= tolerance))
+  {
+    sprintf(sTmp, "Error. error = %.2le > %.2le\n", error, tolerance);
+    std::cout << sTmp;
+    exit(0);
+  }
+}
+
+
+int main()
+{
+  collocationFamily arrayFamily[] = {collocationGauss, collocationRadauIIA, collocationLobattoIIIC};
+  const char *arrayName[] = {"Gauss", "Radau IIA", "Lobatto IIIC"};
+  char name[200];
+
+  //1) and 2) tableaus
+  for (size_t f = 0; f < 3; f++)
+  {
+    double maxB = 0.0, maxC = 0.0, maxEigen[2] = {0.0, 0.0}, maxStability = 0.0;
+    for (size_t s = (f == 2) ? 2 : 1; s <= 20; s++)
+    {
+      butcherTableau tableau;
+      if (!butcherTableauCollocation (arrayFamily[f], s, tableau))
+      {
+        std::cout << "Error. butcherTableauCollocation failed\n";
+        exit(0);
+      }
+      const std::vector<double>& A = tableau.A;
+      const std::vector<double>& b = tableau.b;
+      const std::vector<double>& c = tableau.c;
+
+      for (size_t k = 1; k <= tableau.order; k++)
+      {
+        double sum = 0.0;
+        for (size_t j = 0; j < s; j++)
+          sum += b[j]*pow(c[j], k-1.0);
+        maxB = std::max(maxB, fabs(sum - 1.0/k)*k);
+      }
+      const size_t q = (f == 2) ? s-1 : s;
+      for (size_t i = 0; i < s; i++)
+        for (size_t k = 1; k <= q; k++)
+        {
+          double sum = 0.0;
+          for (size_t j = 0; j < s; j++)
+            sum += A[i*s+j]*pow(c[j], k-1.0);
+          maxC = std::max(maxC, fabs(sum - pow(c[i], (double) k)/k));
+        }
+
+      double scale = 0.0;
+      for (size_t i = 0; i < s*s; i++)
+        scale = std::max(scale, fabs(A[i]));
+      for (size_t i = 0; i < s; i++)
+        for (size_t j = 0; j < s; j++)
+        {
+          std::complex<double> sum = 0.0;
+          for (size_t k = 0; k < s; k++)
+            sum += tableau.T[i*s+k]*tableau.eigenvalue[k]*tableau.Tinv[k*s+j];
+          maxEigen[s > 8] = std::max(maxEigen[s > 8], std::abs(sum - A[i*s+j])/scale);
+        }
+
+      //R(-1) = 1 - b^T (I + A)^-1 1 against the (k, s) Pade approximant P(-1)/Q(-1) of exp
+      //with k = s, s-1, s-2
+      std::complex<double> R = 1.0;
+      for (size_t k = 0; k < s; k++)
+      {
+        std::complex<double> sum = 0.0;
+        for (size_t i = 0; i < s; i++)
+          for (size_t j = 0; j < s; j++)
+            sum += b[i]*tableau.T[i*s+k]*tableau.Tinv[k*s+j];
+        R -= sum/(1.0 + tableau.eigenvalue[k]);
+      }
+      const size_t k = s - f;
+      double P = 0.0, Q = 0.0, pTerm = 1.0, qTerm = 1.0;
+      for (size_t i = 0; i <= s; i++)
+      {
+        if (i <= k)
+          P += pTerm;
+        Q += qTerm;
+        pTerm *= -(double) (k - i)/((i + 1.0)*(k + s - i));
+        qTerm *= (double) (s - i)/((i + 1.0)*(k + s - i));
+      }
+      if (s <= 8)
+        maxStability = std::max(maxStability, std::abs(R - P/Q));
+    }
+    sprintf(name, "%s B(order), s <= 20", arrayName[f]);
+    checkError (name, maxB, 1.0E-13);
+    sprintf(name, "%s C(q), s <= 20", arrayName[f]);
+    checkError (name, maxC, 1.0E-14);
+    sprintf(name, "%s A = T Lambda Tinv, s <= 8", arrayName[f]);
+    checkError (name, maxEigen[0], 1.0E-13);
+    sprintf(name, "%s A = T Lambda Tinv, s = 9 .. 20", arrayName[f]);
+    checkError (name, maxEigen[1], 1.0E-6);
+    sprintf(name, "%s R(-1) = Pade (s-%lu, s), s <= 8", arrayName[f], f);
+    checkError (name, maxStability, 1.0E-12);
+  }
+
+  //3) reference integrator
+  auto fGrowth = [](const double t, const double *y, double *dydt) { dydt[0] = cos(t)*y[0]; };
+  auto jGrowth = [](const double t, const double *, double *J) { J[0] = cos(t); };
+  for (size_t f = 0; f < 3; f++)
+    for (size_t s = 2; s <= 4; s++)
+    {
+      double error[2];
+      for (size_t r = 0; r < 2; r++)
+      {
+        std::vector<double> y(1, 1.0);
+        collocationIntegrate (fGrowth, jGrowth, 1, arrayFamily[f], s, 0.0, 2.0,
+          (r == 0) ? 8 : 16, y);
+        error[r] = fabs(y[0] - exp(sin(2.0)));
+      }
+      butcherTableau tableau;
+      butcherTableauCollocation (arrayFamily[f], s, tableau);
+      const double order = log2(error[0]/error[1]);
+      sprintf(name, "%s s = %lu order %lu, observed %.2lf", arrayName[f], s, tableau.order, order);
+      checkError (name, fabs(order - tableau.order)/tableau.order, 0.15);
+    }
+
+  for (size_t f = 0; f < 3; f++)
+  {
+    double maxError = 0.0;
+    for (size_t s = 8; s <= 20; s += 4)
+    {
+      std::vector<double> y(1, 1.0);
+      if (!collocationIntegrate (fGrowth, jGrowth, 1, arrayFamily[f], s, 0.0, 2.0, 4, y))
+        exit(0);
+      maxError = std::max(maxError, fabs(y[0] - exp(sin(2.0))));
+    }
+    sprintf(name, "%s s = 8, 12, 16, 20 with 4 steps", arrayName[f]);
+    checkError (name, maxError, 1.0E-13);
+  }
+
+  const double stiffness = 1.0E6;
+  auto fStiff = [&](const double t, const double *y, double *dydt)
+  { dydt[0] = -stiffness*(y[0] - cos(t)) - sin(t); };
+  auto jStiff = [&](const double, const double *, double *J) { J[0] = -stiffness; };
+  //Gauss is not stiffly accurate and drops to its stage order on stiff problems
+  const double arrayStiffTolerance[] = {1.0E-6, 1.0E-10, 1.0E-10};
+  for (size_t f = 0; f < 3; f++)
+  {
+    std::vector<double> y(1, 1.0);
+    collocationIntegrate (fStiff, jStiff, 1, arrayFamily[f], 5, 0.0, 10.0, 20, y);
+    sprintf(name, "%s s = 5 stiff, h = 0.5", arrayName[f]);
+    checkError (name, fabs(y[0] - cos(10.0)), arrayStiffTolerance[f]);
+  }
+
+  return 1;
+}
@@ -0,0 +1,165 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+
+
+
+//1) |x-c| exp(x) over [-1, 1] with a breakpoint at the kink and mixed element orders,
+//   integrator against the materialized composite grid and the exact value
+//2) the result is bitwise identical for 1 and several OpenMP threads
+//3) 2D and 3D tensor meshes: products of the kinked 1D integrand with cos and x^5
+//4) invalid meshes and orders are rejected
+
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+
+#include <iostream>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <quadgrid/composite_grid.hpp>
+using namespace quadgrid;
+
+
+static const double kink = 0.3;
+
+static double kinked (const double x)
+{
+  return fabs(x - kink)*exp(x);
+}
+
+static double kinkedExact ()
+//Integral{ |x-c| exp(x) } over [-1, 1]
+{
+  return -kink*exp(1.0) + 2.0*exp(kink) - (kink + 2.0)*exp(-1.0);
+}
+
+static void checkError (const char *name, const double value, const double exact)
+{
+  const double error = fabs(value - exact)/fabs(exact);
+
+  char sTmp[500];
+  sprintf(sTmp, "%-24s integral = %.16le relative error = %.2le\n", name, value, error);
+  std::cout << sTmp;
+
+  if (error > 1.0E-14)
+  {
+    sprintf(sTmp, "Error. error = %.2le > 1.0E-14\n", error);
+    std::cout << sTmp;
+    exit(0);
+  }
+}
+
+
+int main()
+{
+  //1D mesh [-1, 1] with a breakpoint at the kink
+  std::vector<double> breakpoint;
+  for (size_t e = 0; e <= 9; e++)
+    breakpoint.push_back(-1.0 + (kink + 1.0)*e/9.0);
+  for (size_t e = 1; e <= 7; e++)
+    breakpoint.push_back(kink + (1.0 - kink)*e/7.0);
+  const size_t nElement = breakpoint.size()-1;
+
+  std::vector<size_t> order(nElement);
+  const size_t arrayOrder[3] = {5, 8, 12};
+  for (size_t e = 0; e < nElement; e++)
+    order[e] = arrayOrder[e%3];
+
+  //1) integrator, materialized grid and exact value
+  double integral;
+  if (!compositeGaussLegendreIntegrate (kinked, breakpoint, order, integral))
+    exit(0);
+  checkError ("1D integrator", integral, kinkedExact());
+
+  std::vector<double> x, w;
+  if (!compositeGaussLegendreGrid (breakpoint, order, x, w))
+    exit(0);
+  double sum = 0.0;
+  for (size_t i = 0; i < x.size(); i++)
+    sum += w[i]*kinked(x[i]);
+  checkError ("1D grid", sum, kinkedExact());
+
+  //2) thread count independence on a fine mesh
+  std::vector<double> fine(4097);
+  for (size_t e = 0; e < fine.size(); e++)
+    fine[e] = -1.0 + 2.0*e/(fine.size() - 1.0);
+  fine[(size_t) ((kink + 1.0)/2.0*(fine.size() - 1) + 0.5)] = kink;
+
+  double integralSerial = 0.0, integralParallel = 0.0;
+#ifdef _OPENMP
+  const int nThread = omp_get_max_threads();
+  omp_set_num_threads(1);
+#endif
+  if (!compositeGaussLegendreIntegrate (kinked, fine, std::vector<size_t>(1, 4), integralSerial))
+    exit(0);
+#ifdef _OPENMP
+  omp_set_num_threads((nThread > 1) ? nThread : 4);
+#endif
+  if (!compositeGaussLegendreIntegrate (kinked, fine, std::vector<size_t>(1, 4), integralParallel))
+    exit(0);
+#ifdef _OPENMP
+  omp_set_num_threads(nThread);
+#endif
+  checkError ("1D fine mesh", integralParallel, kinkedExact());
+  if (memcmp(&integralSerial, &integralParallel, sizeof(double)) != 0)
+  {
+    std::cout << "Error. the result depends on the number of threads\n";
+    exit(0);
+  }
+
+  //3) tensor meshes
+  std::vector< std::vector<double> > breakpoint2(2);
+  std::vector< std::vector<size_t> > order2(2);
+  breakpoint2[0] = breakpoint;
+  order2[0]      = order;
+  breakpoint2[1].push_back(0.0);
+  breakpoint2[1].push_back(0.5);
+  breakpoint2[1].push_back(2.0);
+  order2[1].push_back(20);
+
+  if (!compositeGaussLegendreIntegrateTensor (
+    [](const double *p) { return kinked(p[0])*cos(p[1]); }, breakpoint2, order2, integral))
+    exit(0);
+  checkError ("2D tensor integrator", integral, kinkedExact()*sin(2.0));
+
+  std::vector< std::vector<double> > breakpoint3(breakpoint2);
+  std::vector< std::vector<size_t> > order3(order2);
+  breakpoint3.push_back(std::vector<double>(1, -2.0));
+  breakpoint3[2].push_back(1.0);
+  order3.push_back(std::vector<size_t>(1, 3));
+
+  if (!compositeGaussLegendreIntegrateTensor (
+    [](const double *p) { return kinked(p[0])*cos(p[1])*pow(p[2], 5); }, breakpoint3, order3, integral))
+    exit(0);
+  checkError ("3D tensor integrator", integral, kinkedExact()*sin(2.0)*(1.0 - 64.0)/6.0);
+
+  //4) invalid input
+  std::vector<double> unsorted(breakpoint);
+  std::swap(unsorted[2], unsorted[3]);
+  if (compositeGaussLegendreIntegrate (kinked, unsorted, order, integral) ||
+      compositeGaussLegendreIntegrate (kinked, breakpoint, std::vector<size_t>(1, 105), integral) ||
+      compositeGaussLegendreIntegrate (kinked, breakpoint, std::vector<size_t>(2, 5), integral))
+  {
+    std::cout << "Error. invalid input accepted\n";
+    exit(0);
+  }
+
+
+  return 1;
+}
@@ -0,0 +1,163 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+
+
+
+//1) an iterated 2D tanh-sinh integral runs first: the inner integrals build the finer levels
+//   while the outer one sums a coarser level
+//2) tanh-sinh on integrands with endpoint singularities over finite intervals,
+//   compared with Gauss-Legendre of order 1000
+//3) tanh-sinh with the endpoint distance for 1/sqrt(1-x^2) and (x(2-x))^-0.9
+//4) exp-sinh on [a, inf) with a singularity at a and algebraic or exponential decay
+//5) every node is evaluated once: the evaluations match the node count of the levels
+
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+
+#include <iostream>
+#include <vector>
+
+#include <quadgrid/double_exponential.hpp>
+#include <quadgrid/gauss_legendre_grid.hpp>
+#include <quadgrid/constant.hpp>
+using namespace quadgrid;
+
+
+static void checkError (const char *name, const bool converged, const double value,
+  const double exact, const double error, const size_t nEvaluation)
+{
+  const double trueError = fabs(value - exact)/fabs(exact);
+
+  char sTmp[500];
+  sprintf(sTmp, "%-26s nEvaluation = %5lu relative error = %.2le (estimate %.2le)\n",
+    name, nEvaluation, trueError, error/fabs(exact));
+  std::cout << sTmp;
+
+  if (!converged || (trueError > 1.0E-13))
+  {
+    sprintf(sTmp, "Error. converged = %d error = %.2le > 1.0E-13\n", (int) converged, trueError);
+    std::cout << sTmp;
+    exit(0);
+  }
+}
+
+static double gaussLegendreError (double (*f)(double), const double a, const double b,
+  const double exact)
+{
+  std::vector<double> x, w;
+  gaussLegendreGrid (1000, x, w, a, b);
+  double sum = 0.0;
+  for (size_t i = 0; i < 1000; i++)
+    sum += w[i]*f(x[i]);
+  return fabs(sum - exact)/fabs(exact);
+}
+
+static double f1 (double x) { return 1.0/sqrt(x); }
+static double f2 (double x) { return log(x); }
+static double f3 (double x) { return sqrt(x)*log(x); }
+static double f4 (double x) { return log(x)*log(1.0 - x); }
+
+
+int main()
+{
+  const double relTol = 1.0E-14;
+  double integral, error;
+  size_t nEvaluation;
+
+  //1) nested: Integral{ (x+y)^-0.5 } over [0, 1]^2 = 4/3 (2 sqrt(2) - 2)
+  size_t nEvaluationInner = 0;
+  bool convergedInner = true;
+  bool converged = tanhSinhIntegrate ([&](double y)
+    {
+      double integralInner, errorInner;
+      size_t n;
+      convergedInner = tanhSinhIntegrate ([y](double x) { return 1.0/sqrt(x + y); }, 0.0, 1.0,
+        relTol, 0.0, 12, integralInner, errorInner, n) && convergedInner;
+      nEvaluationInner += n;
+      return integralInner;
+    }, 0.0, 1.0, relTol, 0.0, 10, integral, error, nEvaluation);
+  checkError ("(x+y)^-0.5 [0, 1]^2", converged && convergedInner, integral,
+    4.0/3.0*(2.0*sqrt(2.0) - 2.0), error, nEvaluation + nEvaluationInner);
+
+  //2) finite intervals
+  struct { const char *name; double (*f)(double); double a, b, exact; } arrayCase[] =
+  {
+    {"1/sqrt(x) [0, 1]",          f1, 0.0, 1.0, 2.0},
+    {"log(x) [0, 1]",             f2, 0.0, 1.0, -1.0},
+    {"sqrt(x) log(x) [0, 1]",     f3, 0.0, 1.0, -4.0/9.0},
+    {"log(x) log(1-x) [0, 1]",    f4, 0.0, 1.0, 2.0 - Pi*Pi/6.0}
+  };
+  for (size_t k = 0; k < 4; k++)
+  {
+    const bool converged = tanhSinhIntegrate (arrayCase[k].f, arrayCase[k].a, arrayCase[k].b,
+      relTol, 0.0, 10, integral, error, nEvaluation);
+    checkError (arrayCase[k].name, converged, integral, arrayCase[k].exact, error, nEvaluation);
+
+    char sTmp[500];
+    sprintf(sTmp, "%-26s Gauss-Legendre N = 1000 relative error = %.2le\n", "",
+      gaussLegendreError (arrayCase[k].f, arrayCase[k].a, arrayCase[k].b, arrayCase[k].exact));
+    std::cout << sTmp;
+  }
+
+  //3) endpoint distance
+  converged = tanhSinhIntegrateDistance (
+    [](double x, double d) { return 1.0/sqrt(d*(2.0 - d)) + 0.0*x; },
+    -1.0, 1.0, relTol, 0.0, 10, integral, error, nEvaluation);
+  checkError ("1/sqrt(1-x^2) [-1, 1]", converged, integral, Pi, error, nEvaluation);
+
+  //Integral{ (x(2-x))^-0.9 } over [0, 2] = 2^-0.8 B(0.1, 0.1)
+  converged = tanhSinhIntegrateDistance (
+    [](double x, double d) { return pow(d*(2.0 - d), -0.9) + 0.0*x; },
+    0.0, 2.0, relTol, 0.0, 10, integral, error, nEvaluation);
+  checkError ("(x(2-x))^-0.9 [0, 2]", converged, integral,
+    pow(2.0, -0.8)*exp(2.0*lgamma(0.1) - lgamma(0.2)), error, nEvaluation);
+
+  //4) exp-sinh
+  converged = expSinhIntegrate ([](double x) { return exp(-x)/sqrt(x); },
+    0.0, relTol, 0.0, 10, integral, error, nEvaluation);
+  checkError ("exp(-x)/sqrt(x) [0, inf)", converged, integral, sqrt(Pi), error, nEvaluation);
+
+  converged = expSinhIntegrate ([](double x) { return log(x)/(x*x); },
+    1.0, relTol, 0.0, 10, integral, error, nEvaluation);
+  checkError ("log(x)/x^2 [1, inf)", converged, integral, 1.0, error, nEvaluation);
+
+  converged = expSinhIntegrate ([](double x) { return 1.0/(1.0 + x*x); },
+    0.0, relTol, 0.0, 10, integral, error, nEvaluation);
+  checkError ("1/(1+x^2) [0, inf)", converged, integral, 0.5*Pi, error, nEvaluation);
+
+  //5) reuse: with the tolerance 0 all levels 0 .. 6 run; count the distinct nodes
+  size_t nCall = 0;
+  tanhSinhIntegrateDistance ([&](double x, double) { nCall++; return exp(x); },
+    0.0, 1.0, 0.0, 0.0, 6, integral, error, nEvaluation);
+  std::vector<double> node;
+  size_t nNode = 0;
+  for (size_t k = 0; ldexp((double) k, -6) <= 7.0; k++)
+  {
+    const double t = ldexp((double) k, -6);
+    const double v = 0.5*Pi*sinh(t);
+    if ((v < 690.0) && (exp(-v)/cosh(v) >= 1.0E-300))
+      nNode += (k == 0) ? 1 : 2;
+  }
+  if ((nCall != nEvaluation) || (nCall != nNode))
+  {
+    std::cout << "Error. nCall = " << nCall << " nEvaluation = " << nEvaluation;
+    std::cout << " nNode = " << nNode << "\n";
+    exit(0);
+  }
+
+
+  return 1;
+}
@@ -0,0 +1,113 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+
+
+
+//for tabulated and untabulated orders N the following test synthesizes nodal values
+//from random Legendre coefficients with legendreInverseFast, compares them with a
+//direct evaluation by legendrePoly and recovers the coefficients with legendreForwardFast
+
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+
+#include <iostream>
+#include <vector>
+
+#include <quadgrid/fast_legendre_transform.hpp>
+#include <quadgrid/legendre.hpp>
+#include <quadgrid/gauss_legendre_grid.hpp>
+#include <quadgrid/gauss_family_grid.hpp>
+using namespace quadgrid;
+
+
+int main()
+{
+  const size_t nVector = 3;
+
+  //small orders (direct conversions), tabulated orders and untabulated orders
+  std::vector<size_t> arrayOrder;
+  for (size_t N = 1; N <= 40; N++)
+    arrayOrder.push_back(N);
+  arrayOrder.push_back(127);
+  arrayOrder.push_back(128);
+  for (size_t N = 200; N <= 1000; N += 200)
+    arrayOrder.push_back(N);
+  arrayOrder.push_back(1500);
+  arrayOrder.push_back(2048);
+
+  srand(12345);
+
+  std::vector<double> x, w, P;
+  for (size_t i = 0; i < arrayOrder.size(); i++)
+  {
+    const size_t N = arrayOrder[i];
+
+    const bool tabulated = gaussLegendreGridTabulated (N);
+    if (tabulated && !gaussLegendreGrid (N, x, w, -1.0, 1.0))
+      exit(0);
+    if (!tabulated && !gaussJacobiGrid (N, x, w, 0.0, 0.0, -1.0, 1.0))
+      exit(0);
+
+    std::vector<double> c(nVector*N), f, cBack;
+    for (size_t k = 0; k < c.size(); k++)
+      c[k] = 2.0*rand()/RAND_MAX - 1.0;
+
+    if (!legendreInverseFast (N, c, nVector, f))
+      exit(0);
+    if (!legendreForwardFast (N, f, nVector, cBack))
+      exit(0);
+
+    //1) inverse transform against direct evaluation, relative to the bound Sum{ |c[n]| }
+    double maxErrorInverse = 0.0;
+    for (size_t j = 0; j < N; j++)
+    {
+      legendrePoly (P, x[j], N);
+      for (size_t v = 0; v < nVector; v++)
+      {
+        double sum = 0.0, norm = 0.0;
+        for (size_t n = 0; n < N; n++)
+        {
+          sum  += c[v*N+n]*P[n];
+          norm += fabs(c[v*N+n]);
+        }
+        const double error = fabs(f[v*N+j] - sum)/norm;
+        if (maxErrorInverse < error) maxErrorInverse = error;
+      }
+    }
+
+    //2) round trip
+    double maxErrorForward = 0.0;
+    for (size_t k = 0; k < c.size(); k++)
+    {
+      const double error = fabs(cBack[k] - c[k]);
+      if (maxErrorForward < error) maxErrorForward = error;
+    }
+
+    char sTmp[500];
+    sprintf(sTmp, "N = %4lu maxError = %.2le (inverse, relative) %.2le (round trip)\n", N,
+      maxErrorInverse, maxErrorForward);
+    std::cout << sTmp;
+
+    if ((maxErrorInverse > 1.0E-12) || (maxErrorForward > 1.0E-10))
+    {
+      std::cout << "Error. error > 1.0E-12 (inverse) or 1.0E-10 (round trip)\n";
+      exit(0);
+    }
+  }
+
+
+  return 1;
+}
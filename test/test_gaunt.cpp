@@ -0,0 +1,221 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+
+
+
+//1) Gaunt coefficients against Racah's formula for the Wigner 3j symbols (lmax = 8), the
+//   number of entries against the selection rules, and the cached table is reused
+//2) the Gaunt product expansion equals the pseudo-spectral product, for the exact
+//   (lmax3 = lmax1 + lmax2) and the truncated product
+//3) the exact product reproduces f1(r) f2(r) at random points, and many products at once
+//   equal single products
+
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+
+#include <algorithm>
+#include <complex>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include <quadgrid/gaunt.hpp>
+#include <quadgrid/spherical_harmonic.hpp>
+#include <quadgrid/constant.hpp>
+using namespace quadgrid;
+
+
+static void checkError (const char *name, const double error, const double tolerance)
+{
+  char sTmp[500];
+  sprintf(sTmp, "%-50s error = %.2le\n", name, error);
+  std::cout << sTmp;
+
+  if (!(error <= tolerance))
+  {
+    sprintf(sTmp, "Error. error = %.2le > %.2le\n", error, tolerance);
+    std::cout << sTmp;
+    exit(0);
+  }
+}
+
+static double randomValue ()
+{
+  return 2.0*rand()/RAND_MAX - 1.0;
+}
+
+static void randomCoefficients (const size_t lmax, const size_t nVector,
+  std::vector< std::complex<double> >& c)
+{
+  c.resize(nVector*sphereHarmonicArraySize (lmax));
+  for (size_t v = 0; v < nVector; v++)
+    for (size_t l = 0; l <= lmax; l++)
+      for (size_t m = 0; m <= l; m++)
+        c[v*sphereHarmonicArraySize (lmax) + sphereHarmonicArrayIndex (l, m)] =
+          std::complex<double>(randomValue (), (m == 0) ? 0.0 : randomValue ());
+}
+
+//Wigner 3j symbol (j1 j2 j3; m1 m2 m3) by Racah's formula
+static double wigner3j (const int j1, const int j2, const int j3, const int m1, const int m2,
+  const int m3)
+{
+  if ((m1 + m2 + m3 != 0) || (j3 < abs(j1-j2)) || (j3 > j1+j2) || (abs(m1) > j1) ||
+      (abs(m2) > j2) || (abs(m3) > j3))
+    return 0.0;
+  const double logTriangle = 0.5*(lgamma(j1+j2-j3+1.0) + lgamma(j1-j2+j3+1.0) +
+    lgamma(-j1+j2+j3+1.0) - lgamma(j1+j2+j3+2.0) + lgamma(j1+m1+1.0) + lgamma(j1-m1+1.0) +
+    lgamma(j2+m2+1.0) + lgamma(j2-m2+1.0) + lgamma(j3+m3+1.0) + lgamma(j3-m3+1.0));
+  double sum = 0.0;
+  for (int k = std::max(0, std::max(j2-j3-m1, j1-j3+m2)); k <= std::min(j1+j2-j3, std::min(j1-m1, j2+m2)); k++)
+  {
+    const double term = exp(logTriangle - lgamma(k+1.0) - lgamma(j1+j2-j3-k+1.0) -
+      lgamma(j1-m1-k+1.0) - lgamma(j2+m2-k+1.0) - lgamma(j3-j2+m1+k+1.0) -
+      lgamma(j3-j1-m2+k+1.0));
+    sum += (k % 2 == 0) ? term : -term;
+  }
+  return ((j1-j2-m3) % 2 == 0) ? sum : -sum;
+}
+
+//real function Sum{ c(l,m) Y(l,m) } at r
+static double evaluate (const size_t lmax, const std::complex<double> *c, const double r[3])
+{
+  std::vector< std::complex<double> > Y;
+  sphereHarmonic (Y, lmax, r);
+  double f = 0.0;
+  for (size_t l = 0; l <= lmax; l++)
+    for (size_t m = 0; m <= l; m++)
+    {
+      const size_t k = sphereHarmonicArrayIndex (l, m);
+      f += ((m == 0) ? 1.0 : 2.0)*std::real(c[k]*Y[k]);
+    }
+  return f;
+}
+
+
+int main()
+{
+  char name[200];
+  srand(44);
+
+  //1) Gaunt coefficients
+  {
+    const size_t lmax = 8;
+    std::shared_ptr< const std::vector<gauntEntry> > table, table2;
+    gauntTable (lmax, table);
+    gauntTable (lmax, table2);
+    if (table != table2)
+    {
+      std::cout << "Error. gauntTable is not cached\n";
+      exit(0);
+    }
+
+    //index of the entries by (index1, index2, index3)
+    std::vector<double> value((lmax+1)*(lmax+1)*(lmax+1)*(lmax+1)*sphereHarmonicArraySize (lmax),
+      0.0);
+    for (size_t k = 0; k < table->size(); k++)
+    {
+      const gauntEntry& e = (*table)[k];
+      value[(e.index1*(lmax+1)*(lmax+1) + e.index2)*sphereHarmonicArraySize (lmax) + e.index3] = e.value;
+    }
+
+    const int L = (int) lmax;
+    double maxError = 0.0;
+    size_t nNonzero = 0;
+    for (int l1 = 0; l1 <= L; l1++)
+      for (int m1 = -l1; m1 <= l1; m1++)
+        for (int l2 = 0; l2 <= L; l2++)
+          for (int m2 = -l2; m2 <= l2; m2++)
+            for (int l3 = 0; l3 <= L; l3++)
+            {
+              const int m3 = m1 + m2;
+              if ((m3 < 0) || (m3 > l3))
+                continue;
+              //Integral{ Y1 Y2 conj(Y3) } = (-1)^m3 sqrt((2l1+1)(2l2+1)(2l3+1)/(4 Pi))
+              //                             (l1 l2 l3; 0 0 0) (l1 l2 l3; m1 m2 -m3)
+              const double exact = ((m3 % 2 == 0) ? 1.0 : -1.0)*
+                sqrt((2.0*l1+1.0)*(2.0*l2+1.0)*(2.0*l3+1.0)/(4.0*Pi))*
+                wigner3j (l1, l2, l3, 0, 0, 0)*wigner3j (l1, l2, l3, m1, m2, -m3);
+              if (fabs(exact) > 1.0E-12)
+                nNonzero++;
+              const size_t index = (gauntArrayIndex (l1, m1)*(lmax+1)*(lmax+1) +
+                gauntArrayIndex (l2, m2))*sphereHarmonicArraySize (lmax) +
+                sphereHarmonicArrayIndex (l3, m3);
+              maxError = std::max(maxError, fabs(value[index] - exact));
+            }
+    checkError ("Gaunt coefficients against 3j symbols, lmax = 8", maxError, 1.0E-14);
+
+    //some entries allowed by the selection rules vanish through the 3j symbol
+    if ((table->size() < nNonzero) || (table->size() > 2*nNonzero))
+    {
+      std::cout << "Error. " << table->size() << " entries for " << nNonzero << " nonzero\n";
+      exit(0);
+    }
+  }
+
+  //2) Gaunt against pseudo-spectral products
+  const size_t arrayLmax[][3] = {{0, 3, 3}, {5, 7, 12}, {9, 6, 4}, {12, 12, 20}};
+  for (size_t t = 0; t < sizeof(arrayLmax)/sizeof(arrayLmax[0]); t++)
+  {
+    const size_t lmax1 = arrayLmax[t][0], lmax2 = arrayLmax[t][1], lmax3 = arrayLmax[t][2];
+    std::vector< std::complex<double> > c1, c2, c3Gaunt, c3;
+    randomCoefficients (lmax1, 1, c1);
+    randomCoefficients (lmax2, 1, c2);
+    sphereHarmonicProductGaunt (lmax1, c1, lmax2, c2, lmax3, c3Gaunt);
+    sphereHarmonicProduct (lmax1, c1, lmax2, c2, lmax3, 1, c3);
+    double maxError = 0.0;
+    for (size_t k = 0; k < c3.size(); k++)
+      maxError = std::max(maxError, std::abs(c3[k] - c3Gaunt[k]));
+    sprintf(name, "Gaunt = pseudo-spectral, lmax = %lu x %lu -> %lu", lmax1, lmax2, lmax3);
+    checkError (name, maxError, 1.0E-12);
+  }
+
+  //3) pointwise products
+  {
+    const size_t lmax1 = 40, lmax2 = 25, lmax3 = 65, nVector = 4;
+    std::vector< std::complex<double> > c1, c2, c3, c3Single;
+    randomCoefficients (lmax1, nVector, c1);
+    randomCoefficients (lmax2, nVector, c2);
+    sphereHarmonicProduct (lmax1, c1, lmax2, c2, lmax3, nVector, c3);
+
+    const size_t size1 = sphereHarmonicArraySize (lmax1), size2 = sphereHarmonicArraySize (lmax2);
+    const size_t size3 = sphereHarmonicArraySize (lmax3);
+    double maxError = 0.0;
+    for (size_t i = 0; i < 20; i++)
+    {
+      double r[3] = {randomValue (), randomValue (), randomValue ()};
+      const double norm = sqrt(r[0]*r[0] + r[1]*r[1] + r[2]*r[2]);
+      for (size_t k = 0; k < 3; k++)
+        r[k] /= norm;
+      for (size_t v = 0; v < nVector; v++)
+        maxError = std::max(maxError, fabs(evaluate (lmax1, &c1[v*size1], r)*
+          evaluate (lmax2, &c2[v*size2], r) - evaluate (lmax3, &c3[v*size3], r)));
+    }
+    checkError ("f1(r) f2(r) = f3(r), lmax = 40 x 25", maxError, 1.0E-11);
+
+    maxError = 0.0;
+    for (size_t v = 0; v < nVector; v++)
+    {
+      std::vector< std::complex<double> > c1v(c1.begin() + v*size1, c1.begin() + (v+1)*size1);
+      std::vector< std::complex<double> > c2v(c2.begin() + v*size2, c2.begin() + (v+1)*size2);
+      sphereHarmonicProduct (lmax1, c1v, lmax2, c2v, lmax3, 1, c3Single);
+      for (size_t k = 0; k < size3; k++)
+        maxError = std::max(maxError, std::abs(c3Single[k] - c3[v*size3+k]));
+    }
+    checkError ("4 products at once against single products", maxError, 1.0E-14);
+  }
+
+  return 1;
+}
@@ -0,0 +1,156 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+
+
+
+//1) Golub-Welsch from the Hermite recurrence is compared with gaussHermiteGrid
+//   (QL for small N, parallel bisection for large N)
+//2) the Gauss rule of W(x) = exp(-x) (2 + sin(3x)) on [0, 2], discretized on a
+//   200-point Gauss-Legendre grid, must reproduce the discrete moments x^k, k <= 2N-1
+//3) W(x) = 1 must reproduce gaussLegendreGrid
+
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+
+#include <iostream>
+#include <vector>
+
+#include <quadgrid/gauss_custom_grid.hpp>
+#include <quadgrid/gauss_family_grid.hpp>
+#include <quadgrid/gauss_legendre_grid.hpp>
+#include <quadgrid/constant.hpp>
+using namespace quadgrid;
+
+
+static void checkError (const char *name, const size_t N, const double maxError)
+{
+  char sTmp[500];
+  sprintf(sTmp, "%-20s N = %4lu maxError = %.2le\n", name, N, maxError);
+  std::cout << sTmp;
+
+  if (maxError > 1.0E-10)
+  {
+    sprintf(sTmp, "Error. error = %.2le > 1.0E-10\n", maxError);
+    std::cout << sTmp;
+    exit(0);
+  }
+}
+
+
+int main()
+{
+  std::vector<double> x, w, xRef, wRef;
+
+
+  //1) Hermite recurrence: alpha[k] = 0, beta[0] = sqrt(Pi), beta[k] = k/2
+  {
+    std::vector<size_t> arrayOrder;
+    for (size_t N = 1; N <= 100; N++)
+      arrayOrder.push_back(N);
+    for (size_t N = 200; N <= 1000; N += 100)
+      arrayOrder.push_back(N);
+
+    for (size_t i = 0; i < arrayOrder.size(); i++)
+    {
+      const size_t N = arrayOrder[i];
+      std::vector<double> alpha(N, 0.0), beta(N);
+      beta[0] = sqrt(Pi);
+      for (size_t k = 1; k < N; k++)
+        beta[k] = 0.5*k;
+
+      if (!gaussRecurrenceGrid (N, alpha, beta, x, w))
+        exit(0);
+      if (!gaussHermiteGrid (N, xRef, wRef, 0.0, 1.0))
+        exit(0);
+
+      double wMax = 0.0;
+      double xMax = 1.0;
+      for (size_t j = 0; j < N; j++)
+      {
+        if (wMax < wRef[j]) wMax = wRef[j];
+        if (xMax < fabs(xRef[j])) xMax = fabs(xRef[j]);
+      }
+
+      double maxError = 0.0;
+      for (size_t j = 0; j < N; j++)
+      {
+        const double errorX = fabs(x[j] - xRef[j])/xMax;
+        const double errorW = fabs(w[j] - wRef[j])/wMax;
+        if (maxError < errorX) maxError = errorX;
+        if (maxError < errorW) maxError = errorW;
+      }
+
+      checkError ("Hermite recurrence", N, maxError);
+    }
+  }
+
+
+  //2) smooth weight function on [0, 2]
+  {
+    const size_t M = 200;
+    const double a = 0.0;
+    const double b = 2.0;
+    auto weight = [](double t) { return exp(-t)*(2.0 + sin(3.0*t)); };
+
+    std::vector<double> xm, wm;
+    gaussLegendreGrid (M, xm, wm, a, b);
+
+    for (size_t N = 1; N <= 40; N++)
+    {
+      if (!gaussWeightFunctionGrid (N, weight, a, b, M, x, w))
+        exit(0);
+
+      double maxError = 0.0;
+      for (size_t k = 0; k <= 2*N-1; k++)
+      {
+        double sumNume = 0.0;
+        for (size_t j = 0; j < N; j++)
+          sumNume += w[j]*pow(x[j], (double) k);
+
+        double sumAnal = 0.0;
+        for (size_t j = 0; j < M; j++)
+          sumAnal += wm[j]*weight(xm[j])*pow(xm[j], (double) k);
+
+        const double error = fabs(sumNume - sumAnal)/sumAnal;
+        if (maxError < error) maxError = error;
+      }
+
+      checkError ("weight function", N, maxError);
+    }
+  }
+
+
+  //3) W(x) = 1 on [-1, 1]
+  for (size_t N = 1; N <= 50; N++)
+  {
+    auto one = [](double) { return 1.0; };
+    if (!gaussWeightFunctionGrid (N, one, -1.0, 1.0, 100, x, w))
+      exit(0);
+    gaussLegendreGrid (N, xRef, wRef, -1.0, 1.0);
+
+    double maxError = 0.0;
+    for (size_t j = 0; j < N; j++)
+    {
+      const double error = fabs(x[j] - xRef[j]) + fabs(w[j] - wRef[j]);
+      if (maxError < error) maxError = error;
+    }
+
+    checkError ("Legendre", N, maxError);
+  }
+
+
+  return 1;
+}
@@ -0,0 +1,175 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+
+
+
+//for each Gauss family and order N, the following test numerically integrates
+//the moments t^k (k <= 2N-1) against the weight function and compares with the
+//analytical values from the Gamma and Beta functions
+
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+
+#include <iostream>
+#include <vector>
+
+#include <quadgrid/gauss_family_grid.hpp>
+#include <quadgrid/constant.hpp>
+using namespace quadgrid;
+
+
+static void checkError (const char *name, const size_t N, const double maxError)
+{
+  char sTmp[500];
+  sprintf(sTmp, "%-30s N = %5lu maxError = %.2le\n", name, N, maxError);
+  std::cout << sTmp;
+
+  if (maxError > 1.0E-10)
+  {
+    sprintf(sTmp, "Error. error = %.2le > 1.0E-10\n", maxError);
+    std::cout << sTmp;
+    exit(0);
+  }
+}
+
+
+int main()
+{
+  const size_t kMax = 20;
+
+  //set up grid size arrays (1, 2, .. 100), (110, 120, .. 1000) and large orders, where
+  //the nodes are marched in O(N)
+  std::vector<size_t> arrayOrder;
+  for (size_t N = 1; N <= 100; N++)
+    arrayOrder.push_back(N);
+  for (size_t N = 110; N <= 1000; N += 10)
+    arrayOrder.push_back(N);
+  arrayOrder.push_back(5000);
+  arrayOrder.push_back(20000);
+
+  const double arrayAlpha[5] = {0.0, 1.0, -0.5,  0.5, 2.5};
+  const double arrayBeta[5]  = {0.0, 0.0, -0.5, -0.3, 1.5};
+
+  std::vector<double> x;
+  std::vector<double> w;
+
+  for (size_t i = 0; i < arrayOrder.size(); i++)
+  {
+    const size_t N    = arrayOrder[i];
+    const size_t kTop = (2*N-1 < kMax) ? 2*N-1 : kMax;
+
+
+    //1) Gauss-Laguerre on [a, inf) with scale s: moments of t = (x-a)/s
+    for (size_t n = 0; n < 5; n++)
+    {
+      const double alpha = arrayAlpha[n];
+      const double a     = 1.0;
+      const double s     = 2.0;
+      if (!gaussLaguerreGrid (N, x, w, alpha, a, s))
+        exit(0);
+
+      double maxError = 0.0;
+      for (size_t k = 0; k <= kTop; k++)
+      {
+        double sum = 0.0;
+        for (size_t j = 0; j < N; j++)
+          sum += w[j]*pow((x[j] - a)/s, (double) k);
+        const double anal  = s*exp(lgamma(alpha + k + 1.0));
+        const double error = fabs(sum - anal)/anal;
+        if (maxError < error) maxError = error;
+      }
+
+      char name[100];
+      sprintf(name, "Laguerre alpha = %4.1f", alpha);
+      checkError (name, N, maxError);
+    }
+
+
+    //2) Gauss-Hermite centered at c with scale s: even moments of t = (x-c)/s
+    {
+      const double c = -0.5;
+      const double s = 0.7;
+      if (!gaussHermiteGrid (N, x, w, c, s))
+        exit(0);
+
+      double maxError = 0.0;
+      for (size_t k = 0; k <= kTop; k += 2)
+      {
+        double sum = 0.0;
+        for (size_t j = 0; j < N; j++)
+          sum += w[j]*pow((x[j] - c)/s, (double) k);
+        const double anal  = s*exp(lgamma(0.5*k + 0.5));
+        const double error = fabs(sum - anal)/anal;
+        if (maxError < error) maxError = error;
+      }
+
+      checkError ("Hermite", N, maxError);
+    }
+
+
+    //3) Gauss-Jacobi on [a, b]: moments (1+t)^k
+    for (size_t n = 0; n < 5; n++)
+    {
+      const double alpha = arrayAlpha[n];
+      const double beta  = arrayBeta[n];
+      const double a     = -2.0;
+      const double b     =  3.0;
+      if (!gaussJacobiGrid (N, x, w, alpha, beta, a, b))
+        exit(0);
+
+      double maxError = 0.0;
+      for (size_t k = 0; k <= kTop; k++)
+      {
+        double sum = 0.0;
+        for (size_t j = 0; j < N; j++)
+          sum += w[j]*pow(1.0 + (2.0*x[j] - a - b)/(b - a), (double) k);
+        const double anal = 0.5*(b - a)*exp((alpha + beta + k + 1.0)*log(2.0) +
+          lgamma(alpha + 1.0) + lgamma(beta + k + 1.0) - lgamma(alpha + beta + k + 2.0));
+        const double error = fabs(sum - anal)/anal;
+        if (maxError < error) maxError = error;
+      }
+
+      char name[100];
+      sprintf(name, "Jacobi alpha = %4.1f beta = %4.1f", alpha, beta);
+      checkError (name, N, maxError);
+    }
+
+
+    //4) Gauss-Chebyshev of the first and second kind on [-1, 1]: even moments
+    for (int kind = 1; kind <= 2; kind++)
+    {
+      if (!gaussChebyshevGrid (N, x, w, kind, -1.0, 1.0))
+        exit(0);
+
+      double maxError = 0.0;
+      for (size_t k = 0; k <= kTop; k += 2)
+      {
+        double sum = 0.0;
+        for (size_t j = 0; j < N; j++)
+          sum += w[j]*pow(x[j], (double) k);
+        const double e    = (kind == 1) ? 0.5 : 1.5;
+        const double anal = exp(lgamma(0.5*k + 0.5) + lgamma(e) - lgamma(0.5*k + 0.5 + e));
+        const double error = fabs(sum - anal)/anal;
+        if (maxError < error) maxError = error;
+      }
+
+      checkError ((kind == 1) ? "Chebyshev 1st kind" : "Chebyshev 2nd kind", N, maxError);
+    }
+  }
+
+
+  return 1;
+}
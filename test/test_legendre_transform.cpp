@@ -0,0 +1,101 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+
+
+
+//for each Gauss-Legendre order N the following test synthesizes nodal values from
+//random Legendre coefficients with legendreInverse, compares them with a direct
+//evaluation by legendrePoly and recovers the coefficients with legendreForward
+
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+
+#include <iostream>
+#include <vector>
+
+#include <quadgrid/legendre_transform.hpp>
+#include <quadgrid/legendre.hpp>
+#include <quadgrid/gauss_legendre_grid.hpp>
+using namespace quadgrid;
+
+
+int main()
+{
+  const size_t nVector = 67;
+
+  //set up grid size arrays (1, 2, .. 100) and (110, 120, .. 1000)
+  std::vector<size_t> arrayOrder;
+  for (size_t N = 1; N <= 100; N++)
+    arrayOrder.push_back(N);
+  for (size_t N = 110; N <= 1000; N += 10)
+    arrayOrder.push_back(N);
+
+  srand(12345);
+
+  std::vector<double> x, w, P;
+  for (size_t i = 0; i < arrayOrder.size(); i++)
+  {
+    const size_t N = arrayOrder[i];
+    if (!gaussLegendreGrid (N, x, w, -1.0, 1.0))
+      exit(0);
+
+    std::vector<double> c(nVector*N), f, cBack;
+    for (size_t k = 0; k < c.size(); k++)
+      c[k] = 2.0*rand()/RAND_MAX - 1.0;
+
+    if (!legendreInverse (N, c, nVector, f))
+      exit(0);
+    if (!legendreForward (N, f, nVector, cBack))
+      exit(0);
+
+    //1) inverse transform against direct evaluation (vector 0 and the last vector)
+    double maxErrorInverse = 0.0;
+    for (size_t j = 0; j < N; j++)
+    {
+      legendrePoly (P, x[j], N);
+      for (size_t v = 0; v < nVector; v += nVector-1)
+      {
+        double sum = 0.0;
+        for (size_t n = 0; n < N; n++)
+          sum += c[v*N+n]*P[n];
+        const double error = fabs(f[v*N+j] - sum);
+        if (maxErrorInverse < error) maxErrorInverse = error;
+      }
+    }
+
+    //2) round trip
+    double maxErrorForward = 0.0;
+    for (size_t k = 0; k < c.size(); k++)
+    {
+      const double error = fabs(cBack[k] - c[k]);
+      if (maxErrorForward < error) maxErrorForward = error;
+    }
+
+    char sTmp[500];
+    sprintf(sTmp, "N = %4lu maxError = %.2le (inverse) %.2le (round trip)\n", N,
+      maxErrorInverse, maxErrorForward);
+    std::cout << sTmp;
+
+    if ((maxErrorInverse > 1.0E-10) || (maxErrorForward > 1.0E-10))
+    {
+      std::cout << "Error. error > 1.0E-10\n";
+      exit(0);
+    }
+  }
+
+
+  return 1;
+}
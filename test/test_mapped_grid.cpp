@@ -0,0 +1,141 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+
+
+
+//semi-infinite and infinite integrals, each map with integrands whose tails it resolves:
+//1) [a, inf): exp(-x), x^2 exp(-2x), (1+x)^-3 (algebraic), 1/(1+exp(x)) (exponential, tanh)
+//2) (-inf, inf): exp(-x^2), (1+x^2)^-3/2 (algebraic), sech(x) (exponential, tanh), sech(x)^2
+//3) scale and offset reuse the cached rule; invalid input is rejected
+
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+
+#include <iostream>
+#include <vector>
+
+#include <quadgrid/mapped_grid.hpp>
+#include <quadgrid/constant.hpp>
+using namespace quadgrid;
+
+
+static const char *mapName[3] = {"algebraic", "exponential", "tanh"};
+
+static double integrate (const bool infinite, const size_t N, const double a,
+  const double scale, const mappedGridMap map, double (*f)(double))
+{
+  std::vector<double> x, w;
+  const bool ok = infinite ? gaussLegendreInfiniteGrid (N, x, w, a, scale, map) :
+                             gaussLegendreSemiInfiniteGrid (N, x, w, a, scale, map);
+  if (!ok)
+    exit(0);
+
+  double sum = 0.0;
+  for (size_t i = 0; i < N; i++)
+    sum += w[i]*f(x[i]);
+  return sum;
+}
+
+static void checkError (const char *name, const mappedGridMap map, const size_t N,
+  const double value, const double exact, const double tolerance)
+{
+  const double error = fabs(value - exact)/fabs(exact);
+
+  char sTmp[500];
+  sprintf(sTmp, "%-22s %-12s N = %4lu relative error = %.2le\n", name, mapName[map], N, error);
+  std::cout << sTmp;
+
+  if (error > tolerance)
+  {
+    sprintf(sTmp, "Error. error = %.2le > %.2le\n", error, tolerance);
+    std::cout << sTmp;
+    exit(0);
+  }
+}
+
+static double f1 (double x) { return exp(-x); }
+static double f2 (double x) { return x*x*exp(-2.0*x); }
+static double f3 (double x) { return 1.0/((1.0 + x)*(1.0 + x)*(1.0 + x)); }
+static double f4 (double x) { return 1.0/(1.0 + exp(x)); }
+static double g1 (double x) { return exp(-x*x); }
+static double g2 (double x) { return 1.0/((1.0 + x*x)*sqrt(1.0 + x*x)); }
+static double g3 (double x) { return 1.0/cosh(x); }
+static double g4 (double x) { return 1.0/(cosh(x)*cosh(x)); }
+
+struct mappedCase
+{
+  const char   *name;
+  bool          infinite;
+  mappedGridMap map;
+  size_t        N;
+  double        scale;
+  double        (*f)(double);
+  double        exact;
+};
+
+
+int main()
+{
+  //1) [a, inf) with a = 0.5 and 2) the real line centered at 0
+  const double a = 0.5;
+  const mappedCase arrayCase[] =
+  {
+    {"exp(-x)",      false, mappedGridAlgebraic,   60, 1.0, f1, exp(-a)},
+    {"x^2 exp(-2x)", false, mappedGridAlgebraic,  100, 0.5, f2, (2.0*a*a + 2.0*a + 1.0)*exp(-2.0*a)/4.0},
+    {"(1+x)^-3",     false, mappedGridAlgebraic,   60, 1.5, f3, 0.5/((1.0 + a)*(1.0 + a))},
+    {"exp(-x)",      false, mappedGridExponential, 10, 1.0, f1, exp(-a)},
+    {"1/(1+exp(x))", false, mappedGridExponential, 40, 1.0, f4, log(1.0 + exp(-a))},
+    {"exp(-x)",      false, mappedGridTanh,        20, 2.0, f1, exp(-a)},
+    {"1/(1+exp(x))", false, mappedGridTanh,        40, 2.0, f4, log(1.0 + exp(-a))},
+    {"exp(-x^2)",    true,  mappedGridAlgebraic,  100, 1.0, g1, sqrt(Pi)},
+    {"(1+x^2)^-3/2", true,  mappedGridAlgebraic,   10, 1.0, g2, 2.0},
+    {"exp(-x^2)",    true,  mappedGridExponential, 80, 1.0, g1, sqrt(Pi)},
+    {"sech(x)",      true,  mappedGridExponential, 80, 1.0, g3, Pi},
+    {"sech(x)",      true,  mappedGridTanh,        60, 2.0, g3, Pi},
+    {"sech(x)^2",    true,  mappedGridTanh,        10, 1.0, g4, 2.0}
+  };
+  const size_t nCase = sizeof(arrayCase)/sizeof(arrayCase[0]);
+
+  for (size_t k = 0; k < nCase; k++)
+  {
+    const mappedCase& c = arrayCase[k];
+    const double value = integrate (c.infinite, c.N, c.infinite ? 0.0 : a, c.scale, c.map, c.f);
+    checkError (c.name, c.map, c.N, value, c.exact, 1.0E-13);
+  }
+
+  //3) cached rule with another scale and offset, invalid input
+  std::vector<double> x1, w1, x2, w2;
+  if (!gaussLegendreSemiInfiniteGrid (40, x1, w1, 0.0, 1.0, mappedGridExponential) ||
+      !gaussLegendreSemiInfiniteGrid (40, x2, w2, 2.0, 3.0, mappedGridExponential))
+    exit(0);
+  for (size_t i = 0; i < 40; i++)
+    if ((fabs(x2[i] - (2.0 + 3.0*x1[i])) > 1.0E-13*x2[i]) || (fabs(w2[i] - 3.0*w1[i]) > 1.0E-13*w2[i]))
+    {
+      std::cout << "Error. scaled rule differs\n";
+      exit(0);
+    }
+
+  if (gaussLegendreSemiInfiniteGrid (40, x1, w1, 0.0, 0.0, mappedGridAlgebraic) ||
+      gaussLegendreInfiniteGrid (40, x1, w1, 0.0, 1.0, (mappedGridMap) 7) ||
+      gaussLegendreInfiniteGrid (105, x1, w1, 0.0, 1.0, mappedGridTanh))
+  {
+    std::cout << "Error. invalid input accepted\n";
+    exit(0);
+  }
+
+
+  return 1;
+}
@@ -0,0 +1,105 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+
+
+
+//integrates a sum of atom-centered Gaussians exp(-alpha*|r-R|^2) over a
+//water-like molecule with Becke and Stratmann partitioning.
+//the analytical integral of each Gaussian is (Pi/alpha)^(3/2)
+
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+
+#include <iostream>
+#include <vector>
+
+#include <quadgrid/molecular_grid.hpp>
+#include <quadgrid/constant.hpp>
+using namespace quadgrid;
+
+
+int main()
+{
+  const size_t nAtom = 3;
+  const double atomCoord[3*nAtom] =
+  {
+     0.00, 0.00, 0.00,
+     1.43, 1.11, 0.00,
+    -1.43, 1.11, 0.00
+  };
+  const double atomRadius[nAtom] = {1.0, 0.7, 0.7};
+  const double alpha[nAtom]      = {1.2, 0.8, 0.8};
+
+
+  //analytical integral
+  double sumAnal = 0.0;
+  for (size_t A = 0; A < nAtom; A++)
+    sumAnal += pow(Pi/alpha[A], 1.5);
+
+
+  for (int k = 0; k < 2; k++)
+  {
+    molecularGridParameter parameter;
+    if (k == 0)
+      parameter.partition = molecularGridBecke;
+    else
+      parameter.partition = molecularGridStratmann;
+
+    //1) get grid
+    std::vector<double> x, y, z, w;
+    std::vector<size_t> atomOffset;
+    if (!molecularGrid (nAtom, atomCoord, atomRadius, parameter, x, y, z, w, atomOffset))
+    {
+      std::cout << "Error.  molecularGrid failed\n";
+      exit(0);
+    }
+
+    //2) numerical integral
+    double sumNume = 0.0;
+    for (size_t i = 0; i < w.size(); i++)
+    {
+      double f = 0.0;
+      for (size_t A = 0; A < nAtom; A++)
+      {
+        const double dx = x[i] - atomCoord[3*A  ];
+        const double dy = y[i] - atomCoord[3*A+1];
+        const double dz = z[i] - atomCoord[3*A+2];
+        f += exp(-alpha[A]*(dx*dx + dy*dy + dz*dz));
+      }
+      sumNume += w[i]*f;
+    }
+
+    const double error = fabs(sumNume - sumAnal)/sumAnal;
+
+    {
+      char sTmp[500];
+      sprintf(sTmp, "%-9s nPoint = %6lu  sum = %.12f (anal) %.12f (nume) error = %.2le\n",
+        (k == 0) ? "Becke" : "Stratmann", w.size(), sumAnal, sumNume, error);
+      std::cout << sTmp;
+    }
+
+    if (error > 1.0E-6)
+    {
+      char sTmp[500];
+      sprintf(sTmp, "Error. error = %.2le > 1.0E-6\n", error);
+      std::cout << sTmp;
+      exit(0);
+    }
+  }
+
+
+  return 1;
+}
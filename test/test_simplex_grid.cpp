@@ -0,0 +1,199 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+
+
+
+//1) symmetric triangle and tetrahedron rules integrate every monomial up to their degree
+//   (exact value a! b! c! / (a+b+c+d)!) with positive weights and interior points
+//2) collapsed (Duffy) rules with N points per direction are exact for degree 2N-1
+//3) batched integration over a triangulated square and a tetrahedralized cube
+//   (a polynomial exactly and exp(x+2y+3z) to 1e-14) and the mapped points of
+//   simplexMapBatch reproduce the batched integrals
+
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+#include <quadgrid/simplex_grid.hpp>
+using namespace quadgrid;
+
+
+static void checkError (const char *name, const size_t nPoint, const double error,
+  const double tolerance)
+{
+  char sTmp[500];
+  sprintf(sTmp, "%-40s nPoint = %6lu error = %.2le\n", name, nPoint, error);
+  std::cout << sTmp;
+
+  if (!(error <= tolerance))
+  {
+    sprintf(sTmp, "Error. error = %.2le > %.2le\n", error, tolerance);
+    std::cout << sTmp;
+    exit(0);
+  }
+}
+
+static double factorial (const size_t n)
+{
+  double f = 1.0;
+  for (size_t k = 2; k <= n; k++)
+    f *= k;
+  return f;
+}
+
+//largest relative error over the monomials of total degree <= degree; inf if a weight is
+//not positive or a point is outside the simplex
+static double monomialError (const size_t dimension, const size_t degree,
+  const std::vector<double>& x, const std::vector<double>& w)
+{
+  const size_t nPoint = w.size();
+  for (size_t p = 0; p < nPoint; p++)
+  {
+    double sum = 0.0;
+    bool inside = (w[p] > 0.0);
+    for (size_t i = 0; i < dimension; i++)
+    {
+      inside = inside && (x[p*dimension+i] > 0.0);
+      sum += x[p*dimension+i];
+    }
+    if (!inside || (sum >= 1.0))
+      return HUGE_VAL;
+  }
+
+  double maxError = 0.0;
+  for (size_t a = 0; a <= degree; a++)
+    for (size_t b = 0; a+b <= degree; b++)
+      for (size_t c = 0; (c == 0) || ((dimension == 3) && (a+b+c <= degree)); c++)
+      {
+        const double exact = factorial(a)*factorial(b)*factorial(c)/factorial(a+b+c+dimension);
+        double sum = 0.0;
+        for (size_t p = 0; p < nPoint; p++)
+        {
+          const double *y = &x[p*dimension];
+          sum += w[p]*pow(y[0], a)*pow(y[1], b)*((dimension == 3) ? pow(y[2], c) : 1.0);
+        }
+        maxError = std::max(maxError, fabs(sum - exact)/exact);
+        if (dimension == 2)
+          break;
+      }
+  return maxError;
+}
+
+
+int main()
+{
+  std::vector<double> x, w;
+  char name[200];
+
+  //1) symmetric rules
+  for (size_t degree = 1; degree <= 6; degree++)
+  {
+    triangleSymmetricGrid (degree, x, w);
+    sprintf(name, "triangle symmetric degree %lu", degree);
+    checkError (name, w.size(), monomialError (2, degree, x, w), 1.0E-14);
+  }
+  for (size_t degree = 1; degree <= 5; degree++)
+  {
+    tetrahedronSymmetricGrid (degree, x, w);
+    sprintf(name, "tetrahedron symmetric degree %lu", degree);
+    checkError (name, w.size(), monomialError (3, degree, x, w), 1.0E-14);
+  }
+
+  //2) collapsed rules
+  size_t arrayN[] = {1, 2, 5, 10, 20};
+  for (size_t k = 0; k < sizeof(arrayN)/sizeof(arrayN[0]); k++)
+  {
+    const size_t N = arrayN[k];
+    triangleCollapsedGrid (N, x, w);
+    sprintf(name, "triangle collapsed N = %lu degree %lu", N, 2*N-1);
+    checkError (name, w.size(), monomialError (2, 2*N-1, x, w), 1.0E-13);
+
+    if (N > 10)
+      continue;
+    tetrahedronCollapsedGrid (N, x, w);
+    sprintf(name, "tetrahedron collapsed N = %lu degree %lu", N, 2*N-1);
+    checkError (name, w.size(), monomialError (3, 2*N-1, x, w), 1.0E-13);
+  }
+
+  //3) batched integration over meshes of [0, 1]^2 and [0, 1]^3
+  {
+    const size_t n = 16;
+    const double h = 1.0/n;
+    std::vector<double> triangle, tetrahedron;
+    for (size_t i = 0; i < n; i++)
+      for (size_t j = 0; j < n; j++)
+      {
+        const double corner[4][2] = {{i*h, j*h}, {(i+1)*h, j*h}, {(i+1)*h, (j+1)*h}, {i*h, (j+1)*h}};
+        const int split[2][3] = {{0, 1, 2}, {0, 2, 3}};
+        for (size_t t = 0; t < 2; t++)
+          for (size_t v = 0; v < 3; v++)
+            triangle.insert(triangle.end(), corner[split[t][v]], corner[split[t][v]] + 2);
+      }
+
+    //Kuhn split of each cube along the diagonal (0,0,0)-(1,1,1)
+    const size_t m = 8;
+    const double g = 1.0/m;
+    const int path[6][3] = {{0, 1, 2}, {0, 2, 1}, {1, 0, 2}, {1, 2, 0}, {2, 0, 1}, {2, 1, 0}};
+    for (size_t i = 0; i < m; i++)
+      for (size_t j = 0; j < m; j++)
+        for (size_t k = 0; k < m; k++)
+          for (size_t t = 0; t < 6; t++)
+          {
+            double v[3] = {i*g, j*g, k*g};
+            tetrahedron.insert(tetrahedron.end(), v, v+3);
+            for (size_t s = 0; s < 3; s++)
+            {
+              v[path[t][s]] += g;
+              tetrahedron.insert(tetrahedron.end(), v, v+3);
+            }
+          }
+
+    auto polynomial = [](const double *y) -> double { return pow(y[0], 5)*y[1] + 3.0*y[1]*y[1]; };
+    auto exponential = [](const double *y) -> double { return exp(y[0] + 2.0*y[1] + 3.0*y[2]); };
+
+    std::vector<double> integral;
+    const size_t nTriangle = triangle.size()/6;
+    simplexIntegrateBatch (polynomial, 2, 6, &triangle[0], nTriangle, integral);
+    double sum = 0.0;
+    for (size_t s = 0; s < nTriangle; s++)
+      sum += integral[s];
+    checkError ("triangulated square, degree-6 polynomial", nTriangle,
+      fabs(sum - (1.0/12.0 + 1.0))/(1.0/12.0 + 1.0), 1.0E-14);
+
+    const double exact = (exp(1.0) - 1.0)*(exp(2.0) - 1.0)*(exp(3.0) - 1.0)/6.0;
+    const size_t nTetrahedron = tetrahedron.size()/12;
+    simplexIntegrateBatch (exponential, 3, 11, &tetrahedron[0], nTetrahedron, integral);
+    double sumBatch = 0.0;
+    for (size_t s = 0; s < nTetrahedron; s++)
+      sumBatch += integral[s];
+    checkError ("tetrahedralized cube, exp(x+2y+3z)", nTetrahedron,
+      fabs(sumBatch - exact)/exact, 1.0E-14);
+
+    std::vector<double> xRef, wRef;
+    simplexGrid (3, 11, xRef, wRef);
+    simplexMapBatch (3, xRef, wRef, &tetrahedron[0], nTetrahedron, x, w);
+    double sumMap = 0.0;
+    for (size_t p = 0; p < w.size(); p++)
+      sumMap += w[p]*exponential (&x[3*p]);
+    checkError ("simplexMapBatch vs simplexIntegrateBatch", w.size(),
+      fabs(sumMap - sumBatch)/exact, 1.0E-13);
+  }
+
+  return 1;
+}
@@ -0,0 +1,180 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+
+
+
+//1) Euler and Lebedev grids average every D^l_(m n) with l <= bandLimitExact exactly
+//   (1 for l = 0, else 0) and the weights sum to 1
+//2) orientation average of the rank-2 invariant (R u . v)^2 = |u|^2 |v|^2/3
+//3) SO(3) Fourier transform: forward(inverse(c)) = c and the samples match a direct
+//   evaluation of Sum{ c D^l_(m n) }
+
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+
+#include <algorithm>
+#include <complex>
+#include <iostream>
+#include <vector>
+
+#include <quadgrid/so3_grid.hpp>
+#include <quadgrid/wigner.hpp>
+using namespace quadgrid;
+
+
+static void checkError (const char *name, const double error, const double tolerance)
+{
+  char sTmp[500];
+  sprintf(sTmp, "%-50s error = %.2le\n", name, error);
+  std::cout << sTmp;
+
+  if (!(error <= tolerance))
+  {
+    sprintf(sTmp, "Error. error = %.2le > %.2le\n", error, tolerance);
+    std::cout << sTmp;
+    exit(0);
+  }
+}
+
+static double randomValue ()
+{
+  return 2.0*rand()/RAND_MAX - 1.0;
+}
+
+//D^l_(m n)(alpha, beta, gamma) from the d-matrices of beta
+static std::complex<double> wignerD (const std::vector<double>& d, const int l, const int m,
+  const int n, const double alpha, const double gamma)
+{
+  return std::polar(d[wignerArrayIndex (l, m, n)], -m*alpha - n*gamma);
+}
+
+
+int main()
+{
+  char name[200];
+  srand(43);
+
+  //1) and 2) quadratures
+  const so3GridType arrayType[] = {so3GridEuler, so3GridLebedev};
+  const char *arrayName[] = {"Euler", "Lebedev"};
+  const size_t arrayBandLimit[] = {2, 7, 12, 17};
+  for (size_t t = 0; t < 2; t++)
+    for (size_t b = 0; b < sizeof(arrayBandLimit)/sizeof(arrayBandLimit[0]); b++)
+    {
+      size_t bandLimitExact;
+      std::vector<double> euler, weight;
+      if (!so3Grid (arrayBandLimit[b], arrayType[t], bandLimitExact, euler, weight))
+      {
+        std::cout << "Error. so3Grid failed\n";
+        exit(0);
+      }
+      const int L = (int) bandLimitExact;
+      std::vector< std::complex<double> > sum(wignerArraySize (L), 0.0);
+      std::vector<double> d;
+      double sumWeight = 0.0;
+      for (size_t i = 0; i < weight.size(); i++)
+      {
+        sumWeight += weight[i];
+        wignerSmallD (L, euler[3*i+1], d);
+        for (int l = 0; l <= L; l++)
+          for (int m = -l; m <= l; m++)
+            for (int n = -l; n <= l; n++)
+              sum[wignerArrayIndex (l, m, n)] += weight[i]*wignerD (d, l, m, n, euler[3*i],
+                euler[3*i+2]);
+      }
+      double maxError = fabs(sumWeight - 1.0);
+      for (size_t k = 0; k < sum.size(); k++)
+        maxError = std::max(maxError, std::abs(sum[k] - ((k == 0) ? 1.0 : 0.0)));
+      sprintf(name, "%s L = %lu (%lu points) D^l average", arrayName[t], bandLimitExact,
+        weight.size());
+      checkError (name, maxError, 1.0E-13);
+
+      //(R u . v)^2 with R = R_z(alpha) R_y(beta) R_z(gamma)
+      const double u[3] = {0.3, -1.2, 0.7}, v[3] = {1.1, 0.4, -0.5};
+      double average = 0.0;
+      for (size_t i = 0; i < weight.size(); i++)
+      {
+        const double a = euler[3*i], be = euler[3*i+1], g = euler[3*i+2];
+        double r1[3] = {cos(g)*u[0] - sin(g)*u[1], sin(g)*u[0] + cos(g)*u[1], u[2]};
+        double r2[3] = {cos(be)*r1[0] + sin(be)*r1[2], r1[1], -sin(be)*r1[0] + cos(be)*r1[2]};
+        double r3[3] = {cos(a)*r2[0] - sin(a)*r2[1], sin(a)*r2[0] + cos(a)*r2[1], r2[2]};
+        const double dot = r3[0]*v[0] + r3[1]*v[1] + r3[2]*v[2];
+        average += weight[i]*dot*dot;
+      }
+      if (bandLimitExact >= 2)
+      {
+        const double exact = (u[0]*u[0] + u[1]*u[1] + u[2]*u[2])*(v[0]*v[0] + v[1]*v[1] + v[2]*v[2])/3.0;
+        sprintf(name, "%s L = %lu <(R u . v)^2>", arrayName[t], bandLimitExact);
+        checkError (name, fabs(average - exact), 1.0E-14);
+      }
+    }
+
+  //so3GridLebedev never returns more points than so3GridEuler
+  size_t numLarger = 0;
+  for (size_t L = 0; L <= 60; L++)
+  {
+    size_t bandLimitEuler, bandLimitLebedev;
+    std::vector<double> euler, weightEuler, weightLebedev;
+    if (!so3Grid (L, so3GridEuler, bandLimitEuler, euler, weightEuler) ||
+        !so3Grid (L, so3GridLebedev, bandLimitLebedev, euler, weightLebedev))
+    {
+      std::cout << "Error. so3Grid failed\n";
+      exit(0);
+    }
+    if ((bandLimitEuler < L) || (bandLimitLebedev < L) ||
+        (weightLebedev.size() > weightEuler.size()))
+      numLarger++;
+  }
+  checkError ("Lebedev grids larger than Euler, L <= 60", (double) numLarger, 0.5);
+
+  //3) SO(3) Fourier transform
+  const size_t arrayB[] = {1, 6, 17};
+  for (size_t b = 0; b < sizeof(arrayB)/sizeof(arrayB[0]); b++)
+  {
+    const size_t B = arrayB[b];
+    const int L = (int) B;
+    std::vector< std::complex<double> > c(wignerArraySize (B)), f, c2;
+    for (size_t k = 0; k < c.size(); k++)
+      c[k] = std::complex<double>(randomValue (), randomValue ());
+    so3FourierInverse (B, c, f);
+    so3FourierForward (B, f, c2);
+    double maxError = 0.0;
+    for (size_t k = 0; k < c.size(); k++)
+      maxError = std::max(maxError, std::abs(c2[k] - c[k]));
+    sprintf(name, "forward(inverse(c)) = c, B = %lu", B);
+    checkError (name, maxError, 1.0E-12);
+
+    std::vector<double> alpha, beta, gamma, d;
+    so3FourierGrid (B, alpha, beta, gamma);
+    const size_t n = 2*B+1;
+    maxError = 0.0;
+    for (size_t s = 0; s < 20; s++)
+    {
+      const size_t j = rand() % (B+1), a = rand() % n, g = rand() % n;
+      wignerSmallD (B, beta[j], d);
+      std::complex<double> sum = 0.0;
+      for (int l = 0; l <= L; l++)
+        for (int m = -l; m <= l; m++)
+          for (int k = -l; k <= l; k++)
+            sum += c[wignerArrayIndex (l, m, k)]*wignerD (d, l, m, k, alpha[a], gamma[g]);
+      maxError = std::max(maxError, std::abs(sum - f[(j*n + a)*n + g]));
+    }
+    sprintf(name, "inverse samples = Sum{ c D }, B = %lu", B);
+    checkError (name, maxError, 1.0E-12);
+  }
+
+  return 1;
+}
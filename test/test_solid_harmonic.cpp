@@ -0,0 +1,266 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+
+
+
+//1) solid harmonics: r^l Y and r^-(l+1) Y (unit normalization), the addition theorem
+//   1/|r - r'| = Sum{ conj(R(r')) I(r) } (Racah normalization) and the vectorized Cartesian
+//   recurrences of P2M/P2L against the sphereHarmonic based values
+//2) M2M is exact (against P2M about the new center), L2L is exact (L2P before and after)
+//3) P2M -> M2M -> M2L -> L2L -> L2P and M2P potentials and gradients against direct sums,
+//   with translations in general directions and along +-z
+
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+
+#include <algorithm>
+#include <complex>
+#include <iostream>
+#include <vector>
+
+#include <quadgrid/solid_harmonic.hpp>
+#include <quadgrid/spherical_harmonic.hpp>
+using namespace quadgrid;
+
+
+static void checkError (const char *name, const double error, const double tolerance)
+{
+  char sTmp[500];
+  sprintf(sTmp, "%-50s error = %.2le\n", name, error);
+  std::cout << sTmp;
+
+  if (!(error <= tolerance))
+  {
+    sprintf(sTmp, "Error. error = %.2le > %.2le\n", error, tolerance);
+    std::cout << sTmp;
+    exit(0);
+  }
+}
+
+static double randomValue ()
+{
+  return 2.0*rand()/RAND_MAX - 1.0;
+}
+
+//n random points in the ball of radius a about center
+static void randomBall (const size_t n, const double center[3], const double a,
+  std::vector<double>& position)
+{
+  position.resize(3*n);
+  for (size_t i = 0; i < n; i++)
+  {
+    double r[3];
+    do
+    {
+      for (size_t k = 0; k < 3; k++)
+        r[k] = randomValue ();
+    } while (r[0]*r[0] + r[1]*r[1] + r[2]*r[2] > 1.0);
+    for (size_t k = 0; k < 3; k++)
+      position[3*i+k] = center[k] + a*r[k];
+  }
+}
+
+//potential and gradient of the charges at the targets
+static void directSum (const std::vector<double>& source, const std::vector<double>& charge,
+  const std::vector<double>& target, std::vector<double>& potential,
+  std::vector<double>& gradient)
+{
+  const size_t nTarget = target.size()/3;
+  potential.assign(nTarget, 0.0);
+  gradient.assign(3*nTarget, 0.0);
+  for (size_t i = 0; i < nTarget; i++)
+    for (size_t j = 0; j < charge.size(); j++)
+    {
+      double d[3];
+      for (size_t k = 0; k < 3; k++)
+        d[k] = target[3*i+k] - source[3*j+k];
+      const double r = sqrt(d[0]*d[0] + d[1]*d[1] + d[2]*d[2]);
+      potential[i] += charge[j]/r;
+      for (size_t k = 0; k < 3; k++)
+        gradient[3*i+k] -= charge[j]*d[k]/(r*r*r);
+    }
+}
+
+static double relativeError (const std::vector<double>& a, const std::vector<double>& b)
+{
+  double error = 0.0, scale = 0.0;
+  for (size_t i = 0; i < a.size(); i++)
+  {
+    error = std::max(error, fabs(a[i] - b[i]));
+    scale = std::max(scale, fabs(b[i]));
+  }
+  return error/scale;
+}
+
+
+int main()
+{
+  char name[200];
+  srand(41);
+
+  //1) solid harmonics
+  {
+    const size_t lmax = multipoleMaxOrder;
+    const double r[3] = {1.1, 0.7, -0.9}, rs[3] = {0.3, -0.2, 0.25};
+    std::vector< std::complex<double> > R, I, Y, RUnit, IUnit;
+    solidHarmonicRegular (R, lmax, rs, solidHarmonicRacah);
+    solidHarmonicIrregular (I, lmax, r, solidHarmonicRacah);
+
+    const double rNorm = sqrt(r[0]*r[0] + r[1]*r[1] + r[2]*r[2]);
+    const double rUnit[3] = {r[0]/rNorm, r[1]/rNorm, r[2]/rNorm};
+    sphereHarmonic (Y, lmax, rUnit);
+    solidHarmonicRegular (RUnit, lmax, r, solidHarmonicUnit);
+    solidHarmonicIrregular (IUnit, lmax, r, solidHarmonicUnit);
+    double maxUnit = 0.0;
+    for (size_t l = 0; l <= lmax; l++)
+      for (size_t m = 0; m <= l; m++)
+      {
+        const size_t k = sphereHarmonicArrayIndex (l, m);
+        maxUnit = std::max(maxUnit, std::abs(RUnit[k] - pow(rNorm, (double) l)*Y[k])/
+          (pow(rNorm, (double) l)*std::abs(Y[k]) + 1.0E-300));
+        maxUnit = std::max(maxUnit, std::abs(IUnit[k] - pow(rNorm, -l-1.0)*Y[k])/
+          (pow(rNorm, -l-1.0)*std::abs(Y[k]) + 1.0E-300));
+      }
+    checkError ("unit normalization r^l Y, r^-(l+1) Y", maxUnit, 1.0E-13);
+
+    double sum = 0.0;
+    for (size_t l = 0; l <= lmax; l++)
+      for (size_t m = 0; m <= l; m++)
+      {
+        const size_t k = sphereHarmonicArrayIndex (l, m);
+        sum += ((m == 0) ? 1.0 : 2.0)*std::real(std::conj(R[k])*I[k]);
+      }
+    double d[3];
+    for (size_t k = 0; k < 3; k++)
+      d[k] = r[k] - rs[k];
+    checkError ("addition theorem 1/|r - r'|, lmax = 60",
+      fabs(sum - 1.0/sqrt(d[0]*d[0] + d[1]*d[1] + d[2]*d[2])), 1.0E-14);
+
+    //single unit charge: M = conj(R), L = conj(I)
+    const double origin[3] = {0.0, 0.0, 0.0};
+    const double charge = 1.0;
+    std::vector< std::complex<double> > M, L;
+    multipoleP2M (lmax, origin, 1, rs, &charge, M);
+    multipoleP2L (lmax, origin, 1, r, &charge, L);
+    //relative to the largest value of each degree
+    double maxR = 0.0, maxI = 0.0;
+    for (size_t l = 0; l <= lmax; l++)
+    {
+      double errorR = 0.0, errorI = 0.0, scaleR = 0.0, scaleI = 0.0;
+      for (size_t m = 0; m <= l; m++)
+      {
+        const size_t k = sphereHarmonicArrayIndex (l, m);
+        errorR = std::max(errorR, std::abs(M[k] - std::conj(R[k])));
+        errorI = std::max(errorI, std::abs(L[k] - std::conj(I[k])));
+        scaleR = std::max(scaleR, std::abs(R[k]));
+        scaleI = std::max(scaleI, std::abs(I[k]));
+      }
+      maxR = std::max(maxR, errorR/scaleR);
+      maxI = std::max(maxI, errorI/scaleI);
+    }
+    checkError ("Cartesian recurrence R(l,m), lmax = 60", maxR, 1.0E-13);
+    checkError ("Cartesian recurrence I(l,m), lmax = 60", maxI, 1.0E-13);
+  }
+
+  //2) exact translations
+  {
+    const size_t p = 12, nSource = 37;
+    const double c1[3] = {0.1, -0.2, 0.05}, c2[3] = {-0.3, 0.25, 0.4};
+    std::vector<double> source, charge(nSource);
+    randomBall (nSource, c1, 0.5, source);
+    for (size_t i = 0; i < nSource; i++)
+      charge[i] = randomValue ();
+
+    std::vector< std::complex<double> > M1, M2, M2direct;
+    multipoleP2M (p, c1, nSource, &source[0], &charge[0], M1);
+    multipoleM2M (p, c1, M1, c2, M2);
+    multipoleP2M (p, c2, nSource, &source[0], &charge[0], M2direct);
+    double error = 0.0, scale = 0.0;
+    for (size_t k = 0; k < M2.size(); k++)
+    {
+      error = std::max(error, std::abs(M2[k] - M2direct[k]));
+      scale = std::max(scale, std::abs(M2direct[k]));
+    }
+    checkError ("M2M against P2M about the new center, p = 12", error/scale, 1.0E-13);
+
+    //local expansion of distant charges
+    const double far[3] = {4.0, -3.0, 2.5};
+    std::vector<double> farSource, target, potential1(20, 0.0), potential2(20, 0.0);
+    std::vector<double> gradient1(60, 0.0), gradient2(60, 0.0);
+    std::vector< std::complex<double> > L1, L2;
+    randomBall (nSource, far, 0.5, farSource);
+    multipoleP2L (p, c1, nSource, &farSource[0], &charge[0], L1);
+    randomBall (20, c2, 0.3, target);
+    multipoleL2L (p, c1, L1, c2, L2);
+    multipoleL2P (p, c1, L1, 20, &target[0], &potential1[0], &gradient1[0]);
+    multipoleL2P (p, c2, L2, 20, &target[0], &potential2[0], &gradient2[0]);
+    checkError ("L2L potentials, p = 12", relativeError (potential2, potential1), 1.0E-13);
+    checkError ("L2L gradients, p = 12", relativeError (gradient2, gradient1), 1.0E-13);
+  }
+
+  //3) FMM chain against direct sums
+  {
+    const size_t nSource = 200, nTarget = 100;
+    const double c1[3] = {0.0, 0.0, 0.0}, c1Parent[3] = {0.2, -0.1, 0.15};
+    const double arrayOffset[][3] = {{2.3, 3.1, -2.1}, {0.0, 0.0, 4.4}, {0.0, 0.0, -4.4}};
+    const size_t arrayP[] = {4, 10, 20, 40};
+    const double arrayTolerance[] = {5.0E-3, 1.0E-6, 1.0E-12, 1.0E-13};
+    std::vector<double> source, charge(nSource), target;
+    randomBall (nSource, c1, 0.4, source);
+    for (size_t i = 0; i < nSource; i++)
+      charge[i] = randomValue ();
+
+    for (size_t o = 0; o < sizeof(arrayOffset)/sizeof(arrayOffset[0]); o++)
+    {
+      double c2[3], c2Parent[3];
+      for (size_t k = 0; k < 3; k++)
+      {
+        c2Parent[k] = c1Parent[k] + arrayOffset[o][k];
+        c2[k] = c2Parent[k] + 0.1*(k+1.0)*((k == 1) ? -1.0 : 1.0);
+      }
+      randomBall (nTarget, c2, 0.4, target);
+      std::vector<double> potential, gradient;
+      directSum (source, charge, target, potential, gradient);
+
+      for (size_t t = 0; t < sizeof(arrayP)/sizeof(arrayP[0]); t++)
+      {
+        const size_t p = arrayP[t];
+        std::vector< std::complex<double> > M, MParent, LParent, L;
+        multipoleP2M (p, c1, nSource, &source[0], &charge[0], M);
+        multipoleM2M (p, c1, M, c1Parent, MParent);
+        multipoleM2L (p, c1Parent, MParent, c2Parent, LParent);
+        multipoleL2L (p, c2Parent, LParent, c2, L);
+
+        std::vector<double> potentialFMM(nTarget, 0.0), gradientFMM(3*nTarget, 0.0);
+        multipoleL2P (p, c2, L, nTarget, &target[0], &potentialFMM[0], &gradientFMM[0]);
+        const double errorL = std::max(relativeError (potentialFMM, potential),
+          relativeError (gradientFMM, gradient));
+
+        std::vector<double> potentialM2P(nTarget, 0.0), gradientM2P(3*nTarget, 0.0);
+        multipoleM2P (p, c1Parent, MParent, nTarget, &target[0], &potentialM2P[0], &gradientM2P[0]);
+        const double errorM = std::max(relativeError (potentialM2P, potential),
+          relativeError (gradientM2P, gradient));
+
+        sprintf(name, "offset %lu p = %lu P2M-M2M-M2L-L2L-L2P", o, p);
+        checkError (name, errorL, arrayTolerance[t]);
+        sprintf(name, "offset %lu p = %lu P2M-M2M-M2P", o, p);
+        checkError (name, errorM, arrayTolerance[t]);
+      }
+    }
+  }
+
+  return 1;
+}
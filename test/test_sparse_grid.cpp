@@ -0,0 +1,252 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+
+
+
+//1) Gauss-Legendre sparse grids of level L integrate monomials of total degree 2L+1
+//   exactly in d = 8 and the weights sum to the volume of the box
+//2) nested Clenshaw-Curtis and Fejer grids: the streamed points are distinct, streaming in
+//   small blocks matches the materialized grid, and the point count is far below N^d
+//3) smooth integrand exp(Sum{ c[i] x[i] }) in d = 6, 10 and 20 (isotropic and anisotropic)
+//4) dimension-adaptive integration refines the important dimensions only
+
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+#include <quadgrid/sparse_grid.hpp>
+using namespace quadgrid;
+
+
+static void checkError (const char *name, const size_t nPoint, const double error,
+  const double tolerance)
+{
+  char sTmp[500];
+  sprintf(sTmp, "%-44s nPoint = %8lu relative error = %.2le\n", name, nPoint, error);
+  std::cout << sTmp;
+
+  if (!(error <= tolerance))
+  {
+    sprintf(sTmp, "Error. error = %.2le > %.2le\n", error, tolerance);
+    std::cout << sTmp;
+    exit(0);
+  }
+}
+
+//exp(Sum{ c[i] x[i] }) on [0, 1]^d
+static double exponentialExact (const std::vector<double>& c)
+{
+  double exact = 1.0;
+  for (size_t i = 0; i < c.size(); i++)
+    exact *= expm1(c[i])/c[i];
+  return exact;
+}
+
+static double exponentialSum (const std::vector<double>& c, const std::vector<double>& x,
+  const std::vector<double>& w)
+{
+  const size_t d = c.size();
+  double sum = 0.0;
+  for (size_t p = 0; p < w.size(); p++)
+  {
+    double s = 0.0;
+    for (size_t i = 0; i < d; i++)
+      s += c[i]*x[p*d+i];
+    sum += w[p]*exp(s);
+  }
+  return sum;
+}
+
+
+int main()
+{
+  //1) polynomial exactness of Gauss-Legendre sparse grids
+  {
+    const size_t d = 8, level = 3;
+    std::vector<double> lower(d), upper(d), x, w;
+    for (size_t i = 0; i < d; i++)
+    {
+      lower[i] = -0.5 - 0.1*i;
+      upper[i] = 1.0 + 0.2*i;
+    }
+    if (!sparseGrid (d, level, std::vector<double>(), sparseGridGaussLegendre, lower, upper, x, w))
+    {
+      std::cout << "Error. sparseGrid failed\n";
+      exit(0);
+    }
+
+    double volume = 1.0, sumW = 0.0;
+    for (size_t i = 0; i < d; i++)
+      volume *= upper[i] - lower[i];
+    for (size_t p = 0; p < w.size(); p++)
+      sumW += w[p];
+    checkError ("Gauss-Legendre d = 8 L = 3 volume", w.size(), fabs(sumW - volume)/volume, 1.0E-13);
+
+    //monomials Prod{ x[i]^e[i] } with total degree 2L+1 = 7
+    srand(7);
+    double maxError = 0.0;
+    for (size_t t = 0; t < 50; t++)
+    {
+      std::vector<size_t> e(d, 0);
+      for (size_t k = 0; k < 2*level+1; k++)
+        e[rand() % d]++;
+
+      double exact = 1.0;
+      for (size_t i = 0; i < d; i++)
+        exact *= (pow(upper[i], e[i]+1) - pow(lower[i], e[i]+1))/(e[i]+1);
+
+      double sum = 0.0, scale = 0.0;
+      for (size_t p = 0; p < w.size(); p++)
+      {
+        double v = w[p];
+        for (size_t i = 0; i < d; i++)
+          v *= pow(x[p*d+i], e[i]);
+        sum   += v;
+        scale += fabs(v);
+      }
+      maxError = std::max(maxError, fabs(sum - exact)/scale);
+    }
+    checkError ("Gauss-Legendre d = 8 L = 3 degree 7", w.size(), maxError, 1.0E-14);
+  }
+
+  //2) distinct points and streaming
+  sparseGridRule arrayRule[] = {sparseGridClenshawCurtis, sparseGridFejer2};
+  const char *arrayName[] = {"Clenshaw-Curtis", "Fejer type-2"};
+  for (size_t r = 0; r < 2; r++)
+  {
+    const size_t d = 6, level = 4;
+    std::vector<double> lower(d, 0.0), upper(d, 1.0), x, w;
+    sparseGrid (d, level, std::vector<double>(), arrayRule[r], lower, upper, x, w);
+
+    std::vector< std::vector<double> > point(w.size());
+    for (size_t p = 0; p < w.size(); p++)
+      point[p].assign(&x[p*d], &x[p*d] + d);
+    std::sort(point.begin(), point.end());
+    size_t nDuplicate = 0;
+    for (size_t p = 1; p < point.size(); p++)
+    {
+      double distance = 0.0;
+      for (size_t i = 0; i < d; i++)
+        distance = std::max(distance, fabs(point[p][i] - point[p-1][i]));
+      nDuplicate += (distance < 1.0E-12);
+    }
+
+    std::vector< std::vector<size_t> > indexSet;
+    sparseGridIndexSet (d, level, std::vector<double>(), indexSet);
+    std::vector<double> xStream, wStream;
+    size_t nBlock = 0;
+    sparseGridStream (d, indexSet, arrayRule[r], lower, upper, 100,
+      [&](const double *xBlock, const double *wBlock, const size_t nPoint)
+      {
+        nBlock++;
+        xStream.insert(xStream.end(), xBlock, xBlock + nPoint*d);
+        wStream.insert(wStream.end(), wBlock, wBlock + nPoint);
+      });
+
+    double difference = (wStream.size() == w.size()) ? 0.0 : 1.0;
+    for (size_t p = 0; (difference == 0.0) && (p < w.size()); p++)
+    {
+      difference = std::max(difference, fabs(wStream[p] - w[p]));
+      for (size_t i = 0; i < d; i++)
+        difference = std::max(difference, fabs(xStream[p*d+i] - x[p*d+i]));
+    }
+
+    //full tensor product of the finest 1D rule
+    const double nTensor = pow((r == 0) ? 17.0 : 31.0, (double) d);
+    char sTmp[500];
+    sprintf(sTmp, "%-16s d = 6 L = 4: %lu points (tensor %.0lf), %lu blocks, %lu duplicates\n",
+      arrayName[r], w.size(), nTensor, nBlock, nDuplicate);
+    std::cout << sTmp;
+    if ((nDuplicate > 0) || (difference > 0.0) || (nBlock < w.size()/100) ||
+        (w.size() > nTensor/100))
+    {
+      std::cout << "Error. duplicated points or streaming mismatch\n";
+      exit(0);
+    }
+  }
+
+  //3) smooth integrands in high dimensions
+  struct { const char *name; size_t d; double level; bool anisotropic; sparseGridRule rule;
+    double tolerance; } arrayCase[] =
+  {
+    {"Clenshaw-Curtis d = 6 L = 6",              6, 6, false, sparseGridClenshawCurtis, 1.0E-13},
+    {"Gauss-Legendre d = 6 L = 5",               6, 5, false, sparseGridGaussLegendre,  1.0E-13},
+    {"Clenshaw-Curtis d = 10 L = 5",            10, 5, false, sparseGridClenshawCurtis, 1.0E-13},
+    {"Clenshaw-Curtis d = 10 L = 8 anisotropic", 10, 8, true,  sparseGridClenshawCurtis, 1.0E-11},
+    {"Gauss-Legendre d = 20 L = 6 anisotropic", 20, 6, true,  sparseGridGaussLegendre,  1.0E-8}
+  };
+  for (size_t k = 0; k < sizeof(arrayCase)/sizeof(arrayCase[0]); k++)
+  {
+    const size_t d = arrayCase[k].d;
+    std::vector<double> c(d), anisotropy, lower(d, 0.0), upper(d, 1.0), x, w;
+    for (size_t i = 0; i < d; i++)
+      c[i] = 1.0/((i+1.0)*(i+1.0));
+    if (arrayCase[k].anisotropic)
+      for (size_t i = 0; i < d; i++)
+        anisotropy.push_back(1.0 + log(i+1.0));
+
+    sparseGrid (d, arrayCase[k].level, anisotropy, arrayCase[k].rule, lower, upper, x, w);
+    const double exact = exponentialExact (c);
+    checkError (arrayCase[k].name, w.size(), fabs(exponentialSum (c, x, w) - exact)/exact,
+      arrayCase[k].tolerance);
+  }
+
+  //4) dimension-adaptive integration
+  {
+    const size_t d = 12;
+    std::vector<double> c(d), lower(d, 0.0), upper(d, 1.0);
+    for (size_t i = 0; i < d; i++)
+      c[i] = (i < 3) ? 1.0 : 1.0E-3;
+    auto f = [&](const double *x) -> double
+    {
+      double s = 0.0;
+      for (size_t i = 0; i < d; i++)
+        s += c[i]*x[i];
+      return exp(s);
+    };
+
+    double integral, error;
+    std::vector< std::vector<size_t> > indexSet;
+    const bool converged = sparseGridIntegrateAdaptive (f, d, sparseGridClenshawCurtis,
+      lower, upper, 1.0E-12, 200000, integral, error, indexSet);
+
+    size_t maxLevelImportant = 0, maxLevelOther = 0;
+    for (size_t m = 0; m < indexSet.size(); m++)
+      for (size_t i = 0; i < d; i++)
+        if (i < 3)
+          maxLevelImportant = std::max(maxLevelImportant, indexSet[m][i]);
+        else
+          maxLevelOther = std::max(maxLevelOther, indexSet[m][i]);
+
+    const double exact = exponentialExact (c);
+    char sTmp[500];
+    sprintf(sTmp, "adaptive d = 12: %lu indices, max level %lu (important) %lu (other)\n",
+      indexSet.size(), maxLevelImportant, maxLevelOther);
+    std::cout << sTmp;
+    if (!converged || (maxLevelImportant <= maxLevelOther))
+    {
+      std::cout << "Error. adaptive integration did not converge or refine the important dimensions\n";
+      exit(0);
+    }
+    checkError ("adaptive Clenshaw-Curtis d = 12", indexSet.size(),
+      fabs(integral - exact)/exact, 1.0E-12);
+  }
+
+  return 1;
+}
@@ -0,0 +1,225 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+
+
+
+//1) 1D operators: the weights integrate x^k exactly (k <= 2N-1 Gauss-Legendre, 2N-3
+//   Gauss-Lobatto), D differentiates x^k exactly (k <= N-1), K 1 = 0 and
+//   u^T K u = Integral{ u'^2 } for u = x^(N-1)
+//2) sum-factorized tensor products match the dense Kronecker products in 1, 2 and 3
+//   dimensions for compiled (N = 3, 8) and runtime (N = 17) sizes, element count not a
+//   multiple of the block
+//3) stiffness and mass kernels of box elements match the dense element matrices
+
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+#include <quadgrid/spectral_element.hpp>
+using namespace quadgrid;
+
+
+static void checkError (const char *name, const double error, const double tolerance)
+{
+  char sTmp[500];
+  sprintf(sTmp, "%-50s error = %.2le\n", name, error);
+  std::cout << sTmp;
+
+  if (!(error <= tolerance))
+  {
+    sprintf(sTmp, "Error. error = %.2le > %.2le\n", error, tolerance);
+    std::cout << sTmp;
+    exit(0);
+  }
+}
+
+static double randomValue ()
+{
+  return 2.0*rand()/RAND_MAX - 1.0;
+}
+
+static size_t power (const size_t N, const size_t dimension)
+{
+  size_t p = 1;
+  for (size_t d = 0; d < dimension; d++)
+    p *= N;
+  return p;
+}
+
+//entry (I, J) of the dense element matrix Sum{ c_d Prod{ factor_d'(i_d', j_d') } }
+static double kroneckerEntry (const size_t dimension, const size_t N,
+  const std::vector< std::vector<double> >& A, size_t I, size_t J)
+{
+  double value = 1.0;
+  for (size_t d = 0; d < dimension; d++)
+  {
+    value *= A[d][(I % N)*N + (J % N)];
+    I /= N;
+    J /= N;
+  }
+  return value;
+}
+
+
+int main()
+{
+  std::vector<double> x, w, D, K;
+  char name[200];
+  spectralElementNodes arrayNodes[] = {spectralElementGaussLegendre, spectralElementGaussLobatto};
+  const char *arrayName[] = {"Gauss-Legendre", "Gauss-Lobatto"};
+
+  //1) 1D operators
+  for (size_t t = 0; t < 2; t++)
+  {
+    double maxW = 0.0, maxD = 0.0, maxK = 0.0;
+    for (size_t N = (t == 0) ? 1 : 2; N <= 24; N++)
+    {
+      spectralElementOperator (N, arrayNodes[t], x, w, D, K);
+
+      const size_t degree = (t == 0) ? 2*N-1 : 2*N-3;
+      for (size_t k = 0; k <= degree; k++)
+      {
+        double sum = 0.0;
+        for (size_t i = 0; i < N; i++)
+          sum += w[i]*pow(x[i], (double) k);
+        maxW = std::max(maxW, fabs(sum - ((k % 2 == 0) ? 2.0/(k+1.0) : 0.0)));
+      }
+
+      for (size_t k = 0; k < N; k++)
+        for (size_t i = 0; i < N; i++)
+        {
+          double sum = 0.0;
+          for (size_t j = 0; j < N; j++)
+            sum += D[i*N+j]*pow(x[j], (double) k);
+          const double exact = (k == 0) ? 0.0 : k*pow(x[i], k-1.0);
+          maxD = std::max(maxD, fabs(sum - exact)/std::max(1.0, (double) k));
+        }
+
+      //K 1 = 0, symmetry and the energy of x^(N-1)
+      double energy = 0.0;
+      for (size_t i = 0; i < N; i++)
+      {
+        double row = 0.0;
+        for (size_t j = 0; j < N; j++)
+        {
+          row += K[i*N+j];
+          maxK = std::max(maxK, fabs(K[i*N+j] - K[j*N+i]));
+          energy += pow(x[i], N-1.0)*K[i*N+j]*pow(x[j], N-1.0);
+        }
+        maxK = std::max(maxK, fabs(row));
+      }
+      const double exact = (N == 1) ? 0.0 : (N-1.0)*(N-1.0)*2.0/(2.0*N-3.0);
+      maxK = std::max(maxK, fabs(energy - exact)/std::max(1.0, exact));
+    }
+    sprintf(name, "%s weights, N <= 24", arrayName[t]);
+    checkError (name, maxW, 1.0E-14);
+    sprintf(name, "%s differentiation, N <= 24", arrayName[t]);
+    checkError (name, maxD, 1.0E-11);
+    sprintf(name, "%s stiffness, N <= 24", arrayName[t]);
+    checkError (name, maxK, 1.0E-11);
+  }
+
+  //2) sum factorization against dense Kronecker products
+  srand(40);
+  const size_t nElement = 13;
+  size_t arrayN[] = {3, 8, 17};
+  for (size_t dimension = 1; dimension <= 3; dimension++)
+    for (size_t k = 0; k < sizeof(arrayN)/sizeof(arrayN[0]); k++)
+    {
+      const size_t N = arrayN[k];
+      const size_t nNode = power (N, dimension);
+      std::vector< std::vector<double> > A(dimension, std::vector<double>(N*N));
+      for (size_t d = 0; d < dimension; d++)
+        for (size_t i = 0; i < N*N; i++)
+          A[d][i] = randomValue ();
+      std::vector<double> u(nElement*nNode), v(nElement*nNode);
+      for (size_t i = 0; i < u.size(); i++)
+        u[i] = randomValue ();
+
+      spectralElementTensorApply (dimension, N, A, nElement, &u[0], &v[0]);
+
+      //rows sampled with a stride for the large 3D case
+      const size_t stride = (nNode > 1000) ? 37 : 1;
+      double maxError = 0.0;
+      for (size_t e = 0; e < nElement; e++)
+        for (size_t I = 0; I < nNode; I += stride)
+        {
+          double sum = 0.0;
+          for (size_t J = 0; J < nNode; J++)
+            sum += kroneckerEntry (dimension, N, A, I, J)*u[e*nNode+J];
+          maxError = std::max(maxError, fabs(v[e*nNode+I] - sum)/(1.0 + fabs(sum)));
+        }
+      sprintf(name, "tensor apply dimension %lu N = %lu", dimension, N);
+      checkError (name, maxError, 1.0E-13);
+    }
+
+  //3) stiffness and mass of box elements
+  for (size_t t = 0; t < 2; t++)
+    for (size_t dimension = 1; dimension <= 3; dimension++)
+    {
+      const size_t N = (dimension == 3) ? 5 : 9;
+      const size_t nNode = power (N, dimension);
+      spectralElementOperator (N, arrayNodes[t], x, w, D, K);
+      std::vector<double> W(N*N, 0.0);
+      for (size_t i = 0; i < N; i++)
+        W[i*N+i] = w[i];
+
+      std::vector<double> h(nElement*dimension), u(nElement*nNode), vK(nElement*nNode),
+        vM(nElement*nNode);
+      for (size_t i = 0; i < h.size(); i++)
+        h[i] = 0.5 + fabs(randomValue ());
+      for (size_t i = 0; i < u.size(); i++)
+        u[i] = randomValue ();
+      spectralElementStiffnessApply (dimension, N, arrayNodes[t], nElement, &h[0], &u[0], &vK[0]);
+      spectralElementMassApply (dimension, N, arrayNodes[t], nElement, &h[0], &u[0], &vM[0]);
+
+      std::vector< std::vector<double> > AM(dimension, W);
+      std::vector< std::vector< std::vector<double> > > AK(dimension, AM);
+      for (size_t d = 0; d < dimension; d++)
+        AK[d][d] = K;
+
+      double maxError = 0.0;
+      for (size_t e = 0; e < nElement; e++)
+      {
+        double volume = 1.0;
+        for (size_t d = 0; d < dimension; d++)
+          volume *= 0.5*h[e*dimension+d];
+
+        for (size_t I = 0; I < nNode; I++)
+        {
+          double sumK = 0.0, sumM = 0.0;
+          for (size_t J = 0; J < nNode; J++)
+          {
+            sumM += volume*kroneckerEntry (dimension, N, AM, I, J)*u[e*nNode+J];
+            for (size_t d = 0; d < dimension; d++)
+            {
+              const double c = volume*4.0/(h[e*dimension+d]*h[e*dimension+d]);
+              sumK += c*kroneckerEntry (dimension, N, AK[d], I, J)*u[e*nNode+J];
+            }
+          }
+          maxError = std::max(maxError, fabs(vK[e*nNode+I] - sumK)/(1.0 + fabs(sumK)));
+          maxError = std::max(maxError, fabs(vM[e*nNode+I] - sumM)/(1.0 + fabs(sumM)));
+        }
+      }
+      sprintf(name, "%s stiffness and mass, dimension %lu N = %lu", arrayName[t], dimension, N);
+      checkError (name, maxError, 1.0E-13);
+    }
+
+  return 1;
+}
@@ -0,0 +1,466 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+
+
+
+//1) sphereTransformInverse equals Sum{ c(l,m) Y(l,m) } evaluated with sphereHarmonic at
+//   every grid point
+//2) sphereTransformForward(sphereTransformInverse(c)) = c on grids with gridLmax >= 2 lmax,
+//   several vectors at once against single vectors
+//3) gridLmax < lmax is rejected
+//4) spin 1 and 2 transforms: the inverse equals -Sum{ (E + iB) sY } over -l <= m <= l at grid
+//   points, and forward(inverse(E, B)) = (E, B)
+//5) vector transforms: the field of gradient(l,m) = sqrt(l(l+1)) c(l,m) is the gradient of
+//   Sum{ c Y } (central differences), and the round trip recovers gradient and curl
+//6) polar ring truncation: threshold 0 keeps every degree, the default threshold skips the
+//   large orders near the poles only, and the truncated transforms agree with the full ones
+//7) the rings of unitSphereGaussLegendre pair up: theta[N-1-i] = pi - theta[i] with equal weights,
+//   which the transforms use to evaluate the Legendre tables on half of the rings
+//8) batches of 37 functions (one full pass of 32 and the tiles of 4, 1) equal single functions
+//9) Legendre tables: recomputed, stored on the heap within a partial and a full budget and stored
+//   in a memory-mapped file give the same transforms, the reported blocks respect the budget,
+//   which is shared by the tables of all lmax, and a directory that cannot hold the file falls
+//   back to recomputing
+
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+
+#include <algorithm>
+#include <complex>
+#include <iostream>
+#include <vector>
+
+#include <quadgrid/sphere_transform.hpp>
+#include <quadgrid/spherical_harmonic.hpp>
+#include <quadgrid/unit_sphere_grid_gauss_legendre.hpp>
+using namespace quadgrid;
+
+
+static void checkError (const char *name, const double error, const double tolerance)
+{
+  char sTmp[500];
+  sprintf(sTmp, "%-50s error = %.2le\n", name, error);
+  std::cout << sTmp;
+
+  if (!(error <= tolerance))
+  {
+    sprintf(sTmp, "Error. error = %.2le > %.2le\n", error, tolerance);
+    std::cout << sTmp;
+    exit(0);
+  }
+}
+
+static double randomValue ()
+{
+  return 2.0*rand()/RAND_MAX - 1.0;
+}
+
+static void randomCoefficients (const size_t lmax, const size_t nVector,
+  std::vector< std::complex<double> >& c)
+{
+  c.resize(nVector*sphereHarmonicArraySize (lmax));
+  for (size_t v = 0; v < nVector; v++)
+    for (size_t l = 0; l <= lmax; l++)
+      for (size_t m = 0; m <= l; m++)
+        c[v*sphereHarmonicArraySize (lmax) + sphereHarmonicArrayIndex (l, m)] =
+          std::complex<double>(randomValue (), (m == 0) ? 0.0 : randomValue ());
+}
+
+
+int main()
+{
+  char name[200];
+  srand(44);
+
+  //1) synthesis against sphereHarmonic
+  {
+    const size_t lmax = 20, gridLmax = 33;
+    std::vector< std::complex<double> > c, Y;
+    std::vector<double> f, theta, w, phi;
+    randomCoefficients (lmax, 1, c);
+    sphereTransformInverse (lmax, gridLmax, c, 1, f);
+    size_t N;
+    unitSphereGaussLegendre (gridLmax, N, theta, w, phi);
+    double maxError = 0.0;
+    for (size_t i = 0; i < N; i++)
+      for (size_t j = 0; j < 2*N; j++)
+      {
+        sphereHarmonic (Y, lmax, theta[i], phi[j]);
+        double sum = 0.0;
+        for (size_t l = 0; l <= lmax; l++)
+          for (size_t m = 0; m <= l; m++)
+          {
+            const size_t k = sphereHarmonicArrayIndex (l, m);
+            sum += ((m == 0) ? 1.0 : 2.0)*std::real(c[k]*Y[k]);
+          }
+        maxError = std::max(maxError, fabs(sum - f[i*2*N + j]));
+      }
+    checkError ("inverse = Sum{ c Y }, lmax = 20", maxError, 1.0E-12);
+  }
+
+  //2) round trip
+  const size_t arrayLmax[] = {0, 1, 7, 30, 150};
+  for (size_t t = 0; t < sizeof(arrayLmax)/sizeof(arrayLmax[0]); t++)
+  {
+    const size_t lmax = arrayLmax[t], nVector = 3, size = sphereHarmonicArraySize (lmax);
+    std::vector< std::complex<double> > c, c2, cSingle;
+    std::vector<double> f;
+    randomCoefficients (lmax, nVector, c);
+    sphereTransformInverse (lmax, 2*lmax, c, nVector, f);
+    sphereTransformForward (lmax, 2*lmax, f, nVector, c2);
+    double maxError = 0.0;
+    for (size_t k = 0; k < c.size(); k++)
+      maxError = std::max(maxError, std::abs(c2[k] - c[k]));
+    //the tabulated Gauss-Legendre weights carry relative errors of a few 1e-14
+    sprintf(name, "forward(inverse(c)) = c, lmax = %lu", lmax);
+    checkError (name, maxError, 1.0E-13*(lmax+1));
+
+    maxError = 0.0;
+    for (size_t v = 0; v < nVector; v++)
+    {
+      std::vector< std::complex<double> > cv(c.begin() + v*size, c.begin() + (v+1)*size);
+      std::vector<double> fv;
+      sphereTransformInverse (lmax, 2*lmax, cv, 1, fv);
+      sphereTransformForward (lmax, 2*lmax, fv, 1, cSingle);
+      for (size_t k = 0; k < size; k++)
+        maxError = std::max(maxError, std::abs(cSingle[k] - c2[v*size+k]));
+    }
+    sprintf(name, "3 vectors at once against single vectors, lmax = %lu", lmax);
+    checkError (name, maxError, 1.0E-14);
+  }
+
+  //3) invalid grid
+  {
+    std::vector< std::complex<double> > c;
+    std::vector<double> f;
+    randomCoefficients (10, 1, c);
+    if (sphereTransformInverse (10, 9, c, 1, f))
+    {
+      std::cout << "Error. gridLmax < lmax accepted\n";
+      exit(0);
+    }
+  }
+
+  //4) spin transforms
+  for (int s = 1; s <= 2; s++)
+  {
+    const size_t lmax = 12, gridLmax = 26;
+    std::vector< std::complex<double> > E, B, f, sY;
+    std::vector<double> theta, w, phi;
+    randomCoefficients (lmax, 1, E);
+    randomCoefficients (lmax, 1, B);
+    sphereTransformSpinInverse (s, lmax, gridLmax, E, B, 1, f);
+    size_t N;
+    unitSphereGaussLegendre (gridLmax, N, theta, w, phi);
+    double maxError = 0.0;
+    for (size_t i = 0; i < N; i += 3)
+      for (size_t j = 0; j < 2*N; j += 2)
+      {
+        sphereHarmonicSpin (sY, s, lmax, theta[i], phi[j]);
+        std::complex<double> sum = 0.0;
+        for (int l = s; l <= (int) lmax; l++)
+          for (int m = -l; m <= l; m++)
+          {
+            //E(l,-m) = (-1)^m conj(E(l,m))
+            const size_t k = sphereHarmonicArrayIndex (l, abs(m));
+            const double sign = ((m < 0) && (m % 2 != 0)) ? -1.0 : 1.0;
+            const std::complex<double> e = (m < 0) ? sign*std::conj(E[k]) : E[k];
+            const std::complex<double> b = (m < 0) ? sign*std::conj(B[k]) : B[k];
+            sum -= (e + std::complex<double>(0.0, 1.0)*b)*sY[sphereHarmonicSpinArrayIndex (l, m)];
+          }
+        maxError = std::max(maxError, std::abs(sum - f[i*2*N + j]));
+      }
+    sprintf(name, "spin %d inverse = -Sum{ (E + iB) sY }", s);
+    checkError (name, maxError, 1.0E-12);
+  }
+
+  for (int s = 1; s <= 2; s++)
+    for (size_t t = 0; t < sizeof(arrayLmax)/sizeof(arrayLmax[0]); t++)
+    {
+      const size_t lmax = std::max(arrayLmax[t], (size_t) s), nVector = 2;
+      std::vector< std::complex<double> > E, B, f, E2, B2;
+      randomCoefficients (lmax, nVector, E);
+      randomCoefficients (lmax, nVector, B);
+      //no spin s harmonics below degree s
+      for (size_t v = 0; v < nVector; v++)
+        for (size_t k = 0; k < sphereHarmonicArraySize (s-1); k++)
+          E[v*sphereHarmonicArraySize (lmax) + k] = B[v*sphereHarmonicArraySize (lmax) + k] = 0.0;
+      sphereTransformSpinInverse (s, lmax, 2*lmax, E, B, nVector, f);
+      sphereTransformSpinForward (s, lmax, 2*lmax, f, nVector, E2, B2);
+      double maxError = 0.0;
+      for (size_t k = 0; k < E.size(); k++)
+        maxError = std::max(maxError, std::max(std::abs(E2[k] - E[k]), std::abs(B2[k] - B[k])));
+      sprintf(name, "spin %d forward(inverse(E, B)), lmax = %lu", s, lmax);
+      checkError (name, maxError, 1.0E-13*(lmax+1));
+    }
+
+  //5) vector transforms
+  {
+    const size_t lmax = 15, gridLmax = 30, size = sphereHarmonicArraySize (lmax);
+    std::vector< std::complex<double> > c, gradient(size), curl(size, 0.0), gradient2, curl2, Y;
+    std::vector<double> vTheta, vPhi, theta, w, phi;
+    randomCoefficients (lmax, 1, c);
+    for (size_t l = 0; l <= lmax; l++)
+      for (size_t m = 0; m <= l; m++)
+        gradient[sphereHarmonicArrayIndex (l, m)] = sqrt(l*(l+1.0))*c[sphereHarmonicArrayIndex (l, m)];
+    sphereTransformVectorInverse (lmax, gridLmax, gradient, curl, 1, vTheta, vPhi);
+    size_t N;
+    unitSphereGaussLegendre (gridLmax, N, theta, w, phi);
+
+    //f(theta, phi) = Sum{ c Y }
+    auto evaluate = [&](const double t, const double p)
+    {
+      sphereHarmonic (Y, lmax, t, p);
+      double sum = 0.0;
+      for (size_t l = 0; l <= lmax; l++)
+        for (size_t m = 0; m <= l; m++)
+        {
+          const size_t k = sphereHarmonicArrayIndex (l, m);
+          sum += ((m == 0) ? 1.0 : 2.0)*std::real(c[k]*Y[k]);
+        }
+      return sum;
+    };
+    const double h = 1.0E-6;
+    double maxError = 0.0;
+    for (size_t i = 0; i < N; i += 2)
+      for (size_t j = 0; j < 2*N; j += 3)
+      {
+        const double dTheta = (evaluate (theta[i]+h, phi[j]) - evaluate (theta[i]-h, phi[j]))/(2.0*h);
+        const double dPhi = (evaluate (theta[i], phi[j]+h) - evaluate (theta[i], phi[j]-h))/
+          (2.0*h*sin(theta[i]));
+        maxError = std::max(maxError, std::max(fabs(dTheta - vTheta[i*2*N + j]),
+          fabs(dPhi - vPhi[i*2*N + j])));
+      }
+    checkError ("vector field of gradient = grad Sum{ c Y }", maxError, 1.0E-7);
+
+    std::vector< std::complex<double> > curlRandom;
+    randomCoefficients (lmax, 1, curlRandom);
+    curlRandom[0] = gradient[0] = 0.0;
+    sphereTransformVectorInverse (lmax, gridLmax, gradient, curlRandom, 1, vTheta, vPhi);
+    sphereTransformVectorForward (lmax, gridLmax, vTheta, vPhi, 1, gradient2, curl2);
+    maxError = 0.0;
+    for (size_t k = 0; k < size; k++)
+      maxError = std::max(maxError, std::max(std::abs(gradient2[k] - gradient[k]),
+        std::abs(curl2[k] - curlRandom[k])));
+    checkError ("vector forward(inverse(gradient, curl))", maxError, 1.0E-12);
+  }
+
+  //6) polar ring truncation
+  {
+    const double threshold = sphereTransformPolarThreshold ();
+    if (sphereTransformSetPolarThreshold (-1.0))
+    {
+      std::cout << "Error. negative threshold accepted\n";
+      exit(0);
+    }
+
+    const size_t lmax = 300, gridLmax = 2*lmax, L = lmax + 1;
+    std::vector<size_t> lstart, lstartFull;
+    std::vector< std::complex<double> > c, cFull, cTruncated, E, B, f, fFull, E2, B2, E2Full, B2Full;
+    std::vector<double> g, gFull;
+    randomCoefficients (lmax, 2, c);
+    randomCoefficients (lmax, 1, E);
+    randomCoefficients (lmax, 1, B);
+    E[0] = B[0] = E[1] = B[1] = E[2] = B[2] = 0.0;
+
+    //P(lmax,lmax) underflows to zero on the polar rings at lmax = 300
+    sphereTransformSetPolarThreshold (0.0);
+    sphereTransformRingStart (0, 30, 60, lstartFull);
+    size_t nError = 0;
+    for (size_t k = 0; k < lstartFull.size(); k++)
+      nError += (lstartFull[k] != k % 31);
+    checkError ("threshold 0 keeps every degree, lmax = 30", nError, 0.0);
+    sphereTransformInverse (lmax, gridLmax, c, 2, gFull);
+    sphereTransformForward (lmax, gridLmax, gFull, 2, cFull);
+    sphereTransformSpinInverse (2, lmax, gridLmax, E, B, 1, fFull);
+    sphereTransformSpinForward (2, lmax, gridLmax, fFull, 1, E2Full, B2Full);
+
+    sphereTransformSetPolarThreshold (threshold);
+    sphereTransformRingStart (0, lmax, gridLmax, lstart);
+    const size_t N = lstart.size()/L;
+    size_t nSkip = 0, nTotal = 0;
+    for (size_t i = 0; i < N; i++)
+      for (size_t m = 0; m <= lmax; m++)
+      {
+        nSkip  += lstart[i*L + m] - m;
+        nTotal += L - m;
+      }
+    std::cout << "skipped Legendre terms at lmax = 300: " << (100.0*nSkip)/nTotal << "%\n";
+    nError = (lstart[lmax] <= lmax) + (lstart[(N-1)*L + lmax] <= lmax) + (nSkip == 0);
+    for (size_t m = 0; m <= lmax; m++)
+      nError += (lstart[(N/2)*L + m] != m);
+    checkError ("poles truncated, equator kept", nError, 0.0);
+
+    sphereTransformInverse (lmax, gridLmax, c, 2, g);
+    sphereTransformForward (lmax, gridLmax, g, 2, cTruncated);
+    sphereTransformSpinInverse (2, lmax, gridLmax, E, B, 1, f);
+    sphereTransformSpinForward (2, lmax, gridLmax, f, 1, E2, B2);
+    //both recurrences start from the values of sphereHarmonic, rounding differs by O(lmax eps)
+    double maxError = 0.0, maxValue = 0.0;
+    for (size_t k = 0; k < g.size(); k++)
+    {
+      maxError = std::max(maxError, fabs(g[k] - gFull[k]));
+      maxValue = std::max(maxValue, fabs(gFull[k]));
+    }
+    checkError ("truncated inverse = full (relative), lmax = 300", maxError/maxValue, 1.0E-14);
+    maxError = 0.0;
+    for (size_t k = 0; k < c.size(); k++)
+      maxError = std::max(maxError, std::max(std::abs(cTruncated[k] - cFull[k]), std::abs(cTruncated[k] - c[k])));
+    checkError ("truncated forward = full = c, lmax = 300", maxError, 1.0E-13*(lmax+1));
+    maxError = maxValue = 0.0;
+    for (size_t k = 0; k < f.size(); k++)
+    {
+      maxError = std::max(maxError, std::abs(f[k] - fFull[k]));
+      maxValue = std::max(maxValue, std::abs(fFull[k]));
+    }
+    checkError ("truncated spin 2 inverse = full (relative)", maxError/maxValue, 1.0E-14);
+    maxError = 0.0;
+    for (size_t k = 0; k < E.size(); k++)
+      maxError = std::max(maxError, std::max(std::abs(E2[k] - E2Full[k]), std::abs(B2[k] - B2Full[k])));
+    checkError ("truncated spin 2 forward = full", maxError, 1.0E-13);
+  }
+
+  //7) equatorial symmetry of the grids
+  {
+    double maxError = 0.0;
+    for (size_t gridLmax = 0; gridLmax <= 400; gridLmax++)
+    {
+      size_t N;
+      std::vector<double> theta, w, phi;
+      unitSphereGaussLegendre (gridLmax, N, theta, w, phi);
+      for (size_t i = 0; i < N; i++)
+        maxError = std::max(maxError, std::max(fabs(theta[i] + theta[N-1-i] - M_PI),
+          fabs(w[i] - w[N-1-i])/w[i]));
+    }
+    checkError ("theta[N-1-i] = pi - theta[i], w[N-1-i] = w[i]", maxError, 1.0E-13);
+
+    std::vector<size_t> lstart;
+    sphereTransformRingStart (2, 300, 600, lstart);
+    const size_t L = 301, N = lstart.size()/L;
+    size_t nError = 0;
+    for (size_t i = 0; i < N; i++)
+      for (size_t m = 0; m < L; m++)
+        nError += (lstart[i*L + m] != lstart[(N-1-i)*L + m]);
+    checkError ("mirror rings start at the same degree", nError, 0.0);
+  }
+
+  //8) batched functions
+  {
+    const size_t lmax = 40, gridLmax = 85, nVector = 37, size = sphereHarmonicArraySize (lmax);
+    std::vector< std::complex<double> > c, c2, cSingle;
+    std::vector<double> f, fSingle;
+    randomCoefficients (lmax, nVector, c);
+    sphereTransformInverse (lmax, gridLmax, c, nVector, f);
+    sphereTransformForward (lmax, gridLmax, f, nVector, c2);
+    const size_t nGrid = f.size()/nVector;
+    double maxError = 0.0, maxErrorForward = 0.0;
+    for (size_t v = 0; v < nVector; v++)
+    {
+      std::vector< std::complex<double> > cv(c.begin() + v*size, c.begin() + (v+1)*size);
+      sphereTransformInverse (lmax, gridLmax, cv, 1, fSingle);
+      for (size_t k = 0; k < nGrid; k++)
+        maxError = std::max(maxError, fabs(fSingle[k] - f[v*nGrid + k]));
+      std::vector<double> fv(f.begin() + v*nGrid, f.begin() + (v+1)*nGrid);
+      sphereTransformForward (lmax, gridLmax, fv, 1, cSingle);
+      for (size_t k = 0; k < size; k++)
+        maxErrorForward = std::max(maxErrorForward, std::abs(cSingle[k] - c2[v*size + k]));
+    }
+    checkError ("inverse of 37 functions = single functions", maxError, 1.0E-13);
+    checkError ("forward of 37 functions = single functions", maxErrorForward, 1.0E-15);
+  }
+
+  //9) stored and recomputed Legendre tables
+  {
+    const size_t lmax = 100, gridLmax = 200, nVector = 5;
+    std::vector< std::complex<double> > c, c2, c2Recompute;
+    std::vector<double> f, fRecompute;
+    std::vector<sphereTransformLegendreBlock> block;
+    randomCoefficients (lmax, nVector, c);
+
+    sphereTransformSetLegendreBudget (0, "");
+    sphereTransformInverse (lmax, gridLmax, c, nVector, fRecompute);
+    sphereTransformForward (lmax, gridLmax, fRecompute, nVector, c2Recompute);
+    sphereTransformLegendreTables (lmax, gridLmax, block);
+    size_t nError = (block.size() != (lmax+16)/16), total = 0;
+    for (size_t b = 0; b < block.size(); b++)
+    {
+      nError += block[b].stored + (block[b].mBegin != 16*b);
+      total += block[b].bytes;
+    }
+    checkError ("budget 0 recomputes every block", nError, 0.0);
+
+    const size_t arrayBudget[] = {total/2, total, total};
+    const char *arrayDirectory[] = {"", "", "/tmp"};
+    for (size_t t = 0; t < 3; t++)
+    {
+      sphereTransformSetLegendreBudget (arrayBudget[t], arrayDirectory[t]);
+      sphereTransformInverse (lmax, gridLmax, c, nVector, f);
+      sphereTransformForward (lmax, gridLmax, f, nVector, c2);
+      sphereTransformLegendreTables (lmax, gridLmax, block);
+      size_t nStored = 0, bytes = 0;
+      nError = 0;
+      for (size_t b = 0; b < block.size(); b++)
+      {
+        nStored += block[b].stored;
+        bytes += block[b].stored ? block[b].bytes : 0;
+        nError += (block[b].mapped != (block[b].stored && (t == 2)));
+      }
+      nError += (bytes > arrayBudget[t]) + (nStored == 0) + ((t > 0) && (nStored != block.size())) +
+        ((t == 0) && (nStored == block.size()));
+      sprintf(name, "budget %lu%% of the tables%s: %lu of %lu blocks stored", (100*arrayBudget[t])/total,
+        (t == 2) ? " (mapped)" : "", nStored, block.size());
+      checkError (name, nError, 0.0);
+
+      double maxError = 0.0;
+      for (size_t k = 0; k < f.size(); k++)
+        maxError = std::max(maxError, fabs(f[k] - fRecompute[k]));
+      for (size_t k = 0; k < c2.size(); k++)
+        maxError = std::max(maxError, std::abs(c2[k] - c2Recompute[k]));
+      checkError ("stored tables = recomputed tables", maxError, 0.0);
+    }
+
+    //the full budget is taken by lmax = 100, the tables of lmax = 50 are recomputed
+    const size_t lmaxSmall = 50;
+    std::vector< std::complex<double> > cSmall;
+    std::vector<double> fSmall, fSmallRecompute;
+    randomCoefficients (lmaxSmall, nVector, cSmall);
+    sphereTransformSetLegendreBudget (0, "");
+    sphereTransformInverse (lmaxSmall, gridLmax, cSmall, nVector, fSmallRecompute);
+    sphereTransformSetLegendreBudget (total, "");
+    sphereTransformLegendreTables (lmax, gridLmax, block);
+    sphereTransformInverse (lmaxSmall, gridLmax, cSmall, nVector, fSmall);
+    sphereTransformLegendreTables (lmaxSmall, gridLmax, block);
+    nError = 0;
+    for (size_t b = 0; b < block.size(); b++)
+      nError += block[b].stored;
+    for (size_t k = 0; k < fSmall.size(); k++)
+      nError += (fSmall[k] != fSmallRecompute[k]);
+    checkError ("budget shared by lmax = 100 and 50", nError, 0.0);
+
+    //without a file the tables are recomputed
+    sphereTransformSetLegendreBudget (total, "/nonexistent/quadgrid");
+    nError = !sphereTransformInverse (lmax, gridLmax, c, nVector, f) +
+      !sphereTransformLegendreTables (lmax, gridLmax, block);
+    for (size_t b = 0; b < block.size(); b++)
+      nError += block[b].stored + block[b].mapped;
+    for (size_t k = 0; k < f.size(); k++)
+      nError += (f[k] != fRecompute[k]);
+    checkError ("unmappable directory recomputes every block", nError, 0.0);
+    sphereTransformSetLegendreBudget (0, "");
+  }
+
+  return 1;
+}
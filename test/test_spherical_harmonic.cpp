@@ -0,0 +1,272 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+
+
+
+//1) spin 0 harmonics equal sphereHarmonic (and its symmetry for m < 0), closed forms of
+//   1Y(1,0) and 2Y(2,0), -2Y(2,0)
+//2) the spin raising operator (s+1)Y = -(d/dtheta - s cot(theta) + i/sin(theta) d/dphi) sY
+//   / sqrt((l-s)(l+s+1)) by central differences for s = -2 .. 1
+//3) orthonormality of sY for s = -2 .. 2 and of the vector harmonics Psi, Phi on a
+//   Gauss-Legendre sphere grid, and Psi = grad Y/sqrt(l(l+1)) by central differences
+//4) batched values and gradients (lmax = 40, including the poles): values equal sphereHarmonic,
+//   gradients equal sqrt(l(l+1)) Psi(l,m) in (e_theta, e_phi) and are tangent to the sphere
+
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+
+#include <algorithm>
+#include <complex>
+#include <iostream>
+#include <vector>
+
+#include <quadgrid/spherical_harmonic.hpp>
+#include <quadgrid/unit_sphere_grid_gauss_legendre.hpp>
+#include <quadgrid/constant.hpp>
+using namespace quadgrid;
+
+
+static void checkError (const char *name, const double error, const double tolerance)
+{
+  char sTmp[500];
+  sprintf(sTmp, "%-50s error = %.2le\n", name, error);
+  std::cout << sTmp;
+
+  if (!(error <= tolerance))
+  {
+    sprintf(sTmp, "Error. error = %.2le > %.2le\n", error, tolerance);
+    std::cout << sTmp;
+    exit(0);
+  }
+}
+
+
+int main()
+{
+  char name[200];
+  const size_t lmax = 12;
+  const double arrayTheta[] = {0.1, 0.9, Pi/2.0, 2.3, 3.1};
+  const double arrayPhi[]   = {0.0, 1.3, -2.2, 4.0, 5.9};
+  const size_t nPoint = sizeof(arrayTheta)/sizeof(arrayTheta[0]);
+
+  //1) spin 0 and closed forms
+  {
+    double maxError = 0.0, maxClosed = 0.0;
+    std::vector< std::complex<double> > Y, sY, sY2;
+    for (size_t p = 0; p < nPoint; p++)
+    {
+      const double theta = arrayTheta[p], phi = arrayPhi[p];
+      sphereHarmonic (Y, lmax, theta, phi);
+      sphereHarmonicSpin (sY, 0, lmax, theta, phi);
+      for (size_t l = 0; l <= lmax; l++)
+        for (size_t m = 0; m <= l; m++)
+        {
+          const std::complex<double> y = Y[sphereHarmonicArrayIndex (l, m)];
+          const double sign = (m % 2 == 0) ? 1.0 : -1.0;
+          maxError = std::max(maxError, std::abs(sY[sphereHarmonicSpinArrayIndex (l, (int) m)] - y));
+          maxError = std::max(maxError,
+            std::abs(sY[sphereHarmonicSpinArrayIndex (l, -(int) m)] - sign*std::conj(y)));
+        }
+
+      sphereHarmonicSpin (sY, 1, lmax, theta, phi);
+      maxClosed = std::max(maxClosed,
+        std::abs(sY[sphereHarmonicSpinArrayIndex (1, 0)] - sqrt(3.0/(8.0*Pi))*sin(theta)));
+      sphereHarmonicSpin (sY, 2, lmax, theta, phi);
+      sphereHarmonicSpin (sY2, -2, lmax, theta, phi);
+      const double exact = sqrt(15.0/(32.0*Pi))*sin(theta)*sin(theta);
+      maxClosed = std::max(maxClosed, std::abs(sY[sphereHarmonicSpinArrayIndex (2, 0)] - exact));
+      maxClosed = std::max(maxClosed, std::abs(sY2[sphereHarmonicSpinArrayIndex (2, 0)] - exact));
+    }
+    checkError ("spin 0 = sphereHarmonic", maxError, 1.0E-14);
+    checkError ("closed forms of 1Y(1,0), 2Y(2,0), -2Y(2,0)", maxClosed, 1.0E-15);
+  }
+
+  //2) spin raising operator
+  for (int s = -2; s <= 1; s++)
+  {
+    const double h = 1.0E-5;
+    double maxError = 0.0;
+    std::vector< std::complex<double> > sY, sYUp, sYThetaP, sYThetaM, sYPhiP, sYPhiM;
+    for (size_t p = 0; p < nPoint-1; p++)
+    {
+      const double theta = arrayTheta[p], phi = arrayPhi[p];
+      sphereHarmonicSpin (sY, s, lmax, theta, phi);
+      sphereHarmonicSpin (sYUp, s+1, lmax, theta, phi);
+      sphereHarmonicSpin (sYThetaP, s, lmax, theta+h, phi);
+      sphereHarmonicSpin (sYThetaM, s, lmax, theta-h, phi);
+      sphereHarmonicSpin (sYPhiP, s, lmax, theta, phi+h);
+      sphereHarmonicSpin (sYPhiM, s, lmax, theta, phi-h);
+      for (int l = std::max(abs(s), abs(s+1)); l <= (int) lmax; l++)
+        for (int m = -l; m <= l; m++)
+        {
+          const size_t k = sphereHarmonicSpinArrayIndex (l, m);
+          const std::complex<double> dTheta = (sYThetaP[k] - sYThetaM[k])/(2.0*h);
+          const std::complex<double> dPhi   = (sYPhiP[k] - sYPhiM[k])/(2.0*h);
+          const std::complex<double> raised = -(dTheta - s*cos(theta)/sin(theta)*sY[k] +
+            std::complex<double>(0.0, 1.0)/sin(theta)*dPhi)/sqrt((l-s)*(l+s+1.0));
+          maxError = std::max(maxError, std::abs(raised - sYUp[k]));
+        }
+    }
+    sprintf(name, "spin raising operator, s = %d -> %d", s, s+1);
+    checkError (name, maxError, 1.0E-8);
+  }
+
+  //3) orthonormality
+  {
+    size_t N;
+    std::vector<double> theta, w, phi;
+    unitSphereGaussLegendre (2*lmax, N, theta, w, phi);
+    const size_t size = sphereHarmonicSpinArraySize (lmax);
+    for (int s = -2; s <= 2; s++)
+    {
+      std::vector< std::complex<double> > sY, overlap(size*size, 0.0);
+      for (size_t i = 0; i < N; i++)
+        for (size_t j = 0; j < 2*N; j++)
+        {
+          sphereHarmonicSpin (sY, s, lmax, theta[i], phi[j]);
+          for (size_t a = 0; a < size; a++)
+            for (size_t b = 0; b < size; b++)
+              overlap[a*size+b] += w[i]*sY[a]*std::conj(sY[b]);
+        }
+      double maxError = 0.0;
+      for (int l = 0; l <= (int) lmax; l++)
+        for (int m = -l; m <= l; m++)
+          for (int l2 = 0; l2 <= (int) lmax; l2++)
+            for (int m2 = -l2; m2 <= l2; m2++)
+            {
+              const double exact = ((l == l2) && (m == m2) && (l >= abs(s))) ? 1.0 : 0.0;
+              maxError = std::max(maxError, std::abs(overlap[sphereHarmonicSpinArrayIndex (l, m)*size +
+                sphereHarmonicSpinArrayIndex (l2, m2)] - exact));
+            }
+      sprintf(name, "orthonormality of sY, s = %d", s);
+      checkError (name, maxError, 1.0E-13);
+    }
+
+    //Psi.conj(Psi') = Phi.conj(Phi') = delta, Psi.conj(Phi') = 0 for l >= 1, m >= 0
+    const size_t sizeVector = sphereHarmonicArraySize (lmax);
+    std::vector< std::complex<double> > Psi, overlapPsi(sizeVector*sizeVector, 0.0),
+      overlapMixed(sizeVector*sizeVector, 0.0);
+    for (size_t i = 0; i < N; i++)
+      for (size_t j = 0; j < 2*N; j++)
+      {
+        sphereHarmonicVector (Psi, lmax, theta[i], phi[j]);
+        for (size_t a = 0; a < sizeVector; a++)
+          for (size_t b = 0; b < sizeVector; b++)
+          {
+            //Phi = (-Psi_phi, Psi_theta)
+            overlapPsi[a*sizeVector+b] += w[i]*(Psi[2*a]*std::conj(Psi[2*b]) +
+              Psi[2*a+1]*std::conj(Psi[2*b+1]));
+            overlapMixed[a*sizeVector+b] += w[i]*(Psi[2*a]*std::conj(-Psi[2*b+1]) +
+              Psi[2*a+1]*std::conj(Psi[2*b]));
+          }
+      }
+    double maxError = 0.0;
+    for (size_t a = 1; a < sizeVector; a++)
+      for (size_t b = 1; b < sizeVector; b++)
+        maxError = std::max(maxError, std::max(std::abs(overlapPsi[a*sizeVector+b] -
+          ((a == b) ? 1.0 : 0.0)), std::abs(overlapMixed[a*sizeVector+b])));
+    checkError ("orthonormality of Psi(l,m), Phi(l,m)", maxError, 1.0E-13);
+
+    const double h = 1.0E-5;
+    std::vector< std::complex<double> > Y, YThetaP, YThetaM, YPhiP, YPhiM;
+    maxError = 0.0;
+    for (size_t p = 0; p < nPoint-1; p++)
+    {
+      const double t = arrayTheta[p], f = arrayPhi[p];
+      sphereHarmonicVector (Psi, lmax, t, f);
+      sphereHarmonic (YThetaP, lmax, t+h, f);
+      sphereHarmonic (YThetaM, lmax, t-h, f);
+      sphereHarmonic (YPhiP, lmax, t, f+h);
+      sphereHarmonic (YPhiM, lmax, t, f-h);
+      for (size_t l = 1; l <= lmax; l++)
+        for (size_t m = 0; m <= l; m++)
+        {
+          const size_t k = sphereHarmonicArrayIndex (l, m);
+          const double norm = sqrt(l*(l+1.0));
+          maxError = std::max(maxError, std::abs((YThetaP[k] - YThetaM[k])/(2.0*h*norm) - Psi[2*k]));
+          maxError = std::max(maxError,
+            std::abs((YPhiP[k] - YPhiM[k])/(2.0*h*norm*sin(t)) - Psi[2*k+1]));
+        }
+    }
+    checkError ("Psi = grad Y/sqrt(l(l+1))", maxError, 1.0E-8);
+  }
+
+  //4) values and gradients in one sweep
+  {
+    const size_t lmaxBatch = 40, nBatch = 37;
+    std::vector<double> rUnit(3*nBatch), theta(nBatch), phi(nBatch);
+    for (size_t p = 0; p < nBatch; p++)
+    {
+      theta[p] = Pi*p/(nBatch-1);
+      phi[p]   = 0.37 + 2.1*p;
+      rUnit[p]          = sin(theta[p])*cos(phi[p]);
+      rUnit[nBatch+p]   = sin(theta[p])*sin(phi[p]);
+      rUnit[2*nBatch+p] = cos(theta[p]);
+    }
+    std::vector< std::complex<double> > Y, gradY, Ysingle, Psi;
+    sphereHarmonic (Y, gradY, lmaxBatch, nBatch, &rUnit[0]);
+
+    double maxValue = 0.0, maxGradient = 0.0, maxNormal = 0.0;
+    for (size_t p = 0; p < nBatch; p++)
+    {
+      const double r[3] = {rUnit[p], rUnit[nBatch+p], rUnit[2*nBatch+p]};
+      sphereHarmonic (Ysingle, lmaxBatch, r);
+      const bool pole = (p == 0) || (p == nBatch-1);
+      if (!pole)
+        sphereHarmonicVector (Psi, lmaxBatch, theta[p], phi[p]);
+      const double eTheta[3] = {cos(theta[p])*cos(phi[p]), cos(theta[p])*sin(phi[p]), -sin(theta[p])};
+      const double ePhi[3]   = {-sin(phi[p]), cos(phi[p]), 0.0};
+      for (size_t l = 0; l <= lmaxBatch; l++)
+        for (size_t m = 0; m <= l; m++)
+        {
+          const size_t k = sphereHarmonicArrayIndex (l, m);
+          maxValue = std::max(maxValue, std::abs(Y[k*nBatch+p] - Ysingle[k]));
+          std::complex<double> g[3];
+          for (size_t d = 0; d < 3; d++)
+            g[d] = gradY[(3*k+d)*nBatch+p];
+          //relative to the size sqrt(l(l+1)) of the gradient
+          const double scale = 1.0/std::max(1.0, sqrt(l*(l+1.0)));
+          maxNormal = std::max(maxNormal, scale*std::abs(g[0]*r[0] + g[1]*r[1] + g[2]*r[2]));
+          if (!pole && (l > 0))
+          {
+            const std::complex<double> gTheta = g[0]*eTheta[0] + g[1]*eTheta[1] + g[2]*eTheta[2];
+            const std::complex<double> gPhi   = g[0]*ePhi[0] + g[1]*ePhi[1];
+            maxGradient = std::max(maxGradient, scale*std::abs(gTheta - Psi[2*k]/scale));
+            maxGradient = std::max(maxGradient, scale*std::abs(gPhi - Psi[2*k+1]/scale));
+          }
+        }
+    }
+    checkError ("batched values = sphereHarmonic, lmax = 40", maxValue, 1.0E-14);
+    checkError ("gradient = sqrt(l(l+1)) Psi, lmax = 40", maxGradient, 1.0E-13);
+    checkError ("gradient . rUnit = 0, lmax = 40", maxNormal, 1.0E-13);
+
+    //at the poles only m = 1 has a gradient, |grad Y(l,1)| = sqrt((2l+1)/(4 Pi) l(l+1)/2)
+    double maxPole = 0.0;
+    for (size_t l = 1; l <= lmaxBatch; l++)
+      for (size_t m = 0; m <= l; m++)
+      {
+        const size_t k = sphereHarmonicArrayIndex (l, m);
+        double norm2 = 0.0;
+        for (size_t d = 0; d < 3; d++)
+          norm2 += std::norm(gradY[(3*k+d)*nBatch]);
+        const double exact = (m == 1) ? sqrt((2.0*l+1.0)/(4.0*Pi)*l*(l+1.0)/2.0) : 0.0;
+        maxPole = std::max(maxPole, fabs(sqrt(norm2) - exact)/sqrt(l*(l+1.0)));
+      }
+    checkError ("gradient at the north pole", maxPole, 1.0E-13);
+  }
+
+  return 1;
+}
@@ -0,0 +1,224 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// quadgrid - High-accuracy quadrature grids for scientific computing
+// Copyright 2025 Denny Elking
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+
+
+
+
+//1) Risbo's recursion against the explicit Wigner sum for l <= 12 (which loses digits to
+//   cancellation) and orthogonality Sum{ d_(m n) d_(m' n) } = delta for l <= 100
+//2) rotated coefficients reproduce f(Rot^-1 r) at random points (lmax = 24)
+//3) many vectors at once equal single rotations, and a rotation followed by its inverse is
+//   the identity with cached (lmax = 300) and recomputed (lmax = 400) matrices
+
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+
+#include <algorithm>
+#include <complex>
+#include <iostream>
+#include <vector>
+
+#include <quadgrid/wigner.hpp>
+#include <quadgrid/spherical_harmonic.hpp>
+#include <quadgrid/constant.hpp>
+using namespace quadgrid;
+
+
+static void checkError (const char *name, const double error, const double tolerance)
+{
+  char sTmp[500];
+  sprintf(sTmp, "%-50s error = %.2le\n", name, error);
+  std::cout << sTmp;
+
+  if (!(error <= tolerance))
+  {
+    sprintf(sTmp, "Error. error = %.2le > %.2le\n", error, tolerance);
+    std::cout << sTmp;
+    exit(0);
+  }
+}
+
+static double randomValue ()
+{
+  return 2.0*rand()/RAND_MAX - 1.0;
+}
+
+//explicit sum of d^l_(m n)(beta)
+static double wignerExplicit (const int l, const int m, const int n, const double beta)
+{
+  const double ch = cos(0.5*beta), sh = sin(0.5*beta);
+  double sum = 0.0;
+  for (int s = std::max(0, n-m); s <= std::min(l+n, l-m); s++)
+  {
+    const double logTerm = 0.5*(lgamma(l+m+1.0) + lgamma(l-m+1.0) + lgamma(l+n+1.0) +
+      lgamma(l-n+1.0)) - lgamma(l+n-s+1.0) - lgamma(s+1.0) - lgamma(m-n+s+1.0) -
+      lgamma(l-m-s+1.0);
+    const double sign = ((m-n+s) % 2 == 0) ? 1.0 : -1.0;
+    sum += sign*exp(logTerm)*pow(ch, 2.0*l+n-m-2.0*s)*pow(sh, m-n+2.0*s);
+  }
+  return sum;
+}
+
+//real function Sum{ c(l,m) Y(l,m) } at r
+static double evaluate (const size_t lmax, const std::vector< std::complex<double> >& c,
+  const double r[3])
+{
+  std::vector< std::complex<double> > Y;
+  sphereHarmonic (Y, lmax, r);
+  double f = 0.0;
+  for (size_t l = 0; l <= lmax; l++)
+    for (size_t m = 0; m <= l; m++)
+    {
+      const size_t k = sphereHarmonicArrayIndex (l, m);
+      f += ((m == 0) ? 1.0 : 2.0)*std::real(c[k]*Y[k]);
+    }
+  return f;
+}
+
+static void randomCoefficients (const size_t lmax, const size_t nVector,
+  std::vector< std::complex<double> >& c)
+{
+  c.resize(nVector*sphereHarmonicArraySize (lmax));
+  for (size_t v = 0; v < nVector; v++)
+    for (size_t l = 0; l <= lmax; l++)
+      for (size_t m = 0; m <= l; m++)
+        c[v*sphereHarmonicArraySize (lmax) + sphereHarmonicArrayIndex (l, m)] =
+          std::complex<double>(randomValue (), (m == 0) ? 0.0 : randomValue ());
+}
+
+static double maxDifference (const std::vector< std::complex<double> >& a,
+  const std::vector< std::complex<double> >& b)
+{
+  double error = 0.0;
+  for (size_t k = 0; k < a.size(); k++)
+    error = std::max(error, std::abs(a[k] - b[k]));
+  return error;
+}
+
+
+int main()
+{
+  char name[200];
+  srand(42);
+  const double arrayBeta[] = {0.0, 0.3, 1.2, Pi/2.0, 2.9, Pi, -0.7};
+
+  //1) d-matrices
+  for (size_t t = 0; t < sizeof(arrayBeta)/sizeof(arrayBeta[0]); t++)
+  {
+    std::vector<double> d;
+    wignerSmallD (12, arrayBeta[t], d);
+    double maxExplicit = 0.0;
+    for (int l = 0; l <= 12; l++)
+      for (int m = -l; m <= l; m++)
+        for (int n = -l; n <= l; n++)
+          maxExplicit = std::max(maxExplicit,
+            fabs(d[wignerArrayIndex (l, m, n)] - wignerExplicit (l, m, n, arrayBeta[t])));
+    sprintf(name, "explicit sum, l <= 12, beta = %.4lf", arrayBeta[t]);
+    checkError (name, maxExplicit, 1.0E-11);
+
+    const int lmax = 100;
+    wignerSmallD (lmax, arrayBeta[t], d);
+    double maxOrthogonal = 0.0;
+    for (int l = 0; l <= lmax; l += 11)
+      for (int m = -l; m <= l; m++)
+        for (int mm = m; mm <= l; mm++)
+        {
+          double sum = 0.0;
+          for (int n = -l; n <= l; n++)
+            sum += d[wignerArrayIndex (l, m, n)]*d[wignerArrayIndex (l, mm, n)];
+          maxOrthogonal = std::max(maxOrthogonal, fabs(sum - ((m == mm) ? 1.0 : 0.0)));
+        }
+    sprintf(name, "orthogonality, l <= 100, beta = %.4lf", arrayBeta[t]);
+    checkError (name, maxOrthogonal, 1.0E-13);
+  }
+
+  //2) rotated function values
+  {
+    const size_t lmax = 24;
+    const double alpha = 0.7, beta = 2.1, gamma = -1.3;
+    std::vector< std::complex<double> > c, cRot;
+    randomCoefficients (lmax, 1, c);
+    cRot = c;
+    sphereHarmonicRotate (lmax, alpha, beta, gamma, 1, cRot);
+
+    //Rot = R_z(alpha) R_y(beta) R_z(gamma)
+    double Rz1[3][3] = {{cos(alpha), -sin(alpha), 0.0}, {sin(alpha), cos(alpha), 0.0}, {0.0, 0.0, 1.0}};
+    double Ry[3][3]  = {{cos(beta), 0.0, sin(beta)}, {0.0, 1.0, 0.0}, {-sin(beta), 0.0, cos(beta)}};
+    double Rz2[3][3] = {{cos(gamma), -sin(gamma), 0.0}, {sin(gamma), cos(gamma), 0.0}, {0.0, 0.0, 1.0}};
+    double T[3][3], Rot[3][3];
+    for (size_t i = 0; i < 3; i++)
+      for (size_t j = 0; j < 3; j++)
+      {
+        T[i][j] = 0.0;
+        for (size_t k = 0; k < 3; k++)
+          T[i][j] += Ry[i][k]*Rz2[k][j];
+      }
+    for (size_t i = 0; i < 3; i++)
+      for (size_t j = 0; j < 3; j++)
+      {
+        Rot[i][j] = 0.0;
+        for (size_t k = 0; k < 3; k++)
+          Rot[i][j] += Rz1[i][k]*T[k][j];
+      }
+
+    double maxError = 0.0;
+    for (size_t i = 0; i < 50; i++)
+    {
+      double r[3], rRot[3];
+      for (size_t k = 0; k < 3; k++)
+        r[k] = randomValue ();
+      const double norm = sqrt(r[0]*r[0] + r[1]*r[1] + r[2]*r[2]);
+      for (size_t k = 0; k < 3; k++)
+        r[k] /= norm;
+      for (size_t k = 0; k < 3; k++)
+        rRot[k] = Rot[k][0]*r[0] + Rot[k][1]*r[1] + Rot[k][2]*r[2];
+      maxError = std::max(maxError, fabs(evaluate (lmax, cRot, rRot) - evaluate (lmax, c, r)));
+    }
+    checkError ("f'(Rot r) = f(r), lmax = 24", maxError, 1.0E-12);
+  }
+
+  //3) many vectors, inverse rotation
+  {
+    const size_t lmax = 40, nVector = 7, size = sphereHarmonicArraySize (lmax);
+    std::vector< std::complex<double> > c, cBatch, cSingle;
+    randomCoefficients (lmax, nVector, c);
+    cBatch = c;
+    sphereHarmonicRotate (lmax, 0.4, 1.1, 2.2, nVector, cBatch);
+    double maxError = 0.0;
+    for (size_t v = 0; v < nVector; v++)
+    {
+      cSingle.assign(c.begin() + v*size, c.begin() + (v+1)*size);
+      sphereHarmonicRotate (lmax, 0.4, 1.1, 2.2, 1, cSingle);
+      for (size_t k = 0; k < size; k++)
+        maxError = std::max(maxError, std::abs(cSingle[k] - cBatch[v*size+k]));
+    }
+    checkError ("7 vectors at once against single vectors", maxError, 1.0E-14);
+  }
+
+  const size_t arrayLmax[] = {300, 400};
+  for (size_t t = 0; t < 2; t++)
+  {
+    const size_t lmax = arrayLmax[t];
+    std::vector< std::complex<double> > c, cRot;
+    randomCoefficients (lmax, 2, c);
+    cRot = c;
+    sphereHarmonicRotate (lmax, 0.9, 1.7, -2.4, 2, cRot);
+    sphereHarmonicRotate (lmax, 2.4, -1.7, -0.9, 2, cRot);
+    sprintf(name, "rotation and inverse, lmax = %lu", lmax);
+    checkError (name, maxDifference (cRot, c), 1.0E-12);
+  }
+
+  return 1;
+}